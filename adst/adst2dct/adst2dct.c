@@ -7,10 +7,10 @@
 #include "aom/aom_integer.h"
 #include "aom_dsp/aom_dsp_common.h"
 #include "aom/aom_dsp/txfm_common.h"
+#include "adst2dct.h"
 
 // AV1 Constants
 #define DCT_CONST_BITS 14
-#define ROW_SIZE (4)
 #define WRAPLOW(x) ((((int32_t) x) << 16) >> 16)
 
 /* Shift down with rounding for use when n >= 0, value >= 0 */
@@ -28,7 +28,7 @@ static INLINE tran_high_t dct_const_round_shift(tran_high_t input) {
 }
 
 // AV1 Forward ADST
-static void fadst4(const tran_low_t *input, tran_low_t *output) {
+void fadst4(const tran_low_t *input, tran_low_t *output) {
   tran_high_t x0, x1, x2, x3;
   tran_high_t s0, s1, s2, s3, s4, s5, s6, s7;
 
@@ -107,7 +107,7 @@ void iadst4_c(const tran_low_t *input, tran_low_t *output) {
 }
 
 // AV1 Forward DCT
-static void fdct4(const tran_low_t *input, tran_low_t *output) {
+void fdct4(const tran_low_t *input, tran_low_t *output) {
   tran_high_t temp;
   tran_low_t step[4];
 
@@ -188,45 +188,3 @@ void adst2dct(const tran_low_t *input, tran_low_t *output) {
   output[2] = (tran_low_t)fdct_round_shift(o1);
   output[3] = (tran_low_t)fdct_round_shift(o3);
 }
-
-// Utility functions for the experiment
-void rand_row(tran_low_t *const row) {
-  int i;
-  for (i = 0; i < ROW_SIZE; i++) {
-      row[i] = rand() % 256;
-  }
-}
-
-void print_row(const tran_low_t *const row, const char const* title) {
-  int i;
-  printf("%s:", title);
-  for (i = 0; i < ROW_SIZE; i++) {
-      printf(" %d", row[i]);
-  }
-  printf("\n");
-}
-
-int main(int _argc,char **_argv) {
-
-  tran_low_t row[ROW_SIZE] = {0};
-  tran_low_t dct_row[ROW_SIZE] = {0};
-  tran_low_t adst_row[ROW_SIZE] = {0};
-  //tran_low_t iadst_row[ROW_SIZE] = {0};
-  tran_low_t adst2dct_row[ROW_SIZE] = {0};
-
-  rand_row(row);
-  print_row(row, "Random Pixel Values");
-
-  fadst4(row, adst_row);
-  print_row(adst_row, "ADST Values");
-
-  fdct4(row, dct_row);
-  print_row(dct_row, "DCT Values");
-
-  // Just for validation
-  //iadst4_c(adst_row, iadst_row);
-  //print_row(iadst_row, "iADST Values");
-
-  adst2dct(adst_row, adst2dct_row);
-  print_row(adst2dct_row, "ADST2DCT Values");
-}
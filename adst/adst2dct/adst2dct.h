@@ -0,0 +1,18 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#ifndef ADST2DCT_H_
+#define ADST2DCT_H_
+
+#include "aom/aom_integer.h"
+
+// The 4-point transforms of aom_dsp (see adst2dct.c).
+void fadst4(const tran_low_t *input, tran_low_t *output);
+void iadst4_c(const tran_low_t *input, tran_low_t *output);
+void fdct4(const tran_low_t *input, tran_low_t *output);
+
+// Fused iadst4_c() and fdct4().
+void adst2dct(const tran_low_t *input, tran_low_t *output);
+
+#endif  // ADST2DCT_H_
@@ -0,0 +1,170 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#include <assert.h>
+
+#include "av1/common/av1_fwd_txfm1d.h"
+#include "av1/common/av1_inv_txfm1d.h"
+#include "adst2dct_2d.h"
+
+#define ADST2DCT_MAX_STAGES (12)
+
+typedef struct ADST2DCT_CFG {
+  TxfmFunc iadst;
+  TxfmFunc fdct;
+  const int8_t *cos_bit;
+  // Shift between the iADST and the fDCT (keeps the fDCT of 32 bit).
+  int mid_shift;
+  // log2(N/2) - mid_shift: removes the gain of the iADST and the fDCT.
+  int out_shift;
+} ADST2DCT_CFG;
+
+static const int8_t adst2dct_cos_bit_13[ADST2DCT_MAX_STAGES] = {
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13
+};
+static const int8_t adst2dct_cos_bit_12[ADST2DCT_MAX_STAGES] = {
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+};
+// Only used with CONFIG_COEFFICIENT_RANGE_CHECKING.
+static const int8_t adst2dct_stage_range[ADST2DCT_MAX_STAGES] = {
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32
+};
+
+static const ADST2DCT_CFG adst2dct_cfg[4] = {
+  { av1_iadst4_new, av1_fdct4_new, adst2dct_cos_bit_13, 0, 1 },
+  { av1_iadst8_new, av1_fdct8_new, adst2dct_cos_bit_13, 0, 2 },
+  { av1_iadst16_new, av1_fdct16_new, adst2dct_cos_bit_13, 1, 2 },
+  { av1_iadst32_new, av1_fdct32_new, adst2dct_cos_bit_12, 2, 2 },
+};
+
+static INLINE void adst2dct(const int32_t *input, int32_t *output, int n,
+                            const ADST2DCT_CFG *cfg) {
+  int32_t tmp[32];
+  cfg->iadst(input, tmp, cfg->cos_bit, adst2dct_stage_range);
+  round_shift_array(tmp, n, cfg->mid_shift);
+  cfg->fdct(tmp, output, cfg->cos_bit, adst2dct_stage_range);
+  round_shift_array(output, n, cfg->out_shift);
+}
+
+void adst2dct4_new(const int32_t *input, int32_t *output) {
+  adst2dct(input, output, 4, &adst2dct_cfg[0]);
+}
+
+void adst2dct8_new(const int32_t *input, int32_t *output) {
+  adst2dct(input, output, 8, &adst2dct_cfg[1]);
+}
+
+void adst2dct16_new(const int32_t *input, int32_t *output) {
+  adst2dct(input, output, 16, &adst2dct_cfg[2]);
+}
+
+void adst2dct32_new(const int32_t *input, int32_t *output) {
+  adst2dct(input, output, 32, &adst2dct_cfg[3]);
+}
+
+static INLINE int txfm2d_log2(int n) {
+  switch (n) {
+    case 4: return 2;
+    case 8: return 3;
+    case 16: return 4;
+    case 32: return 5;
+    default: assert(0); return 0;
+  }
+}
+
+static INLINE int col_is_adst(int tx_type) {
+  return tx_type == ADST_DCT || tx_type == ADST_ADST;
+}
+
+static INLINE int row_is_adst(int tx_type) {
+  return tx_type == DCT_ADST || tx_type == ADST_ADST;
+}
+
+static const TxfmFunc fwd_dct[4] = { av1_fdct4_new, av1_fdct8_new,
+                                     av1_fdct16_new, av1_fdct32_new };
+static const TxfmFunc fwd_adst[4] = { av1_fadst4_new, av1_fadst8_new,
+                                      av1_fadst16_new, av1_fadst32_new };
+static const TxfmFunc inv_dct[4] = { av1_idct4_new, av1_idct8_new,
+                                     av1_idct16_new, av1_idct32_new };
+static const TxfmFunc inv_adst[4] = { av1_iadst4_new, av1_iadst8_new,
+                                      av1_iadst16_new, av1_iadst32_new };
+
+void adst2dct_2d(int32_t *coeffs, int n, int tx_type) {
+  const ADST2DCT_CFG *cfg;
+  int32_t in[32];
+  int32_t out[32];
+  int i;
+  int j;
+  switch (n) {
+    case 4: cfg = &adst2dct_cfg[0]; break;
+    case 8: cfg = &adst2dct_cfg[1]; break;
+    case 16: cfg = &adst2dct_cfg[2]; break;
+    case 32: cfg = &adst2dct_cfg[3]; break;
+    default: assert(0); return;
+  }
+  if (col_is_adst(tx_type)) {
+    for (j = 0; j < n; j++) {
+      for (i = 0; i < n; i++) in[i] = coeffs[i * n + j];
+      adst2dct(in, out, n, cfg);
+      for (i = 0; i < n; i++) coeffs[i * n + j] = out[i];
+    }
+  }
+  if (row_is_adst(tx_type)) {
+    for (i = 0; i < n; i++) {
+      adst2dct(coeffs + i * n, out, n, cfg);
+      for (j = 0; j < n; j++) coeffs[i * n + j] = out[j];
+    }
+  }
+}
+
+void fwd_txfm2d_new(const int16_t *input, int32_t *output, int n,
+                    int tx_type) {
+  const int s = txfm2d_log2(n) - 2;
+  // The shifts of av1_fwd_txfm2d_cfg.h: { 2, -mid_shift, 0 }.
+  const int mid_shift = s == 3 ? 4 : s;
+  const int8_t *cos_bit_col = n < 32 ? adst2dct_cos_bit_13 : adst2dct_cos_bit_12;
+  const int8_t *cos_bit_row = n < 16 ? adst2dct_cos_bit_13 : adst2dct_cos_bit_12;
+  const TxfmFunc col = col_is_adst(tx_type) ? fwd_adst[s] : fwd_dct[s];
+  const TxfmFunc row = row_is_adst(tx_type) ? fwd_adst[s] : fwd_dct[s];
+  int32_t buf[32 * 32];
+  int32_t in[32];
+  int32_t out[32];
+  int i;
+  int j;
+  for (j = 0; j < n; j++) {
+    for (i = 0; i < n; i++) in[i] = input[i * n + j] * 4;
+    col(in, out, cos_bit_col, adst2dct_stage_range);
+    round_shift_array(out, n, mid_shift);
+    for (i = 0; i < n; i++) buf[i * n + j] = out[i];
+  }
+  for (i = 0; i < n; i++) {
+    row(buf + i * n, output + i * n, cos_bit_row, adst2dct_stage_range);
+  }
+}
+
+void inv_txfm2d_new(const int32_t *input, int16_t *output, int n,
+                    int tx_type) {
+  const int s = txfm2d_log2(n) - 2;
+  // The shifts of av1_inv_txfm2d_cfg.h: { 0, -4 }, { 0, -5 }, { -1, -5 }.
+  const int row_shift = n < 16 ? 0 : 1;
+  const int col_shift = n == 4 ? 4 : 5;
+  const int8_t *cos_bit_row = n < 16 ? adst2dct_cos_bit_13 : adst2dct_cos_bit_12;
+  const TxfmFunc col = col_is_adst(tx_type) ? inv_adst[s] : inv_dct[s];
+  const TxfmFunc row = row_is_adst(tx_type) ? inv_adst[s] : inv_dct[s];
+  int32_t buf[32 * 32];
+  int32_t in[32];
+  int32_t out[32];
+  int i;
+  int j;
+  for (i = 0; i < n; i++) {
+    row(input + i * n, buf + i * n, cos_bit_row, adst2dct_stage_range);
+    round_shift_array(buf + i * n, n, row_shift);
+  }
+  for (j = 0; j < n; j++) {
+    for (i = 0; i < n; i++) in[i] = buf[i * n + j];
+    col(in, out, adst2dct_cos_bit_13, adst2dct_stage_range);
+    round_shift_array(out, n, col_shift);
+    for (i = 0; i < n; i++) output[i * n + j] = (int16_t)out[i];
+  }
+}
@@ -0,0 +1,36 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#ifndef ADST2DCT_2D_H_
+#define ADST2DCT_2D_H_
+
+#include "aom/aom_integer.h"
+#include "av1/common/enums.h"
+
+/* Converts the N coefficients of av1_fadstN_new() into the coefficients of
+ * av1_fdctN_new() (both have a gain of sqrt(N/2)), without going back to
+ * pixels: the iADST and the fDCT are applied one after the other on 32 bit
+ * values and the only rounding is at the end. */
+void adst2dct4_new(const int32_t *input, int32_t *output);
+void adst2dct8_new(const int32_t *input, int32_t *output);
+void adst2dct16_new(const int32_t *input, int32_t *output);
+void adst2dct32_new(const int32_t *input, int32_t *output);
+
+/* Converts in place the n x n (n = 4, 8, 16 or 32) coefficients of a
+ * DCT_DCT, ADST_DCT, DCT_ADST or ADST_ADST block into the coefficients of a
+ * DCT_DCT block: the columns are converted when the vertical transform is the
+ * ADST and the rows are converted when the horizontal transform is the
+ * ADST. */
+void adst2dct_2d(int32_t *coeffs, int n, int tx_type);
+
+/* 2-D transforms of n x n blocks (stride n) made of the 1-D transforms of
+ * av1_fwd_txfm1d.c and av1_inv_txfm1d.c, with the shifts of
+ * av1_fwd_txfm2d_NxN_c() and av1_inv_txfm2d_add_NxN_c(). The inverse
+ * outputs the residual (it is not added to a prediction nor clamped). */
+void fwd_txfm2d_new(const int16_t *input, int32_t *output, int n,
+                    int tx_type);
+void inv_txfm2d_new(const int32_t *input, int16_t *output, int n,
+                    int tx_type);
+
+#endif  // ADST2DCT_2D_H_
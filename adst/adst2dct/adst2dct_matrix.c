@@ -0,0 +1,148 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include "adst2dct_matrix.h"
+
+int16_t adst2dct_matrix[4][32 * 32];
+int16_t adst2dct_matrix_t[4][32 * 32];
+int32_t adst2dct_matrix_pairs[4][32 * 16];
+
+/* av1_fdctN_new: out[k] = sum(in[x]*cos(pi*(2*x + 1)*k/(2*N))), with the DC
+ * divided by sqrt(2).
+ * av1_fadstN_new: out[k] = sum(in[x]*sin(pi*(2*x + 1)*(2*k + 1)/(4*N))). */
+static double dct_basis(int k, int x, int n) {
+  return cos(M_PI * (2 * x + 1) * k / (2.0 * n)) * (k ? 1 : M_SQRT1_2);
+}
+
+static double adst_basis(int k, int x, int n) {
+  return sin(M_PI * (2 * x + 1) * (2 * k + 1) / (4.0 * n));
+}
+
+void adst2dct_matrix_init(void) {
+  int s;
+  for (s = 0; s < 4; s++) {
+    const int n = 4 << s;
+    int k;
+    int j;
+    int x;
+    for (k = 0; k < n; k++) {
+      int32_t l1 = 0;
+      for (j = 0; j < n; j++) {
+        double m = 0;
+        int16_t q;
+        for (x = 0; x < n; x++) m += dct_basis(k, x, n) * adst_basis(j, x, n);
+        q = (int16_t)lrint(m * 2 / n * (1 << ADST2DCT_MATRIX_BITS));
+        adst2dct_matrix[s][k * n + j] = q;
+        adst2dct_matrix_t[s][(j >> 1) * 2 * n + 2 * k + (j & 1)] = q;
+        l1 += abs(q);
+      }
+      // The sums of 32 bits cannot overflow (see adst2dct_matrix.h).
+      assert((int64_t)l1 * 32768 + (1 << (ADST2DCT_MATRIX_BITS - 1))
+             <= INT32_MAX);
+      for (j = 0; j < n; j += 2) {
+        adst2dct_matrix_pairs[s][k * n / 2 + j / 2] =
+            (uint16_t)adst2dct_matrix[s][k * n + j]
+            | (uint32_t)adst2dct_matrix[s][k * n + j + 1] << 16;
+      }
+    }
+  }
+}
+
+static INLINE int32_t matrix_round(int32_t acc) {
+  return (acc + (1 << (ADST2DCT_MATRIX_BITS - 1))) >> ADST2DCT_MATRIX_BITS;
+}
+
+static void adst2dct_matrix_c_impl(int32_t *coeffs, int n, int tx_type,
+                                   int sparse) {
+  const int16_t *m = adst2dct_matrix[adst2dct_matrix_size(n)];
+  int16_t in[32 * 32];
+  int i;
+  int j;
+  int k;
+  if (tx_type == ADST_DCT || tx_type == ADST_ADST) {
+    int zero[32];
+    for (j = 0; j < n; j++) {
+      zero[j] = 1;
+      for (i = 0; i < n; i++) {
+        in[j * n + i] = adst2dct_sat16(coeffs[j * n + i]);
+        zero[j] &= !in[j * n + i];
+      }
+    }
+    for (k = 0; k < n; k++) {
+      for (i = 0; i < n; i++) {
+        int32_t acc = 0;
+        for (j = 0; j < n; j += 2) {
+          if (sparse && zero[j] && zero[j + 1]) continue;
+          acc += m[k * n + j] * in[j * n + i]
+              + m[k * n + j + 1] * in[(j + 1) * n + i];
+        }
+        coeffs[k * n + i] = matrix_round(acc);
+      }
+    }
+  }
+  if (tx_type == DCT_ADST || tx_type == ADST_ADST) {
+    for (i = 0; i < n; i++) {
+      int32_t *row = coeffs + i * n;
+      for (j = 0; j < n; j++) in[j] = adst2dct_sat16(row[j]);
+      for (k = 0; k < n; k++) {
+        int32_t acc = 0;
+        for (j = 0; j < n; j += 2) {
+          if (sparse && !in[j] && !in[j + 1]) continue;
+          acc += m[k * n + j] * in[j] + m[k * n + j + 1] * in[j + 1];
+        }
+        row[k] = matrix_round(acc);
+      }
+    }
+  }
+}
+
+void adst2dct_matrix_c(int32_t *coeffs, int n, int tx_type) {
+  adst2dct_matrix_c_impl(coeffs, n, tx_type, 0);
+}
+
+void adst2dct_matrix_sparse_c(int32_t *coeffs, int n, int tx_type) {
+  adst2dct_matrix_c_impl(coeffs, n, tx_type, 1);
+}
+
+void adst2dct_matrix_ref(int32_t *coeffs, int n, int tx_type) {
+  double m[32][32];
+  double tmp[32 * 32];
+  int i;
+  int j;
+  int k;
+  int x;
+  for (k = 0; k < n; k++) {
+    for (j = 0; j < n; j++) {
+      m[k][j] = 0;
+      for (x = 0; x < n; x++) m[k][j] += dct_basis(k, x, n) * adst_basis(j, x, n);
+      m[k][j] *= 2.0 / n;
+    }
+  }
+  for (i = 0; i < n * n; i++) tmp[i] = coeffs[i];
+  if (tx_type == ADST_DCT || tx_type == ADST_ADST) {
+    double col[32];
+    for (i = 0; i < n; i++) {
+      for (k = 0; k < n; k++) {
+        col[k] = 0;
+        for (j = 0; j < n; j++) col[k] += m[k][j] * tmp[j * n + i];
+      }
+      for (k = 0; k < n; k++) tmp[k * n + i] = col[k];
+    }
+  }
+  if (tx_type == DCT_ADST || tx_type == ADST_ADST) {
+    double row[32];
+    for (i = 0; i < n; i++) {
+      for (k = 0; k < n; k++) {
+        row[k] = 0;
+        for (j = 0; j < n; j++) row[k] += m[k][j] * tmp[i * n + j];
+      }
+      for (k = 0; k < n; k++) tmp[i * n + k] = row[k];
+    }
+  }
+  for (i = 0; i < n * n; i++) coeffs[i] = (int32_t)lrint(tmp[i]);
+}
@@ -0,0 +1,52 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#ifndef ADST2DCT_MATRIX_H_
+#define ADST2DCT_MATRIX_H_
+
+#include "adst2dct_2d.h"
+
+/* Matrix form of the ADST to DCT conversion of adst2dct_2d(). The conversion
+ * matrix of N points is M = 2/N*DCT_N*ADST_N^T (the 1-D transforms of
+ * av1_fwd_txfm1d.c without their gain), stored with ADST2DCT_MATRIX_BITS of
+ * precision. The products are done on 16 bit coefficients and summed on 32
+ * bits, so the C and the SIMD versions are bit-exact. Every version saturates
+ * its inputs to 16 bits (8 bit content fits) on entry, and the sums cannot
+ * overflow: the largest sum of |M[k][j]| is 52189 (N = 32), and
+ * 52189*2^15 + 2^13 < 2^31. adst2dct_matrix_init() asserts this bound. */
+#define ADST2DCT_MATRIX_BITS (14)
+
+// Fills the tables below (call once before any conversion).
+void adst2dct_matrix_init(void);
+
+// M[k][j], n*n values for each size (4, 8, 16 and 32).
+extern int16_t adst2dct_matrix[4][32 * 32];
+// Rows of M^T two by two: [j/2][2*k + (j & 1)] = M[k][j].
+extern int16_t adst2dct_matrix_t[4][32 * 32];
+// Pairs of M[k][j] for even j: [k][j/2] = M[k][j] | M[k][j + 1] << 16.
+extern int32_t adst2dct_matrix_pairs[4][32 * 16];
+
+/* Converts in place the n x n coefficients (stride n) of a tx_type block
+ * into the coefficients of a DCT_DCT block, like adst2dct_2d(). The sparse
+ * versions skip the pairs of zero coefficients of the rows and the pairs of
+ * zero rows of the columns. */
+void adst2dct_matrix_c(int32_t *coeffs, int n, int tx_type);
+void adst2dct_matrix_sse2(int32_t *coeffs, int n, int tx_type);
+void adst2dct_matrix_avx2(int32_t *coeffs, int n, int tx_type);
+void adst2dct_matrix_sparse_c(int32_t *coeffs, int n, int tx_type);
+void adst2dct_matrix_sparse_sse2(int32_t *coeffs, int n, int tx_type);
+void adst2dct_matrix_sparse_avx2(int32_t *coeffs, int n, int tx_type);
+
+// Double precision conversion (rounded once at the end), for validation.
+void adst2dct_matrix_ref(int32_t *coeffs, int n, int tx_type);
+
+static INLINE int adst2dct_matrix_size(int n) {
+  return n == 4 ? 0 : n == 8 ? 1 : n == 16 ? 2 : 3;
+}
+
+static INLINE int16_t adst2dct_sat16(int32_t v) {
+  return (int16_t)(v < INT16_MIN ? INT16_MIN : v > INT16_MAX ? INT16_MAX : v);
+}
+
+#endif  // ADST2DCT_MATRIX_H_
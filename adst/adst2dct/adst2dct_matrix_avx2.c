@@ -0,0 +1,41 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#include <immintrin.h>
+
+typedef __m256i adst2dct_vec;
+
+#define ADST2DCT_LANES (8)
+#define ADST2DCT_NAME(name) name##_avx2
+#define VEC_ZERO() _mm256_setzero_si256()
+#define VEC_ADD(a, b) _mm256_add_epi32(a, b)
+#define VEC_MADD(a, b) _mm256_madd_epi16(a, b)
+#define VEC_SET1(v) _mm256_set1_epi32(v)
+#define VEC_LOAD(p) _mm256_loadu_si256((const __m256i *)(p))
+#define VEC_STORE(p, v) _mm256_storeu_si256((__m256i *)(p), v)
+#define VEC_ROUND(v)                                                \
+  _mm256_srai_epi32(                                                \
+      _mm256_add_epi32(v,                                           \
+                       _mm256_set1_epi32(1 << (ADST2DCT_MATRIX_BITS \
+                                               - 1))),              \
+      ADST2DCT_MATRIX_BITS)
+
+#include "adst2dct_matrix_simd.h"
+
+// 4x4 blocks only have 4 outputs per row, they use the SSE2 version.
+void adst2dct_matrix_avx2(int32_t *coeffs, int n, int tx_type) {
+  if (n == 4) {
+    adst2dct_matrix_sse2(coeffs, n, tx_type);
+    return;
+  }
+  adst2dct_matrix_impl_avx2(coeffs, n, tx_type, 0);
+}
+
+void adst2dct_matrix_sparse_avx2(int32_t *coeffs, int n, int tx_type) {
+  if (n == 4) {
+    adst2dct_matrix_sparse_sse2(coeffs, n, tx_type);
+    return;
+  }
+  adst2dct_matrix_impl_avx2(coeffs, n, tx_type, 1);
+}
@@ -0,0 +1,109 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+
+/* Template for the SIMD versions of adst2dct_matrix_c(). Each vector holds
+ * ADST2DCT_LANES 32 bit outputs, computed with a 16 bit multiply-accumulate
+ * of two inputs (pmaddwd) per lane.
+ *
+ * Before including this file, define:
+ *   adst2dct_vec                the vector type
+ *   ADST2DCT_LANES              the number of 32 bit lanes (4 or 8)
+ *   ADST2DCT_NAME(name)         name##_<isa>
+ *   VEC_ZERO(), VEC_ADD(a, b), VEC_MADD(a, b) (pmaddwd), VEC_SET1(v)
+ *   (32 bit), VEC_LOAD(p), VEC_STORE(p, v) (unaligned),
+ *   VEC_ROUND(v)                (v + (1 << (BITS - 1))) >> BITS
+ * The sizes with fewer than ADST2DCT_LANES outputs are not supported. */
+
+#include <emmintrin.h>
+
+#include "adst2dct_matrix.h"
+
+/* Rows: out[i][k] = sum(in[i][j]*M[k][j]). For each pair of inputs, the pair
+ * is broadcast and multiplied with the rows j and j + 1 of M^T. */
+static INLINE void ADST2DCT_NAME(convert_rows)(int32_t *coeffs, int n,
+                                               const int16_t *mt,
+                                               int sparse) {
+  const int vecs = n / ADST2DCT_LANES;
+  int i;
+  int j;
+  int v;
+  for (i = 0; i < n; i++) {
+    int32_t *row = coeffs + i * n;
+    adst2dct_vec acc[32 / ADST2DCT_LANES];
+    for (v = 0; v < vecs; v++) acc[v] = VEC_ZERO();
+    for (j = 0; j < n; j += 2) {
+      const int16_t a0 = adst2dct_sat16(row[j]);
+      const int16_t a1 = adst2dct_sat16(row[j + 1]);
+      adst2dct_vec b;
+      if (sparse && !(a0 | a1)) continue;
+      b = VEC_SET1((int32_t)((uint16_t)a0 | (uint32_t)(uint16_t)a1 << 16));
+      for (v = 0; v < vecs; v++) {
+        acc[v] = VEC_ADD(acc[v],
+                         VEC_MADD(b, VEC_LOAD(mt + j * n
+                                              + 2 * ADST2DCT_LANES * v)));
+      }
+    }
+    for (v = 0; v < vecs; v++) {
+      VEC_STORE(row + ADST2DCT_LANES * v, VEC_ROUND(acc[v]));
+    }
+  }
+}
+
+/* Columns: out[k][i] = sum(M[k][j]*in[j][i]). The rows j and j + 1 of the
+ * input are interleaved (with SSE2, on 4 columns at a time) and multiplied
+ * with the broadcast pair M[k][j], M[k][j + 1]. */
+static INLINE void ADST2DCT_NAME(convert_cols)(int32_t *coeffs, int n,
+                                               const int32_t *mpairs,
+                                               int sparse) {
+  const int vecs = n / ADST2DCT_LANES;
+  int16_t pairs[16][64];
+  int nonzero[16];
+  int i;
+  int j;
+  int k;
+  int v;
+  for (j = 0; j < n; j += 2) {
+    __m128i nz = _mm_setzero_si128();
+    for (i = 0; i < n; i += 4) {
+      const __m128i r0 = _mm_loadu_si128((const __m128i *)(coeffs + j * n + i));
+      const __m128i r1 =
+          _mm_loadu_si128((const __m128i *)(coeffs + (j + 1) * n + i));
+      const __m128i p =
+          _mm_unpacklo_epi16(_mm_packs_epi32(r0, r0), _mm_packs_epi32(r1, r1));
+      _mm_storeu_si128((__m128i *)(pairs[j / 2] + 2 * i), p);
+      nz = _mm_or_si128(nz, p);
+    }
+    nonzero[j / 2] =
+        _mm_movemask_epi8(_mm_cmpeq_epi8(nz, _mm_setzero_si128())) != 0xFFFF;
+  }
+  for (k = 0; k < n; k++) {
+    adst2dct_vec acc[32 / ADST2DCT_LANES];
+    for (v = 0; v < vecs; v++) acc[v] = VEC_ZERO();
+    for (j = 0; j < n / 2; j++) {
+      adst2dct_vec b;
+      if (sparse && !nonzero[j]) continue;
+      b = VEC_SET1(mpairs[k * n / 2 + j]);
+      for (v = 0; v < vecs; v++) {
+        acc[v] = VEC_ADD(acc[v], VEC_MADD(b, VEC_LOAD(pairs[j] + 2
+                                                      * ADST2DCT_LANES * v)));
+      }
+    }
+    for (v = 0; v < vecs; v++) {
+      VEC_STORE(coeffs + k * n + ADST2DCT_LANES * v, VEC_ROUND(acc[v]));
+    }
+  }
+}
+
+static INLINE void ADST2DCT_NAME(adst2dct_matrix_impl)(int32_t *coeffs, int n,
+                                                       int tx_type,
+                                                       int sparse) {
+  const int s = adst2dct_matrix_size(n);
+  if (tx_type == ADST_DCT || tx_type == ADST_ADST) {
+    ADST2DCT_NAME(convert_cols)(coeffs, n, adst2dct_matrix_pairs[s], sparse);
+  }
+  if (tx_type == DCT_ADST || tx_type == ADST_ADST) {
+    ADST2DCT_NAME(convert_rows)(coeffs, n, adst2dct_matrix_t[s], sparse);
+  }
+}
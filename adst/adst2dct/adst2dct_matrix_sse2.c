@@ -0,0 +1,30 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#include <emmintrin.h>
+
+typedef __m128i adst2dct_vec;
+
+#define ADST2DCT_LANES (4)
+#define ADST2DCT_NAME(name) name##_sse2
+#define VEC_ZERO() _mm_setzero_si128()
+#define VEC_ADD(a, b) _mm_add_epi32(a, b)
+#define VEC_MADD(a, b) _mm_madd_epi16(a, b)
+#define VEC_SET1(v) _mm_set1_epi32(v)
+#define VEC_LOAD(p) _mm_loadu_si128((const __m128i *)(p))
+#define VEC_STORE(p, v) _mm_storeu_si128((__m128i *)(p), v)
+#define VEC_ROUND(v)                                                      \
+  _mm_srai_epi32(                                                         \
+      _mm_add_epi32(v, _mm_set1_epi32(1 << (ADST2DCT_MATRIX_BITS - 1))), \
+      ADST2DCT_MATRIX_BITS)
+
+#include "adst2dct_matrix_simd.h"
+
+void adst2dct_matrix_sse2(int32_t *coeffs, int n, int tx_type) {
+  adst2dct_matrix_impl_sse2(coeffs, n, tx_type, 0);
+}
+
+void adst2dct_matrix_sparse_sse2(int32_t *coeffs, int n, int tx_type) {
+  adst2dct_matrix_impl_sse2(coeffs, n, tx_type, 1);
+}
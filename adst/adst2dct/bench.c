@@ -0,0 +1,158 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "vidinput.h"
+
+#include "aom_dsp/aom_dsp_common.h"
+
+#include "adst2dct_2d.h"
+#include "adst2dct_matrix.h"
+
+#define MAX_BLOCKS (16384)
+#define RUNS (10)
+
+typedef void (*convert_func)(int32_t *coeffs, int n, int tx_type);
+
+/* Inverse transform to the residual, then forward DCT_DCT. */
+static void pixel_round_trip(int32_t *coeffs, int n, int tx_type) {
+  int16_t residual[32 * 32];
+  inv_txfm2d_new(coeffs, residual, n, tx_type);
+  fwd_txfm2d_new(residual, coeffs, n, DCT_DCT);
+}
+
+typedef struct {
+  const char *name;
+  convert_func convert;
+} method;
+
+static const method methods[] = {
+  { "pixel round trip", pixel_round_trip },
+  { "butterflies", adst2dct_2d },
+  { "matrix C", adst2dct_matrix_c },
+  { "matrix SSE2", adst2dct_matrix_sse2 },
+  { "matrix AVX2", adst2dct_matrix_avx2 },
+  { "sparse C", adst2dct_matrix_sparse_c },
+  { "sparse SSE2", adst2dct_matrix_sparse_sse2 },
+  { "sparse AVX2", adst2dct_matrix_sparse_avx2 },
+};
+
+#define NMETHODS ((int)(sizeof(methods) / sizeof(methods[0])))
+
+static int32_t adst[MAX_BLOCKS * 32 * 32];
+static int32_t ref[MAX_BLOCKS * 32 * 32];
+static int32_t out[NMETHODS][MAX_BLOCKS * 32 * 32];
+
+static double now() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Transforms the n x n blocks of the luma plane (minus the mean of the
+ * block) with tx_type and quantizes the coefficients with a dead zone of q.
+ * Returns the number of blocks. */
+static int load_blocks(const video_input_plane *plane, int n, int tx_type,
+                       int q) {
+  const int bw = plane->width / n;
+  const int num = AOMMIN(bw * (plane->height / n), MAX_BLOCKS);
+  int16_t residual[32 * 32];
+  int b;
+  int i;
+  for (b = 0; b < num; b++) {
+    const uint8_t *src =
+        plane->data + (b / bw) * n * plane->stride + (b % bw) * n;
+    int32_t *c = adst + b * n * n;
+    int sum = 0;
+    for (i = 0; i < n * n; i++) sum += src[(i / n) * plane->stride + i % n];
+    for (i = 0; i < n * n; i++) {
+      residual[i] = src[(i / n) * plane->stride + i % n] - sum / (n * n);
+    }
+    fwd_txfm2d_new(residual, c, n, tx_type);
+    for (i = 0; i < n * n; i++) c[i] = c[i] / q * q;
+  }
+  return num;
+}
+
+int main(int _argc, char **_argv) {
+  static const int tx_types[3] = { ADST_DCT, DCT_ADST, ADST_ADST };
+  static const char *const tx_names[4] = { "DCT_DCT", "ADST_DCT", "DCT_ADST",
+                                           "ADST_ADST" };
+  const char *path = _argc > 1 ? _argv[1] : "../../videos/owl.y4m";
+  const int q = _argc > 2 ? atoi(_argv[2]) : 32;
+  FILE *fin = fopen(path, "rb");
+  video_input vid;
+  video_input_info info;
+  video_input_ycbcr f;
+  int errors = 0;
+  int s;
+  int t;
+  int k;
+  if (!fin || video_input_open(&vid, fin)) {
+    fprintf(stderr, "usage: bench [video.y4m] [dead_zone]\n");
+    return 1;
+  }
+  video_input_get_info(&vid, &info);
+  if (info.depth != 8 || video_input_fetch_frame(&vid, f, NULL) != 1) {
+    fprintf(stderr, "Only 8 bit content is supported\n");
+    return 1;
+  }
+  adst2dct_matrix_init();
+  printf("| Size  | Type      | Zeros   | Method           | ns/block | "
+         "Max error | Mean error |\n");
+  printf("| ----- | --------- | ------- | ---------------- | -------- | "
+         "--------- | ---------- |\n");
+  for (s = 0; s < 4; s++) {
+    const int n = 4 << s;
+    const int n2 = n * n;
+    for (t = 0; t < 3; t++) {
+      const int tx_type = tx_types[t];
+      const int num = load_blocks(&f[0], n, tx_type, q);
+      int64_t zeros = 0;
+      int b;
+      int i;
+      for (i = 0; i < num * n2; i++) zeros += !adst[i];
+      memcpy(ref, adst, sizeof(*ref) * num * n2);
+      for (b = 0; b < num; b++) adst2dct_matrix_ref(ref + b * n2, n, tx_type);
+      for (k = 0; k < NMETHODS; k++) {
+        double time = 0;
+        int max_err = 0;
+        int64_t sum_err = 0;
+        int r;
+        for (r = 0; r < RUNS; r++) {
+          double t0;
+          memcpy(out[k], adst, sizeof(*adst) * num * n2);
+          t0 = now();
+          for (b = 0; b < num; b++) {
+            methods[k].convert(out[k] + b * n2, n, tx_type);
+          }
+          time += now() - t0;
+        }
+        for (i = 0; i < num * n2; i++) {
+          const int err = abs(out[k][i] - ref[i]);
+          max_err = AOMMAX(max_err, err);
+          sum_err += err;
+        }
+        printf("| %2dx%-2d | %-9s | %6.2f%% | %-16s | %8.1f | %9d | %10.3f |"
+               "\n", n, n, tx_names[tx_type], 100.0 * zeros / (num * n2),
+               methods[k].name, time * 1e9 / (RUNS * num), max_err,
+               (double)sum_err / (num * n2));
+      }
+      // The SIMD and sparse versions must be bit-exact with the C.
+      for (k = 3; k < NMETHODS; k++) {
+        if (memcmp(out[k], out[2], sizeof(*adst) * num * n2)) {
+          fprintf(stderr, "%s is not bit-exact with matrix C (%dx%d %s)\n",
+                  methods[k].name, n, n, tx_names[tx_type]);
+          errors++;
+        }
+      }
+    }
+  }
+  video_input_close(&vid);
+  return errors != 0;
+}
@@ -1,6 +1,21 @@
 #! /bin/bash
 set -e
 
-gcc -g adst2dct.c aom/aom_dsp/fwd_txfm.c aom/aom_dsp/inv_txfm.c -Iaom/ -Iaom/build/ -o adst2dct
+gcc -g main.c adst2dct.c adst2dct_2d.c aom/av1/common/av1_fwd_txfm1d.c aom/av1/common/av1_inv_txfm1d.c aom/aom_dsp/fwd_txfm.c aom/aom_dsp/inv_txfm.c -Iaom/ -Iaom/build/ -I. -o adst2dct
 
 ./adst2dct
+
+UTILS=../../utils
+gcc -O2 -g -msse2 -mavx2 bench.c adst2dct_2d.c adst2dct_matrix.c adst2dct_matrix_sse2.c adst2dct_matrix_avx2.c aom/av1/common/av1_fwd_txfm1d.c aom/av1/common/av1_inv_txfm1d.c $UTILS/vidinput.c $UTILS/y4m_input.c -Iaom/ -Iaom/build/ -I. -I$UTILS/ -lm -o bench
+
+./bench ../../videos/owl.y4m
+
+gcc -O2 -g -msse2 -mavx2 validate.c adst2dct.c adst2dct_2d.c adst2dct_matrix.c adst2dct_matrix_sse2.c adst2dct_matrix_avx2.c aom/av1/common/av1_fwd_txfm1d.c aom/av1/common/av1_inv_txfm1d.c -Iaom/ -Iaom/build/ -I. -lm -o validate
+
+# The exhaustive 4-point test takes about 16 minutes: ./build.sh exhaustive
+# runs it, otherwise it is skipped.
+if [ "$1" = "exhaustive" ]; then
+  ./validate
+else
+  ./validate quick
+fi
@@ -0,0 +1,91 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "aom_dsp/aom_dsp_common.h"
+#include "adst2dct.h"
+#include "adst2dct_2d.h"
+
+#define ROW_SIZE (4)
+
+// Utility functions for the experiment
+void rand_row(tran_low_t *const row) {
+  int i;
+  for (i = 0; i < ROW_SIZE; i++) {
+      row[i] = rand() % 256;
+  }
+}
+
+void print_row(const tran_low_t *const row, const char const* title) {
+  int i;
+  printf("%s:", title);
+  for (i = 0; i < ROW_SIZE; i++) {
+      printf(" %d", row[i]);
+  }
+  printf("\n");
+}
+
+// Converts random blocks of every type to DCT_DCT and compares the result
+// with the DCT_DCT of the same blocks.
+static void test_adst2dct_2d(int n, int tx_type, int blocks) {
+  static const char *const names[4] = { "DCT_DCT", "ADST_DCT", "DCT_ADST",
+                                        "ADST_ADST" };
+  int16_t block[32 * 32];
+  int32_t dct[32 * 32];
+  int32_t adst[32 * 32];
+  int max_err = 0;
+  int64_t sum_err = 0;
+  int b;
+  int i;
+  for (b = 0; b < blocks; b++) {
+    // Half of the blocks are noise, half are smooth gradients.
+    const int gx = rand() % 32 - 16;
+    const int gy = rand() % 32 - 16;
+    for (i = 0; i < n * n; i++) {
+      block[i] = b & 1 ? rand() % 511 - 255
+                       : clamp(gx * (i % n) + gy * (i / n) - 128 + rand() % 5,
+                               -255, 255);
+    }
+    fwd_txfm2d_new(block, dct, n, DCT_DCT);
+    fwd_txfm2d_new(block, adst, n, tx_type);
+    adst2dct_2d(adst, n, tx_type);
+    for (i = 0; i < n * n; i++) {
+      const int err = abs(adst[i] - dct[i]);
+      max_err = AOMMAX(max_err, err);
+      sum_err += err;
+    }
+  }
+  printf("ADST2DCT %2dx%-2d %-9s: max error %d, mean error %.3f\n", n, n,
+         names[tx_type], max_err, (double)sum_err / (blocks * n * n));
+}
+
+int main(int _argc,char **_argv) {
+
+  tran_low_t row[ROW_SIZE] = {0};
+  tran_low_t dct_row[ROW_SIZE] = {0};
+  tran_low_t adst_row[ROW_SIZE] = {0};
+  //tran_low_t iadst_row[ROW_SIZE] = {0};
+  tran_low_t adst2dct_row[ROW_SIZE] = {0};
+
+  rand_row(row);
+  print_row(row, "Random Pixel Values");
+
+  fadst4(row, adst_row);
+  print_row(adst_row, "ADST Values");
+
+  fdct4(row, dct_row);
+  print_row(dct_row, "DCT Values");
+
+  // Just for validation
+  //iadst4_c(adst_row, iadst_row);
+  //print_row(iadst_row, "iADST Values");
+
+  adst2dct(adst_row, adst2dct_row);
+  print_row(adst2dct_row, "ADST2DCT Values");
+
+  for (int n = 4; n <= 32; n <<= 1) {
+    test_adst2dct_2d(n, ADST_DCT, 1000);
+    test_adst2dct_2d(n, DCT_ADST, 1000);
+    test_adst2dct_2d(n, ADST_ADST, 1000);
+  }
+}
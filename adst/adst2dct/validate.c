@@ -0,0 +1,400 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "aom_dsp/aom_dsp_common.h"
+#include "av1/common/av1_fwd_txfm1d.h"
+#include "adst2dct.h"
+#include "adst2dct_2d.h"
+#include "adst2dct_matrix.h"
+
+/* Validation of the ADST to DCT conversions. Every 4-point row of 8 bit
+ * pixels is tested exhaustively, larger sizes are tested with random rows and
+ * blocks. The error is measured against the DCT in double precision (with
+ * the scale of the integer DCT). Each test has an error budget (the errors of
+ * the current implementation): a test that goes over its budget fails and
+ * validate exits with 1. */
+
+#define RANDOM_ROWS (1 << 20)
+#define RANDOM_BLOCKS (4096)
+
+typedef struct {
+  const char *name;
+  // Budget.
+  int max_err;
+  double mean_err;
+  // Results.
+  int err;
+  int64_t sum_err;
+  int64_t count;
+  int64_t exact;
+  // Set by test_exact(), the tests of test_add() have no exact count.
+  int has_exact;
+} TEST;
+
+enum {
+  // fadst4() -> adst2dct() vs the DCT.
+  TEST_ADST2DCT4,
+  // fadst4() -> adst2dct() vs fdct4().
+  TEST_ADST2DCT4_FDCT4,
+  // fadst4() -> iadst4_c() -> fdct4() vs the DCT.
+  TEST_IADST4_FDCT4,
+  // av1_fadstN_new() -> adst2dctN_new() vs the DCT.
+  TEST_ADST2DCT4_NEW,
+  TEST_ADST2DCT8_NEW,
+  TEST_ADST2DCT16_NEW,
+  TEST_ADST2DCT32_NEW,
+  // fwd_txfm2d_new() -> adst2dct_2d() vs the 2-D DCT.
+  TEST_2D_4,
+  TEST_2D_8,
+  TEST_2D_16,
+  TEST_2D_32,
+  // fwd_txfm2d_new() -> adst2dct_matrix_c() vs the 2-D DCT.
+  TEST_MATRIX_4,
+  TEST_MATRIX_8,
+  TEST_MATRIX_16,
+  TEST_MATRIX_32,
+  // The SIMD and sparse matrix versions vs adst2dct_matrix_c().
+  TEST_MATRIX_SIMD,
+  // Every matrix version vs sums on 64 bits, on the largest inputs.
+  TEST_MATRIX_WORST,
+  TESTS
+};
+
+static TEST tests[TESTS] = {
+  { "adst2dct 4 vs DCT", 2, 0.256 },
+  { "adst2dct 4 vs fdct4", 2, 0.254 },
+  { "iadst4 + fdct4 vs DCT", 3, 0.308 },
+  { "adst2dct4_new vs DCT", 3, 0.472 },
+  { "adst2dct8_new vs DCT", 4, 0.586 },
+  { "adst2dct16_new vs DCT", 6, 0.846 },
+  { "adst2dct32_new vs DCT", 8, 1.176 },
+  { "adst2dct_2d 4x4 vs DCT", 4, 0.689 },
+  { "adst2dct_2d 8x8 vs DCT", 6, 0.949 },
+  { "adst2dct_2d 16x16 vs DCT", 11, 1.186 },
+  { "adst2dct_2d 32x32 vs DCT", 16, 1.441 },
+  { "matrix 4x4 vs DCT", 4, 0.582 },
+  { "matrix 8x8 vs DCT", 6, 0.873 },
+  { "matrix 16x16 vs DCT", 9, 1.093 },
+  { "matrix 32x32 vs DCT", 16, 1.346 },
+  { "matrix SIMD vs C", 0, 0 },
+  { "matrix worst case", 0, 0 },
+};
+
+static INLINE void test_add(TEST *t, double ref, int32_t v) {
+  const int err = (int)fabs(v - ref + 0.5 * (v > ref) - 0.5 * (v < ref));
+  t->err = AOMMAX(t->err, err);
+  t->sum_err += err;
+  t->count++;
+}
+
+static INLINE void test_exact(TEST *t, int32_t ref, int32_t v) {
+  const int err = abs(v - ref);
+  t->err = AOMMAX(t->err, err);
+  t->sum_err += err;
+  t->exact += err == 0;
+  t->has_exact = 1;
+  t->count++;
+}
+
+static uint32_t validate_seed;
+
+/* A fixed LCG instead of rand(), so that the random tests (and their
+ * budgets) do not depend on the libc. Returns 15 bits. */
+static int validate_rand(void) {
+  validate_seed = validate_seed * 1103515245 + 12345;
+  return (validate_seed >> 16) & 0x7fff;
+}
+
+/* The (unnormalized) DCT of av1_fdctN_new() and of fdct4(). */
+static double dct_basis(int k, int x, int n) {
+  return cos(M_PI * (2 * x + 1) * k / (2.0 * n)) * (k ? 1 : M_SQRT1_2);
+}
+
+/* Every row of 4 pixels: 2^32 rows. The DCT is linear, so it is the sum of
+ * the contributions of each pixel (basis[x][v][k]). */
+static void validate_4_exhaustive(void) {
+  static const int8_t cos_bit[12] = { 13, 13, 13, 13, 13, 13,
+                                      13, 13, 13, 13, 13, 13 };
+  static const int8_t stage_range[12] = { 32, 32, 32, 32, 32, 32,
+                                          32, 32, 32, 32, 32, 32 };
+  static double basis[4][256][4];
+  int x;
+  int v;
+  int k;
+  int x0;
+  int x1;
+  int x2;
+  int x3;
+  for (x = 0; x < 4; x++) {
+    for (v = 0; v < 256; v++) {
+      for (k = 0; k < 4; k++) basis[x][v][k] = v * dct_basis(k, x, 4);
+    }
+  }
+  for (x0 = 0; x0 < 256; x0++) {
+    for (x1 = 0; x1 < 256; x1++) {
+      for (x2 = 0; x2 < 256; x2++) {
+        double d012[4];
+        for (k = 0; k < 4; k++) {
+          d012[k] = basis[0][x0][k] + basis[1][x1][k] + basis[2][x2][k];
+        }
+        for (x3 = 0; x3 < 256; x3++) {
+          const tran_low_t row[4] = { x0, x1, x2, x3 };
+          const int32_t row32[4] = { x0, x1, x2, x3 };
+          tran_low_t adst[4];
+          tran_low_t dct[4];
+          tran_low_t conv[4];
+          tran_low_t pixels[4];
+          tran_low_t round_trip[4];
+          int32_t adst32[4];
+          int32_t conv32[4];
+          fadst4(row, adst);
+          fdct4(row, dct);
+          adst2dct(adst, conv);
+          iadst4_c(adst, pixels);
+          fdct4(pixels, round_trip);
+          av1_fadst4_new(row32, adst32, cos_bit, stage_range);
+          adst2dct4_new(adst32, conv32);
+          for (k = 0; k < 4; k++) {
+            const double ref = d012[k] + basis[3][x3][k];
+            test_add(&tests[TEST_ADST2DCT4], ref, conv[k]);
+            test_exact(&tests[TEST_ADST2DCT4_FDCT4], dct[k], conv[k]);
+            test_add(&tests[TEST_IADST4_FDCT4], ref, round_trip[k]);
+            test_add(&tests[TEST_ADST2DCT4_NEW], ref, conv32[k]);
+          }
+        }
+      }
+    }
+  }
+}
+
+/* Random rows of 8 bit residuals. */
+static void validate_new_random(int n, TEST *t) {
+  static const int8_t cos_bit[12] = { 13, 13, 13, 13, 13, 13,
+                                      13, 13, 13, 13, 13, 13 };
+  static const int8_t stage_range[12] = { 32, 32, 32, 32, 32, 32,
+                                          32, 32, 32, 32, 32, 32 };
+  const TxfmFunc fadst = n == 8 ? av1_fadst8_new : n == 16 ? av1_fadst16_new
+                                                           : av1_fadst32_new;
+  void (*const convert)(const int32_t *, int32_t *) =
+      n == 8 ? adst2dct8_new : n == 16 ? adst2dct16_new : adst2dct32_new;
+  int32_t row[32];
+  int32_t adst[32];
+  int32_t conv[32];
+  int r;
+  int x;
+  int k;
+  for (r = 0; r < RANDOM_ROWS; r++) {
+    for (x = 0; x < n; x++) row[x] = validate_rand() % 511 - 255;
+    fadst(row, adst, cos_bit, stage_range);
+    convert(adst, conv);
+    for (k = 0; k < n; k++) {
+      double ref = 0;
+      for (x = 0; x < n; x++) ref += row[x] * dct_basis(k, x, n);
+      test_add(t, ref, conv[k]);
+    }
+  }
+}
+
+/* Random blocks of 8 bit residuals (noise, gradients and extreme values) of
+ * every ADST type. The 2-D DCT has the scale of fwd_txfm2d_new(): 8 times the
+ * orthonormal DCT, 4 times for 32x32. */
+static void validate_2d_random(int n, TEST *t2d, TEST *tmatrix) {
+  static const int tx_types[3] = { ADST_DCT, DCT_ADST, ADST_ADST };
+  static void (*const simd[5])(int32_t *, int, int) = {
+    adst2dct_matrix_sse2, adst2dct_matrix_avx2, adst2dct_matrix_sparse_c,
+    adst2dct_matrix_sparse_sse2, adst2dct_matrix_sparse_avx2
+  };
+  const double scale = (n == 32 ? 4.0 : 8.0) * 2 / n;
+  int16_t block[32 * 32];
+  int32_t adst[32 * 32];
+  int32_t conv[32 * 32];
+  int32_t matrix[32 * 32];
+  int32_t other[32 * 32];
+  double tmp[32 * 32];
+  double ref[32 * 32];
+  int b;
+  int i;
+  int j;
+  int k;
+  for (b = 0; b < RANDOM_BLOCKS; b++) {
+    const int tx_type = tx_types[b % 3];
+    const int gx = validate_rand() % 32 - 16;
+    const int gy = validate_rand() % 32 - 16;
+    for (i = 0; i < n * n; i++) {
+      switch (b / 3 % 3) {
+        case 0: block[i] = validate_rand() % 511 - 255; break;
+        case 1:
+          block[i] = clamp(
+              gx * (i % n) + gy * (i / n) - 128 + validate_rand() % 5, -255,
+              255);
+          break;
+        default: block[i] = validate_rand() & 1 ? 255 : -255; break;
+      }
+    }
+    for (i = 0; i < n; i++) {
+      for (k = 0; k < n; k++) {
+        tmp[i * n + k] = 0;
+        for (j = 0; j < n; j++) {
+          tmp[i * n + k] += block[i * n + j] * dct_basis(k, j, n);
+        }
+      }
+    }
+    for (k = 0; k < n; k++) {
+      for (j = 0; j < n; j++) {
+        ref[k * n + j] = 0;
+        for (i = 0; i < n; i++) {
+          ref[k * n + j] += tmp[i * n + j] * dct_basis(k, i, n);
+        }
+        ref[k * n + j] *= scale;
+      }
+    }
+    fwd_txfm2d_new(block, adst, n, tx_type);
+    memcpy(conv, adst, sizeof(adst));
+    adst2dct_2d(conv, n, tx_type);
+    memcpy(matrix, adst, sizeof(adst));
+    adst2dct_matrix_c(matrix, n, tx_type);
+    for (i = 0; i < n * n; i++) {
+      test_add(t2d, ref[i], conv[i]);
+      test_add(tmatrix, ref[i], matrix[i]);
+    }
+    for (k = 0; k < 5; k++) {
+      memcpy(other, adst, sizeof(adst));
+      simd[k](other, n, tx_type);
+      for (i = 0; i < n * n; i++) {
+        test_exact(&tests[TEST_MATRIX_SIMD], matrix[i], other[i]);
+      }
+    }
+  }
+}
+
+/* adst2dct_matrix_c() with sums on 64 bits, which cannot overflow. */
+static void matrix_int64(int32_t *coeffs, int n, int tx_type) {
+  const int16_t *m = adst2dct_matrix[adst2dct_matrix_size(n)];
+  const int64_t round = 1 << (ADST2DCT_MATRIX_BITS - 1);
+  int16_t in[32 * 32];
+  int i;
+  int j;
+  int k;
+  if (tx_type == ADST_DCT || tx_type == ADST_ADST) {
+    for (i = 0; i < n * n; i++) in[i] = adst2dct_sat16(coeffs[i]);
+    for (k = 0; k < n; k++) {
+      for (i = 0; i < n; i++) {
+        int64_t acc = round;
+        for (j = 0; j < n; j++) acc += (int64_t)m[k * n + j] * in[j * n + i];
+        coeffs[k * n + i] = (int32_t)(acc >> ADST2DCT_MATRIX_BITS);
+      }
+    }
+  }
+  if (tx_type == DCT_ADST || tx_type == ADST_ADST) {
+    for (i = 0; i < n * n; i++) in[i] = adst2dct_sat16(coeffs[i]);
+    for (i = 0; i < n; i++) {
+      for (k = 0; k < n; k++) {
+        int64_t acc = round;
+        for (j = 0; j < n; j++) acc += (int64_t)m[k * n + j] * in[i * n + j];
+        coeffs[i * n + k] = (int32_t)(acc >> ADST2DCT_MATRIX_BITS);
+      }
+    }
+  }
+}
+
+/* The coefficients that make the sums of 32 bits of the matrix versions the
+ * largest: the signs of a row of M, times 32767, 32768 (saturated to 32767
+ * for the positive signs, -32768 for the negative ones) or 2^24 (saturated on
+ * entry). Column i (ADST_DCT and ADST_ADST) or row i (DCT_ADST) of the block
+ * gets the signs of M[(i + k0) % n], so every output of the first pass is a
+ * largest sum. The first pass of ADST_ADST also saturates the inputs of the
+ * second. */
+static void validate_matrix_worst(int n) {
+  static const int tx_types[3] = { ADST_DCT, DCT_ADST, ADST_ADST };
+  static const int32_t amplitudes[3] = { 32767, 32768, 1 << 24 };
+  static void (*const versions[6])(int32_t *, int, int) = {
+    adst2dct_matrix_c, adst2dct_matrix_sse2, adst2dct_matrix_avx2,
+    adst2dct_matrix_sparse_c, adst2dct_matrix_sparse_sse2,
+    adst2dct_matrix_sparse_avx2
+  };
+  const int16_t *m = adst2dct_matrix[adst2dct_matrix_size(n)];
+  int32_t block[32 * 32];
+  int32_t ref[32 * 32];
+  int32_t out[32 * 32];
+  int t;
+  int a;
+  int sign;
+  int k0;
+  int i;
+  int j;
+  int v;
+  for (t = 0; t < 3; t++) {
+    for (a = 0; a < 3; a++) {
+      for (sign = -1; sign <= 1; sign += 2) {
+        for (k0 = 0; k0 < n; k0++) {
+          for (i = 0; i < n; i++) {
+            for (j = 0; j < n; j++) {
+              const int32_t c = m[(i + k0) % n * n + j] < 0
+                                    ? -sign * amplitudes[a]
+                                    : sign * amplitudes[a];
+              if (tx_types[t] == DCT_ADST) {
+                block[i * n + j] = c;
+              } else {
+                block[j * n + i] = c;
+              }
+            }
+          }
+          memcpy(ref, block, sizeof(block));
+          matrix_int64(ref, n, tx_types[t]);
+          for (v = 0; v < 6; v++) {
+            memcpy(out, block, sizeof(block));
+            versions[v](out, n, tx_types[t]);
+            for (i = 0; i < n * n; i++) {
+              test_exact(&tests[TEST_MATRIX_WORST], ref[i], out[i]);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+int main(int _argc, char **_argv) {
+  int failures = 0;
+  int i;
+  // validate quick skips the exhaustive 4-point test.
+  const int quick = _argc > 1 && !strcmp(_argv[1], "quick");
+  validate_seed = 0;
+  adst2dct_matrix_init();
+  if (!quick) validate_4_exhaustive();
+  validate_new_random(8, &tests[TEST_ADST2DCT8_NEW]);
+  validate_new_random(16, &tests[TEST_ADST2DCT16_NEW]);
+  validate_new_random(32, &tests[TEST_ADST2DCT32_NEW]);
+  for (i = 0; i < 4; i++) {
+    validate_2d_random(4 << i, &tests[TEST_2D_4 + i],
+                       &tests[TEST_MATRIX_4 + i]);
+    validate_matrix_worst(4 << i);
+  }
+  printf("| Test                     | Values      | Max error | Mean error "
+         "| Exact   | Budget        | Result |\n");
+  printf("| ------------------------ | ----------- | --------- | ---------- "
+         "| ------- | ------------- | ------ |\n");
+  for (i = 0; i < TESTS; i++) {
+    const TEST *t = &tests[i];
+    const double mean = t->count ? (double)t->sum_err / t->count : 0;
+    const int fail = t->err > t->max_err || mean > t->mean_err;
+    char exact[16];
+    if (!t->count) continue;
+    if (t->has_exact) {
+      snprintf(exact, sizeof(exact), "%6.2f%%", 100.0 * t->exact / t->count);
+    } else {
+      snprintf(exact, sizeof(exact), "n/a");
+    }
+    printf("| %-24s | %11ld | %9d | %10.4f | %-7s | %3d / %7.4f | %-6s |\n",
+           t->name, (long)t->count, t->err, mean, exact, t->max_err,
+           t->mean_err, fail ? "FAIL" : "ok");
+    failures += fail;
+  }
+  return failures != 0;
+}
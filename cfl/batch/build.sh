@@ -0,0 +1,21 @@
+#! /bin/bash
+set -e
+
+UTILS=../../utils
+VIDEOS=../../videos
+AOM=../../tf/adst
+
+SRC="cfl_batch.c $AOM/av1/common/cfl.c $AOM/av1/common/x86/cfl_sse2.c $AOM/av1/common/av1_fwd_txfm2d.c $AOM/av1/common/av1_fwd_txfm1d.c $AOM/av1/common/av1_inv_txfm2d.c $AOM/av1/common/av1_inv_txfm1d.c $AOM/av1/common/av1_txfm.c $AOM/av1/common/x86/av1_txfm_sse2.c $UTILS/vidinput.c $UTILS/y4m_input.c"
+
+gcc -O2 -msse2 -pthread $SRC -I$UTILS/ -I$AOM/ -I../../ -lm -o cfl_batch
+# 32 bit coefficients for 10 and 12 bit content
+gcc -O2 -msse2 -pthread -DCONFIG_AOM_HIGHBITDEPTH=1 $SRC -I$UTILS/ -I$AOM/ -I../../ -lm -o cfl_batch_hbd
+
+./cfl_batch $VIDEOS/owl.y4m 4 4 > cfl_4_4.csv
+./cfl_batch $VIDEOS/owl.y4m 4 8 > cfl_4_8.csv
+./cfl_batch $VIDEOS/owl.y4m 8 8 > cfl_8_8.csv
+./cfl_batch $VIDEOS/owl.y4m 8 16 > cfl_8_16.csv
+./cfl_batch $VIDEOS/owl.y4m 16 16 > cfl_16_16.csv
+./cfl_batch $VIDEOS/owl.y4m 16 32 > cfl_16_32.csv
+./cfl_batch $VIDEOS/owl.y4m 32 32 > cfl_32_32.csv
+./cfl_batch $VIDEOS/owl.y4m 32 64 > cfl_32_64.csv
@@ -0,0 +1,468 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "vidinput.h"
+#include "av1/common/cfl.h"
+
+#define LUMA_PLANE (0)
+#define NUM_PLANES (3)
+#define MAX_THREADS (64)
+
+/* Prototypes of the AV1 transform functions */
+void av1_fwd_txfm2d_4x4_c(const int16_t *input, int32_t *output, int stride,
+    int tx_type, int bd);
+
+void av1_fwd_txfm2d_8x8_c(const int16_t *input, int32_t *output, int stride,
+    int tx_type, int bd);
+
+void av1_fwd_txfm2d_16x16_c(const int16_t *input, int32_t *output, int stride,
+    int tx_type, int bd);
+
+void av1_fwd_txfm2d_32x32_c(const int16_t *input, int32_t *output, int stride,
+    int tx_type, int bd);
+
+#if CONFIG_TX64X64
+void av1_fwd_txfm2d_64x64_c(const int16_t *input, int32_t *output, int stride,
+    int tx_type, int bd);
+
+#endif
+void av1_inv_txfm2d_add_4x4_c(const int32_t *input, uint16_t *output,
+    int stride, int tx_type, int bd);
+
+void av1_inv_txfm2d_add_8x8_c(const int32_t *input, uint16_t *output,
+    int stride, int tx_type, int bd);
+
+void av1_inv_txfm2d_add_16x16_c(const int32_t *input, uint16_t *output,
+    int stride, int tx_type, int bd);
+
+void av1_inv_txfm2d_add_32x32_c(const int32_t *input, uint16_t *output,
+    int stride, int tx_type, int bd);
+
+#if CONFIG_TX64X64
+void av1_inv_txfm2d_add_64x64_c(const int32_t *input, uint16_t *output,
+    int stride, int tx_type, int bd);
+#endif
+
+typedef void (*fwd_txfm_func)(const int16_t *input, int32_t *output,
+    int stride, int tx_type, int bd);
+typedef void (*inv_txfm_func)(const int32_t *input, uint16_t *output,
+    int stride, int tx_type, int bd);
+
+// Statistics of the CfL and DC_PRED predictions of one chroma block
+typedef struct block_stats {
+  int plane;
+  int x;
+  int y;
+  int dc_pred;
+  double alpha;
+  int64_t sse_dc;
+  int64_t sse_cfl;
+} BLOCK_STATS;
+
+// Experiment parameters shared by all threads
+typedef struct batch_config {
+  int y_tx_size;
+  int uv_tx_size;
+  int width;
+  int height;
+  int ss_x;
+  int ss_y;
+  int bd;
+  fwd_txfm_func y_fwd;
+  fwd_txfm_func uv_fwd;
+  inv_txfm_func uv_inv;
+} BATCH_CONFIG;
+
+// One frame processed by one thread
+typedef struct frame_job {
+  const BATCH_CONFIG *config;
+  int frame_number;
+  int plane_w[NUM_PLANES];
+  int plane_h[NUM_PLANES];
+  uint16_t *planes[NUM_PLANES];
+  CFL_CONTEXT *cfl;
+  BLOCK_STATS *stats;
+  int num_stats;
+} FRAME_JOB;
+
+static fwd_txfm_func get_fwd_txfm(int tx_size) {
+  switch (tx_size) {
+    case 4: return &av1_fwd_txfm2d_4x4_c;
+    case 8: return &av1_fwd_txfm2d_8x8_c;
+    case 16: return &av1_fwd_txfm2d_16x16_c;
+    case 32: return &av1_fwd_txfm2d_32x32_c;
+#if CONFIG_TX64X64
+    case 64: return &av1_fwd_txfm2d_64x64_c;
+#endif
+    default: return NULL;
+  }
+}
+
+static inv_txfm_func get_inv_txfm(int tx_size) {
+  switch (tx_size) {
+    case 4: return &av1_inv_txfm2d_add_4x4_c;
+    case 8: return &av1_inv_txfm2d_add_8x8_c;
+    case 16: return &av1_inv_txfm2d_add_16x16_c;
+    case 32: return &av1_inv_txfm2d_add_32x32_c;
+#if CONFIG_TX64X64
+    case 64: return &av1_inv_txfm2d_add_64x64_c;
+#endif
+    default: return NULL;
+  }
+}
+
+// Copy a tx_size x tx_size block, replicating the frame edges.
+static void copy_block(int16_t *const dst, const uint16_t *const plane,
+    int plane_w, int plane_h, int x, int y, int tx_size) {
+  int bx, by;
+  for (by = 0; by < tx_size; by++) {
+    const int fy = (y + by < plane_h) ? y + by : plane_h - 1;
+    for (bx = 0; bx < tx_size; bx++) {
+      const int fx = (x + bx < plane_w) ? x + bx : plane_w - 1;
+      dst[by * tx_size + bx] = plane[fy * plane_w + fx];
+    }
+  }
+}
+
+// DC_PRED computed over the original (not reconstructed) neighboring pixels,
+// as in cfl_dcpred_int.m.
+static int dc_pred(const uint16_t *const plane, int plane_w, int plane_h,
+    int x, int y, int tx_size, int bd) {
+  int i, count = 0, sum = 0;
+  if (y > 0) {
+    for (i = 0; i < tx_size && x + i < plane_w; i++, count++)
+      sum += plane[(y - 1) * plane_w + x + i];
+  }
+  if (x > 0) {
+    for (i = 0; i < tx_size && y + i < plane_h; i++, count++)
+      sum += plane[(y + i) * plane_w + x - 1];
+  }
+  if (count == 0) return 1 << (bd - 1);
+  return (sum + (count >> 1)) / count;
+}
+
+static void store_luma(FRAME_JOB *const job, int sb_x, int sb_y) {
+  const BATCH_CONFIG *const config = job->config;
+  const int y_tx_size = config->y_tx_size;
+  int16_t block[MAX_TX_SQUARE];
+  int32_t coeff[MAX_TX_SQUARE];
+  tran_low_t dqcoeff[MAX_TX_SQUARE];
+  int bx, by, i;
+
+  for (by = 0; by < MAX_SB_SIZE; by += y_tx_size) {
+    if (sb_y + by >= job->plane_h[LUMA_PLANE]) break;
+    for (bx = 0; bx < MAX_SB_SIZE; bx += y_tx_size) {
+      if (sb_x + bx >= job->plane_w[LUMA_PLANE]) break;
+      copy_block(block, job->planes[LUMA_PLANE], job->plane_w[LUMA_PLANE],
+          job->plane_h[LUMA_PLANE], sb_x + bx, sb_y + by, y_tx_size);
+      config->y_fwd(block, coeff, y_tx_size, DCT_DCT, config->bd);
+      for (i = 0; i < y_tx_size * y_tx_size; i++) {
+#if CONFIG_AOM_HIGHBITDEPTH
+        dqcoeff[i] = coeff[i];
+#else
+        dqcoeff[i] = clamp(coeff[i], INT16_MIN, INT16_MAX);
+#endif
+      }
+      // The luma AC is always "coded" (unquantized) in this experiment.
+      cfl_store_predictor(job->cfl, by >> 2, bx >> 2, y_tx_size, dqcoeff,
+          dqcoeff, 3);
+    }
+  }
+}
+
+static void predict_chroma(FRAME_JOB *const job, int plane, int x, int y,
+    int blk_row, int blk_col, BLOCK_STATS *const stats) {
+  const BATCH_CONFIG *const config = job->config;
+  const int uv_tx_size = config->uv_tx_size;
+  const int uv_tx_square = uv_tx_size * uv_tx_size;
+  const int plane_w = job->plane_w[plane];
+  const int plane_h = job->plane_h[plane];
+  int16_t block[MAX_TX_SQUARE];
+  int32_t coeff[MAX_TX_SQUARE];
+  tran_low_t pred_coeff[MAX_TX_SQUARE];
+  int32_t cfl_coeff[MAX_TX_SQUARE];
+  uint16_t cfl_pixels[MAX_TX_SQUARE];
+  double sum_lc = 0, sum_ll = 0;
+  int bx, by, i;
+
+  copy_block(block, job->planes[plane], plane_w, plane_h, x, y, uv_tx_size);
+  config->uv_fwd(block, coeff, uv_tx_size, DCT_DCT, config->bd);
+
+  // The DC is not predicted by CfL, only the AC.
+  pred_coeff[0] = 0;
+  cfl_load_predictor(job->cfl, blk_row, blk_col, pred_coeff, uv_tx_size);
+
+  // Least squares alpha over the AC coefficients. Because of Parseval, this is
+  // the alpha of cfl_dcpred_int.m (L and C are zero mean).
+  for (i = 1; i < uv_tx_square; i++) {
+    sum_lc += (double)coeff[i] * pred_coeff[i];
+    sum_ll += (double)pred_coeff[i] * pred_coeff[i];
+  }
+  stats->alpha = (sum_ll != 0) ? sum_lc / sum_ll : 0;
+  stats->dc_pred = dc_pred(job->planes[plane], plane_w, plane_h, x, y,
+      uv_tx_size, config->bd);
+
+  cfl_coeff[0] = 0;
+  for (i = 1; i < uv_tx_square; i++) {
+    cfl_coeff[i] = (int32_t)lround(stats->alpha * pred_coeff[i]);
+  }
+  for (i = 0; i < uv_tx_square; i++) {
+    cfl_pixels[i] = stats->dc_pred;
+  }
+  config->uv_inv(cfl_coeff, cfl_pixels, uv_tx_size, DCT_DCT, config->bd);
+
+  stats->plane = plane;
+  stats->x = x;
+  stats->y = y;
+  stats->sse_dc = 0;
+  stats->sse_cfl = 0;
+  for (by = 0; by < uv_tx_size && y + by < plane_h; by++) {
+    for (bx = 0; bx < uv_tx_size && x + bx < plane_w; bx++) {
+      const int pix = block[by * uv_tx_size + bx];
+      const int err_dc = pix - stats->dc_pred;
+      const int err_cfl = pix - cfl_pixels[by * uv_tx_size + bx];
+      stats->sse_dc += err_dc * err_dc;
+      stats->sse_cfl += err_cfl * err_cfl;
+    }
+  }
+}
+
+static void *process_frame(void *arg) {
+  FRAME_JOB *const job = (FRAME_JOB *)arg;
+  const BATCH_CONFIG *const config = job->config;
+  const int uv_tx_size = config->uv_tx_size;
+  const int uv_sb_w = MAX_SB_SIZE >> config->ss_x;
+  const int uv_sb_h = MAX_SB_SIZE >> config->ss_y;
+  int sb_x, sb_y, cx, cy, plane;
+
+  job->num_stats = 0;
+#if CONFIG_CFL_STATS
+  cfl_stats_reset(&job->cfl->stats);
+#endif
+  for (sb_y = 0; sb_y < job->plane_h[LUMA_PLANE]; sb_y += MAX_SB_SIZE) {
+    for (sb_x = 0; sb_x < job->plane_w[LUMA_PLANE]; sb_x += MAX_SB_SIZE) {
+      const int uv_x = sb_x >> config->ss_x;
+      const int uv_y = sb_y >> config->ss_y;
+
+      // The superblock is the partition: all of its luma is stored before
+      // predicting its chroma.
+      store_luma(job, sb_x, sb_y);
+
+      for (plane = 1; plane < NUM_PLANES; plane++) {
+        for (cy = 0; cy < uv_sb_h && uv_y + cy < job->plane_h[plane];
+            cy += uv_tx_size) {
+          for (cx = 0; cx < uv_sb_w && uv_x + cx < job->plane_w[plane];
+              cx += uv_tx_size) {
+            predict_chroma(job, plane, uv_x + cx, uv_y + cy, cy >> 2, cx >> 2,
+                &job->stats[job->num_stats++]);
+          }
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
+static void copy_frame(FRAME_JOB *const job, video_input_ycbcr ycbcr,
+    int bytes_per_sample) {
+  int plane, i;
+  for (plane = 0; plane < NUM_PLANES; plane++) {
+    const int samples = ycbcr[plane].width * ycbcr[plane].height;
+    job->plane_w[plane] = ycbcr[plane].width;
+    job->plane_h[plane] = ycbcr[plane].height;
+    if (bytes_per_sample == 1) {
+      for (i = 0; i < samples; i++)
+        job->planes[plane][i] = ycbcr[plane].data[i];
+    } else {
+      memcpy(job->planes[plane], ycbcr[plane].data, samples * sizeof(uint16_t));
+    }
+  }
+}
+
+static double psnr(int64_t sse, int64_t num_pixels, int bd) {
+  const double peak = (1 << bd) - 1;
+  if (sse == 0) return 99.0;
+  return 10 * log10(peak * peak * num_pixels / sse);
+}
+
+int main(int _argc, char **_argv) {
+  int i, t, plane;
+
+  if (_argc < 4 || _argc > 5) {
+    fprintf(stderr, "Invalid number of arguments!\n");
+    fprintf(stderr,
+        "usage: video.y4m uv_blocksize luma_blocksize [threads] > stats.csv\n");
+    return -1;
+  }
+
+  FILE *fin = fopen(_argv[1], "rb");
+  video_input vid;
+  video_input_info info;
+  if (video_input_open(&vid, fin)) {
+    fprintf(stderr, "Could not open %s\n", _argv[1]);
+    return -1;
+  }
+  video_input_get_info(&vid, &info);
+
+  BATCH_CONFIG config;
+  config.uv_tx_size = atoi(_argv[2]);
+  config.y_tx_size = atoi(_argv[3]);
+  config.width = info.pic_w;
+  config.height = info.pic_h;
+  config.ss_x = vid.y4m.ss_x;
+  config.ss_y = vid.y4m.ss_y;
+  config.bd = info.depth;
+  config.y_fwd = get_fwd_txfm(config.y_tx_size);
+  config.uv_fwd = get_fwd_txfm(config.uv_tx_size);
+  config.uv_inv = get_inv_txfm(config.uv_tx_size);
+  const int num_threads = (_argc == 5) ? atoi(_argv[4]) : 1;
+
+  if (!config.y_fwd || !config.uv_fwd) {
+    fprintf(stderr, "Invalid block size\n");
+#if CONFIG_TX64X64
+    fprintf(stderr, "Values are: 4, 8, 16, 32, 64\n");
+#else
+    fprintf(stderr, "Values are: 4, 8, 16, 32\n");
+#endif
+    return -1;
+  }
+  if (info.pixel_fmt == PF_RSVD) {
+    fprintf(stderr, "Unsupported chroma format\n");
+    return -1;
+  }
+  // The luma region collocated with a chroma block must fit in a superblock
+  // (64x64 chroma blocks are 4:4:4 only).
+  if ((config.uv_tx_size << config.ss_x) > MAX_SB_SIZE
+      || (config.uv_tx_size << config.ss_y) > MAX_SB_SIZE) {
+    fprintf(stderr, "Chroma block size %d is too big for the chroma format\n",
+        config.uv_tx_size);
+    return -1;
+  }
+#if CONFIG_AOM_HIGHBITDEPTH
+  if (config.bd > 12) {
+    fprintf(stderr, "Only 8, 10 and 12 bit content is supported\n");
+    return -1;
+  }
+#else
+  // 16 bit coefficients would saturate on high bitdepth content.
+  if (config.bd != 8) {
+    fprintf(stderr, "High bitdepth content requires cfl_batch_hbd\n");
+    return -1;
+  }
+#endif
+  if (num_threads < 1 || num_threads > MAX_THREADS) {
+    fprintf(stderr, "Number of threads must be between 1 and %d\n",
+        MAX_THREADS);
+    return -1;
+  }
+
+  const int uv_w = (info.pic_w + config.ss_x) >> config.ss_x;
+  const int uv_h = (info.pic_h + config.ss_y) >> config.ss_y;
+  const int max_stats = 2 * ((uv_w + config.uv_tx_size - 1) / config.uv_tx_size)
+      * ((uv_h + config.uv_tx_size - 1) / config.uv_tx_size);
+
+  FRAME_JOB jobs[MAX_THREADS];
+  pthread_t threads[MAX_THREADS];
+  for (t = 0; t < num_threads; t++) {
+    jobs[t].config = &config;
+    jobs[t].planes[0] = (uint16_t*) malloc(sizeof(uint16_t)
+        * info.pic_w * info.pic_h);
+    jobs[t].planes[1] = (uint16_t*) malloc(sizeof(uint16_t) * uv_w * uv_h);
+    jobs[t].planes[2] = (uint16_t*) malloc(sizeof(uint16_t) * uv_w * uv_h);
+    jobs[t].cfl = (CFL_CONTEXT*) malloc(sizeof(CFL_CONTEXT));
+    cfl_init(jobs[t].cfl, config.ss_x, config.ss_y);
+    jobs[t].stats = (BLOCK_STATS*) malloc(sizeof(BLOCK_STATS) * max_stats);
+  }
+
+  int64_t sse_dc[NUM_PLANES] = {0};
+  int64_t sse_cfl[NUM_PLANES] = {0};
+  int64_t cfl_wins = 0;
+  int64_t num_blocks = 0;
+  int num_frames = 0;
+  int done = 0;
+#if CONFIG_CFL_STATS
+  CFL_STATS cfl_stats_total;
+  cfl_stats_reset(&cfl_stats_total);
+#endif
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  printf("frame,plane,x,y,size,dc_pred,alpha,sse_dc,sse_cfl\n");
+  while (!done) {
+    video_input_ycbcr f;
+    int batch = 0;
+
+    // Frames are read sequentially and processed in parallel.
+    while (batch < num_threads) {
+      if (video_input_fetch_frame(&vid, f, NULL) != 1) {
+        done = 1;
+        break;
+      }
+      jobs[batch].frame_number = num_frames++;
+      copy_frame(&jobs[batch], f, vid.y4m.bytes_per_sample);
+      batch++;
+    }
+
+    for (t = 0; t < batch; t++) {
+      pthread_create(&threads[t], NULL, process_frame, &jobs[t]);
+    }
+
+    // Stats are written in frame order.
+    for (t = 0; t < batch; t++) {
+      pthread_join(threads[t], NULL);
+      for (i = 0; i < jobs[t].num_stats; i++) {
+        const BLOCK_STATS *const s = &jobs[t].stats[i];
+        printf("%d,%d,%d,%d,%d,%d,%f,%ld,%ld\n", jobs[t].frame_number,
+            s->plane, s->x, s->y, config.uv_tx_size, s->dc_pred, s->alpha,
+            (long)s->sse_dc, (long)s->sse_cfl);
+        sse_dc[s->plane] += s->sse_dc;
+        sse_cfl[s->plane] += s->sse_cfl;
+        cfl_wins += s->sse_cfl < s->sse_dc;
+      }
+      num_blocks += jobs[t].num_stats;
+#if CONFIG_CFL_STATS
+      {
+        char label[32];
+        snprintf(label, sizeof(label), "Frame %d", jobs[t].frame_number);
+        cfl_stats_dump(stderr, &jobs[t].cfl->stats, label);
+        cfl_stats_add(&cfl_stats_total, &jobs[t].cfl->stats);
+      }
+#endif
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  const double elapsed = (end.tv_sec - start.tv_sec)
+      + (end.tv_nsec - start.tv_nsec) * 1e-9;
+
+  fprintf(stderr, "%d frames, %ld chroma blocks in %.3f seconds\n", num_frames,
+      (long)num_blocks, elapsed);
+  for (plane = 1; plane < NUM_PLANES; plane++) {
+    const int64_t num_pixels = (int64_t)uv_w * uv_h * num_frames;
+    fprintf(stderr, "Plane %d PSNR: DC_PRED %.2f dB, CfL %.2f dB\n", plane,
+        psnr(sse_dc[plane], num_pixels, config.bd),
+        psnr(sse_cfl[plane], num_pixels, config.bd));
+  }
+  fprintf(stderr, "CfL beats DC_PRED on %.2f%% of the blocks\n",
+      num_blocks ? 100.0 * cfl_wins / num_blocks : 0);
+#if CONFIG_CFL_STATS
+  cfl_stats_dump(stderr, &cfl_stats_total, "All frames");
+#endif
+
+  for (t = 0; t < num_threads; t++) {
+    free(jobs[t].planes[0]);
+    free(jobs[t].planes[1]);
+    free(jobs[t].planes[2]);
+    free(jobs[t].cfl);
+    free(jobs[t].stats);
+  }
+  video_input_close(&vid);
+}
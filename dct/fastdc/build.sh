@@ -1,7 +1,19 @@
 #! /bin/bash
 set -e
 
-gcc -g fastdc.c aom/aom_dsp/fwd_txfm.c aom/aom_dsp/inv_txfm.c -Iaom/ -Iaom/build/ -o fastdc
+UTILS=../../utils
+# The SIMD transforms of aom_dsp, picked at run time by aom_txfm_rtcd().
+AOM=../../tf/adst
+X86=$AOM/aom_dsp/x86
+SIMD="$AOM/aom_dsp/aom_txfm_rtcd.c $X86/fwd_txfm_sse2.c $X86/inv_txfm_sse2.c $X86/avg_intrin_sse2.c"
+
+# Only the AVX2 file is built with -mavx2, the rest runs on any SSE2 CPU.
+gcc -O2 -g -mavx2 -c $X86/fwd_txfm_avx2.c -Iaom/ -Iaom/build/ -I$AOM/ -o fwd_txfm_avx2.o
+gcc -O2 -g -msse2 fastdc.c flat_fdct.c flat_idct.c near_flat.c aom/aom_dsp/avg.c aom/aom_dsp/fwd_txfm.c aom/aom_dsp/inv_txfm.c $SIMD fwd_txfm_avx2.o $UTILS/vidinput.c $UTILS/y4m_input.c -Iaom/ -Iaom/build/ -I../scaling/ -I$AOM/ -I$UTILS/ -o fastdc
+
+./fastdc ../../videos/owl.y4m
+# The same with the C transforms
+./fastdc --force-c ../../videos/owl.y4m
 
 ./fastdc 4
 gnuplot hist.dem
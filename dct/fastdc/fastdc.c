@@ -1,9 +1,16 @@
 
 #include <stdio.h>
 #include <stdlib.h>
-#include "./aom_dsp_rtcd.h"
+#include "aom_dsp/aom_txfm_rtcd.h"
 #include <assert.h>
 #include <string.h>
+#include <time.h>
+
+#include "txfm_scale.h"
+#include "flat_fdct.h"
+#include "flat_idct.h"
+#include "near_flat.h"
+#include "vidinput.h"
 
 void init_block(tran_low_t *const block, int block_size, int value) {
   int x, y;
@@ -14,10 +21,252 @@ void init_block(tran_low_t *const block, int block_size, int value) {
   }
 }
 
+static double now() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+typedef void (*fdct_func)(const int16_t *, tran_low_t *, int);
+typedef void (*idct_add_func)(const tran_low_t *, uint8_t *, int);
+
+// Addresses of the RTCD pointers, which are set by aom_txfm_rtcd().
+static fdct_func *const aom_fdct[TXFM_SIZES] = {
+  &aom_fdct4x4, &aom_fdct8x8, &aom_fdct16x16, &aom_fdct32x32
+};
+static const fdct_func flat_fdct[TXFM_SIZES] = {
+  flat_fdct4x4, flat_fdct8x8, flat_fdct16x16, flat_fdct32x32
+};
+static idct_add_func *const aom_idct_add[TXFM_SIZES] = {
+  &aom_idct4x4_16_add, &aom_idct8x8_64_add, &aom_idct16x16_256_add,
+  &aom_idct32x32_1024_add
+};
+static const idct_add_func flat_idct_add[TXFM_SIZES] = {
+  flat_idct4x4_add, flat_idct8x8_add, flat_idct16x16_add, flat_idct32x32_add
+};
+
+#define NEAR_FLAT_DEAD_ZONES (4)
+static const int near_flat_dead_zones[NEAR_FLAT_DEAD_ZONES] = { 16, 32, 64,
+                                                                128 };
+static const char *const near_flat_check_names[NEAR_FLAT_CHECKS] = {
+  "sad", "hadamard"
+};
+
+typedef struct NEAR_FLAT_RESULTS {
+  int64_t dc_only[NEAR_FLAT_DEAD_ZONES][NEAR_FLAT_CHECKS][TXFM_SIZES];
+  // DC-only blocks with an AC of aom_fdctNxN outside of the dead zone.
+  int64_t lost[NEAR_FLAT_DEAD_ZONES][NEAR_FLAT_CHECKS][TXFM_SIZES];
+  double time[NEAR_FLAT_DEAD_ZONES][NEAR_FLAT_CHECKS][TXFM_SIZES];
+} NEAR_FLAT_RESULTS;
+
+static int ac_outside_dead_zone(const tran_low_t *coeffs, int n2,
+                                int dead_zone) {
+  int i;
+  for (i = 1; i < n2; i++) {
+    if (abs(coeffs[i]) >= dead_zone) return 1;
+  }
+  return 0;
+}
+
+/* Transforms the num residual blocks with near_flat_fdct, for each dead zone
+ * and each check. coeffs_aom holds the output of aom_fdctNxN. */
+static void run_near_flat(NEAR_FLAT_RESULTS *res, const int16_t *residual,
+                          const tran_low_t *coeffs_aom, tran_low_t *coeffs,
+                          int num, TXFM_SIZE s) {
+  const int n = 4 << s;
+  const int n2 = n * n;
+  uint8_t *dc_only = (uint8_t *)malloc(num);
+  int d;
+  int c;
+  int b;
+  for (d = 0; d < NEAR_FLAT_DEAD_ZONES; d++) {
+    const int dead_zone = near_flat_dead_zones[d];
+    for (c = 0; c < NEAR_FLAT_CHECKS; c++) {
+      double t = now();
+      for (b = 0; b < num; b++) {
+        dc_only[b] = near_flat_fdct(residual + b * n2, coeffs + b * n2, n, s,
+                                    dead_zone, (NEAR_FLAT_CHECK)c);
+      }
+      res->time[d][c][s] += now() - t;
+      for (b = 0; b < num; b++) {
+        if (!dc_only[b]) continue;
+        res->dc_only[d][c][s]++;
+        res->lost[d][c][s] +=
+            ac_outside_dead_zone(coeffs_aom + b * n2, n2, dead_zone);
+      }
+    }
+  }
+  free(dc_only);
+}
+
+static void near_flat_dump(FILE *f, const NEAR_FLAT_RESULTS *res,
+                           const int64_t *calls, const double *time_aom) {
+  int d;
+  int c;
+  int s;
+  for (d = 0; d < NEAR_FLAT_DEAD_ZONES; d++) {
+    for (c = 0; c < NEAR_FLAT_CHECKS; c++) {
+      fprintf(f, "Near flat, dead zone %d, %s check\n",
+              near_flat_dead_zones[d], near_flat_check_names[c]);
+      for (s = 0; s < TXFM_SIZES; s++) {
+        const int n = 4 << s;
+        if (!calls[s]) continue;
+        fprintf(f, "%2dx%-2d: %ld of %ld blocks DC only (%.2f%%), %ld lost, "
+                "%.1f ns/block (x%.2f)\n", n, n, (long)res->dc_only[d][c][s],
+                (long)calls[s], 100.0 * res->dc_only[d][c][s] / calls[s],
+                (long)res->lost[d][c][s], res->time[d][c][s] * 1e9 / calls[s],
+                time_aom[s] / res->time[d][c][s]);
+      }
+    }
+  }
+}
+
+/* Every n x n block of every plane is predicted with the average of its top
+ * and left neighbors (like DC_PRED). The residual is transformed and
+ * reconstructed with aom_fdctNxN and aom_idctNxN_*_add, and with the fast
+ * paths (flat_fdctNxN and flat_idctNxN_add). Both must reconstruct the same
+ * pixels. */
+static int run_video(const char *path) {
+  FILE *fin = fopen(path, "rb");
+  video_input vid;
+  video_input_info info;
+  video_input_ycbcr f;
+  double time_aom[TXFM_SIZES] = { 0 };
+  double time_flat[TXFM_SIZES] = { 0 };
+  double time_aom_inv[TXFM_SIZES] = { 0 };
+  double time_flat_inv[TXFM_SIZES] = { 0 };
+  int64_t mismatches[TXFM_SIZES] = { 0 };
+  NEAR_FLAT_RESULTS near_flat = { { { { 0 } } } };
+  int s;
+  int p;
+  if (!fin || video_input_open(&vid, fin)) {
+    fprintf(stderr, "Could not open %s\n", path);
+    return -1;
+  }
+  video_input_get_info(&vid, &info);
+  if (info.depth != 8) {
+    fprintf(stderr, "Only 8 bit content is supported\n");
+    return -1;
+  }
+  flat_stats_reset(&flat_stats);
+  while (video_input_fetch_frame(&vid, f, NULL) == 1) {
+    for (s = 0; s < TXFM_SIZES; s++) {
+      const int n = 4 << s;
+      const int n2 = n * n;
+      for (p = 0; p < 3; p++) {
+        const video_input_plane *const plane = &f[p];
+        const int bw = plane->width / n;
+        const int bh = plane->height / n;
+        const int num = bw * bh;
+        int16_t *residual = (int16_t *)malloc(sizeof(int16_t) * num * n2);
+        uint8_t *pred = (uint8_t *)malloc(num);
+        tran_low_t *coeffs_aom =
+            (tran_low_t *)malloc(sizeof(tran_low_t) * num * n2);
+        tran_low_t *coeffs_flat =
+            (tran_low_t *)malloc(sizeof(tran_low_t) * num * n2);
+        uint8_t *recon_aom = (uint8_t *)malloc(num * n2);
+        uint8_t *recon_flat = (uint8_t *)malloc(num * n2);
+        double t;
+        int b;
+        int x;
+        int y;
+        for (b = 0; b < num; b++) {
+          const uint8_t *src = plane->data
+              + (b / bw) * n * plane->stride + (b % bw) * n;
+          int sum = 0;
+          int cnt = 0;
+          for (y = 0; y < n; y++) {
+            if (b >= bw) sum += src[y - plane->stride];
+            if (b % bw) sum += src[y * plane->stride - 1];
+          }
+          cnt = (b >= bw) * n + (b % bw > 0) * n;
+          pred[b] = cnt ? (sum + cnt / 2) / cnt : 128;
+          for (y = 0; y < n; y++) {
+            for (x = 0; x < n; x++) {
+              residual[b * n2 + y * n + x] = src[y * plane->stride + x]
+                  - pred[b];
+            }
+          }
+        }
+        t = now();
+        for (b = 0; b < num; b++) {
+          (*aom_fdct[s])(residual + b * n2, coeffs_aom + b * n2, n);
+        }
+        time_aom[s] += now() - t;
+        t = now();
+        for (b = 0; b < num; b++) {
+          flat_fdct[s](residual + b * n2, coeffs_flat + b * n2, n);
+        }
+        time_flat[s] += now() - t;
+        for (b = 0; b < num; b++) {
+          memset(recon_aom + b * n2, pred[b], n2);
+          memset(recon_flat + b * n2, pred[b], n2);
+        }
+        t = now();
+        for (b = 0; b < num; b++) {
+          (*aom_idct_add[s])(coeffs_aom + b * n2, recon_aom + b * n2, n);
+        }
+        time_aom_inv[s] += now() - t;
+        t = now();
+        for (b = 0; b < num; b++) {
+          flat_idct_add[s](coeffs_flat + b * n2, recon_flat + b * n2, n);
+        }
+        time_flat_inv[s] += now() - t;
+        for (b = 0; b < num; b++) {
+          mismatches[s] +=
+              memcmp(recon_aom + b * n2, recon_flat + b * n2, n2) != 0;
+        }
+        run_near_flat(&near_flat, residual, coeffs_aom, coeffs_flat, num,
+                      (TXFM_SIZE)s);
+        free(recon_aom);
+        free(recon_flat);
+        free(residual);
+        free(pred);
+        free(coeffs_aom);
+        free(coeffs_flat);
+      }
+    }
+  }
+  video_input_close(&vid);
+
+  flat_stats_dump(stdout, &flat_stats);
+  for (s = 0; s < TXFM_SIZES; s++) {
+    const int n = 4 << s;
+    const int64_t calls = flat_stats.calls[s];
+    printf("%2dx%-2d: aom_fdct %.1f ns/block, flat_fdct %.1f ns/block, "
+           "aom_idct %.1f ns/block, flat_idct %.1f ns/block, "
+           "%ld reconstruction mismatches\n", n, n,
+           calls ? time_aom[s] * 1e9 / calls : 0,
+           calls ? time_flat[s] * 1e9 / calls : 0,
+           calls ? time_aom_inv[s] * 1e9 / calls : 0,
+           calls ? time_flat_inv[s] * 1e9 / calls : 0, (long)mismatches[s]);
+  }
+  near_flat_dump(stdout, &near_flat, flat_stats.calls, time_aom);
+  return 0;
+}
+
 int main(int _argc,char **_argv) {
 
   int x,y;
   int dc;
+  int force_c = 0;
+  TXFM_SIZE tx_size;
+
+  // --force-c runs the C transforms, to compare with the SIMD ones.
+  if (_argc > 1 && !strcmp(_argv[1], "--force-c")) {
+    force_c = 1;
+    _argc--;
+    _argv++;
+  }
+  if (_argc != 2) {
+    fprintf(stderr, "usage: fastdc [--force-c] block_size | video.y4m\n");
+    return -1;
+  }
+  aom_txfm_rtcd(force_c);
+  if (strstr(_argv[1], ".y4m")) {
+    return run_video(_argv[1]);
+  }
+
   const int block_size = atoi(_argv[1]);
   const int block_square = block_size * block_size;
 
@@ -35,24 +284,28 @@ int main(int _argc,char **_argv) {
   switch (block_size)
   {
     case 4:
-      dct = &aom_fdct4x4_c;
-      fdct1 = &aom_fdct4x4_1_c;
-      idct = &aom_idct4x4_16_add_c;
+      tx_size = TXFM_4X4;
+      dct = aom_fdct4x4;
+      fdct1 = aom_fdct4x4_1;
+      idct = aom_idct4x4_16_add;
       break;
     case 8:
-      dct = &aom_fdct8x8_c;
-      fdct1 = &aom_fdct8x8_1_c;
-      idct = &aom_idct8x8_64_add_c;
+      tx_size = TXFM_8X8;
+      dct = aom_fdct8x8;
+      fdct1 = aom_fdct8x8_1;
+      idct = aom_idct8x8_64_add;
       break;
     case 16:
-      dct = &aom_fdct16x16_c;
-      fdct1 = &aom_fdct16x16_1_c;
-      idct = &aom_idct16x16_256_add_c;
+      tx_size = TXFM_16X16;
+      dct = aom_fdct16x16;
+      fdct1 = aom_fdct16x16_1;
+      idct = aom_idct16x16_256_add;
       break;
     case 32:
-      dct = &aom_fdct32x32_c;
-      fdct1 = &aom_fdct32x32_1_c;
-      idct = &aom_idct32x32_1024_add_c;
+      tx_size = TXFM_32X32;
+      dct = aom_fdct32x32;
+      fdct1 = aom_fdct32x32_1;
+      idct = aom_idct32x32_1024_add;
       break;
     default:
       fprintf(stderr, "invalid block size\n");
@@ -91,13 +344,12 @@ int main(int _argc,char **_argv) {
 
     memset(dct_block, 0, sizeof(tran_low_t)*block_square);
     memset(idct_block, 0, sizeof(uint8_t)*block_square);
-    if (block_size < 32) {
-      dct_block[0] = block[0] * block_size << 3;
-    } else {
-      dct_block[0] = block[0] * 128;
-    }
+    // The DC of a flat block is v * block_size in an orthonormal DCT.
+    dct_block[0] = block[0] * block_size
+        << txfm_scale[TXFM_AOM][tx_size].scale_log2;
     const int proposed = dct_block[0];
-    idct(dct_block, idct_block, block_size);
+    // Only the DC is set, so this is the DC-only path.
+    flat_idct_add[tx_size](dct_block, idct_block, block_size);
     for (x = 0; x < block_square; x++)
     {
       assert(idct_block[x] == v);
@@ -0,0 +1,98 @@
+#include <string.h>
+#include <emmintrin.h>
+
+#include "aom_dsp/aom_txfm_rtcd.h"
+#include "flat_fdct.h"
+
+FLAT_STATS flat_stats;
+
+int block_is_flat_c(const int16_t *input, int stride, int n) {
+  const int16_t x = input[0];
+  int i;
+  int j;
+  for (i = 0; i < n; i++) {
+    for (j = 0; j < n; j++) {
+      if (input[i * stride + j] != x) return 0;
+    }
+  }
+  return 1;
+}
+
+int block_is_flat_sse2(const int16_t *input, int stride, int n) {
+  const __m128i x = _mm_set1_epi16(input[0]);
+  __m128i eq = _mm_cmpeq_epi16(x, x);
+  int i;
+  int j;
+  if (n == 4) {
+    for (i = 0; i < 4; i++) {
+      const __m128i row =
+          _mm_loadl_epi64((const __m128i *)(input + i * stride));
+      eq = _mm_and_si128(eq, _mm_cmpeq_epi16(row, x));
+    }
+    // Only the low 4 values were loaded.
+    return (_mm_movemask_epi8(eq) & 0xFF) == 0xFF;
+  }
+  for (i = 0; i < n; i++) {
+    for (j = 0; j < n; j += 8) {
+      const __m128i row =
+          _mm_loadu_si128((const __m128i *)(input + i * stride + j));
+      eq = _mm_and_si128(eq, _mm_cmpeq_epi16(row, x));
+    }
+    // Exit at the first row with a difference.
+    if (_mm_movemask_epi8(eq) != 0xFFFF) return 0;
+  }
+  return 1;
+}
+
+static INLINE void flat_fdct(const int16_t *input, tran_low_t *output,
+                             int stride, TXFM_SIZE size,
+                             void (*fdct)(const int16_t *, tran_low_t *,
+                                          int)) {
+  const int n = 4 << size;
+  flat_stats.calls[size]++;
+  if (block_is_flat_sse2(input, stride, n)) {
+    flat_stats.flat[size]++;
+    memset(output, 0, sizeof(*output) * n * n);
+    output[0] = (tran_low_t)(input[0] * n
+                             * (1 << txfm_scale[TXFM_AOM][size].scale_log2));
+    return;
+  }
+  fdct(input, output, stride);
+}
+
+void flat_fdct4x4(const int16_t *input, tran_low_t *output, int stride) {
+  flat_fdct(input, output, stride, TXFM_4X4, aom_fdct4x4);
+}
+
+void flat_fdct8x8(const int16_t *input, tran_low_t *output, int stride) {
+  flat_fdct(input, output, stride, TXFM_8X8, aom_fdct8x8);
+}
+
+void flat_fdct16x16(const int16_t *input, tran_low_t *output, int stride) {
+  flat_fdct(input, output, stride, TXFM_16X16, aom_fdct16x16);
+}
+
+void flat_fdct32x32(const int16_t *input, tran_low_t *output, int stride) {
+  flat_fdct(input, output, stride, TXFM_32X32, aom_fdct32x32);
+}
+
+void flat_stats_reset(FLAT_STATS *stats) {
+  memset(stats, 0, sizeof(*stats));
+}
+
+void flat_stats_dump(FILE *f, const FLAT_STATS *stats) {
+  int s;
+  for (s = 0; s < TXFM_SIZES; s++) {
+    const int n = 4 << s;
+    fprintf(f, "%2dx%-2d: %ld of %ld blocks flat (%.2f%%)\n", n, n,
+            (long)stats->flat[s], (long)stats->calls[s],
+            stats->calls[s] ? 100.0 * stats->flat[s] / stats->calls[s] : 0);
+  }
+  for (s = 0; s < TXFM_SIZES; s++) {
+    const int n = 4 << s;
+    if (!stats->idct_calls[s]) continue;
+    fprintf(f, "%2dx%-2d: %ld of %ld inverses DC only (%.2f%%)\n", n, n,
+            (long)stats->idct_dc_only[s], (long)stats->idct_calls[s],
+            100.0 * stats->idct_dc_only[s] / stats->idct_calls[s]);
+  }
+}
@@ -0,0 +1,38 @@
+#ifndef FLAT_FDCT_H_
+#define FLAT_FDCT_H_
+
+#include <stdio.h>
+
+#include "aom/aom_integer.h"
+#include "aom_dsp/aom_dsp_common.h"
+
+#include "txfm_scale.h"
+
+/* Forward DCTs with a fast path for flat blocks: when all the pixels of the
+ * block are the same, the DC is computed with DC = N*x*2^scale_log2 and the
+ * AC coefficients are zero, otherwise aom_fdctNxN (the version picked by
+ * aom_txfm_rtcd()) is called. */
+void flat_fdct4x4(const int16_t *input, tran_low_t *output, int stride);
+void flat_fdct8x8(const int16_t *input, tran_low_t *output, int stride);
+void flat_fdct16x16(const int16_t *input, tran_low_t *output, int stride);
+void flat_fdct32x32(const int16_t *input, tran_low_t *output, int stride);
+
+// Returns 1 when the n x n block (n a multiple of 4) is flat.
+int block_is_flat_c(const int16_t *input, int stride, int n);
+int block_is_flat_sse2(const int16_t *input, int stride, int n);
+
+typedef struct FLAT_STATS {
+  int64_t calls[TXFM_SIZES];
+  int64_t flat[TXFM_SIZES];
+  // DC-only inverses (see flat_idct.h).
+  int64_t idct_calls[TXFM_SIZES];
+  int64_t idct_dc_only[TXFM_SIZES];
+} FLAT_STATS;
+
+// Counters of the flat_fdct and flat_idct functions (not thread safe).
+extern FLAT_STATS flat_stats;
+
+void flat_stats_reset(FLAT_STATS *stats);
+void flat_stats_dump(FILE *f, const FLAT_STATS *stats);
+
+#endif  // FLAT_FDCT_H_
@@ -0,0 +1,105 @@
+#include <emmintrin.h>
+
+#include "aom_dsp/aom_txfm_rtcd.h"
+#include "aom_dsp/inv_txfm.h"
+#include "flat_idct.h"
+
+int coeffs_dc_only_sse2(const tran_low_t *input, int n2) {
+  // Mask out input[0] in the first load.
+#if CONFIG_AOM_HIGHBITDEPTH
+  const __m128i first = _mm_set_epi32(-1, -1, -1, 0);
+  const int lanes = 4;
+#else
+  const __m128i first = _mm_set_epi16(-1, -1, -1, -1, -1, -1, -1, 0);
+  const int lanes = 8;
+#endif
+  __m128i acc;
+  int i;
+  acc = _mm_and_si128(_mm_loadu_si128((const __m128i *)input), first);
+  for (i = lanes; i < n2; i += lanes) {
+    acc = _mm_or_si128(acc, _mm_loadu_si128((const __m128i *)(input + i)));
+    // Most blocks with AC have it in the first coefficients.
+    if ((i & 63) == 0
+        && _mm_movemask_epi8(_mm_cmpeq_epi8(acc, _mm_setzero_si128()))
+        != 0xFFFF) {
+      return 0;
+    }
+  }
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(acc, _mm_setzero_si128()))
+      == 0xFFFF;
+}
+
+int dc_only_residual(tran_low_t dc, TXFM_SIZE size) {
+  tran_low_t out = WRAPLOW(dct_const_round_shift(dc * cospi_16_64));
+  out = WRAPLOW(dct_const_round_shift(out * cospi_16_64));
+  return ROUND_POWER_OF_TWO(out, -txfm_scale[TXFM_AOM][size].inv_shift[1]);
+}
+
+void dc_only_add_c(int v, uint8_t *dest, int stride, int n) {
+  int i;
+  int j;
+  for (i = 0; i < n; i++) {
+    for (j = 0; j < n; j++) {
+      dest[i * stride + j] = clip_pixel(dest[i * stride + j] + v);
+    }
+  }
+}
+
+void dc_only_add_sse2(int v, uint8_t *dest, int stride, int n) {
+  // clip_pixel(p + v) is a saturated add of v or a saturated subtract of -v.
+  const __m128i add = _mm_set1_epi8((char)AOMMIN(AOMMAX(v, 0), 255));
+  const __m128i sub = _mm_set1_epi8((char)AOMMIN(AOMMAX(-v, 0), 255));
+  int i;
+  int j;
+  if (n == 4) {
+    for (i = 0; i < 4; i++) {
+      __m128i p = _mm_cvtsi32_si128(*(const int *)(dest + i * stride));
+      p = _mm_subs_epu8(_mm_adds_epu8(p, add), sub);
+      *(int *)(dest + i * stride) = _mm_cvtsi128_si32(p);
+    }
+  } else if (n == 8) {
+    for (i = 0; i < 8; i++) {
+      __m128i p = _mm_loadl_epi64((const __m128i *)(dest + i * stride));
+      p = _mm_subs_epu8(_mm_adds_epu8(p, add), sub);
+      _mm_storel_epi64((__m128i *)(dest + i * stride), p);
+    }
+  } else {
+    for (i = 0; i < n; i++) {
+      for (j = 0; j < n; j += 16) {
+        __m128i p = _mm_loadu_si128((const __m128i *)(dest + i * stride + j));
+        p = _mm_subs_epu8(_mm_adds_epu8(p, add), sub);
+        _mm_storeu_si128((__m128i *)(dest + i * stride + j), p);
+      }
+    }
+  }
+}
+
+static INLINE void flat_idct_add(const tran_low_t *input, uint8_t *dest,
+                                 int stride, TXFM_SIZE size,
+                                 void (*idct)(const tran_low_t *, uint8_t *,
+                                              int)) {
+  const int n = 4 << size;
+  flat_stats.idct_calls[size]++;
+  if (coeffs_dc_only_sse2(input, n * n)) {
+    flat_stats.idct_dc_only[size]++;
+    dc_only_add_sse2(dc_only_residual(input[0], size), dest, stride, n);
+    return;
+  }
+  idct(input, dest, stride);
+}
+
+void flat_idct4x4_add(const tran_low_t *input, uint8_t *dest, int stride) {
+  flat_idct_add(input, dest, stride, TXFM_4X4, aom_idct4x4_16_add);
+}
+
+void flat_idct8x8_add(const tran_low_t *input, uint8_t *dest, int stride) {
+  flat_idct_add(input, dest, stride, TXFM_8X8, aom_idct8x8_64_add);
+}
+
+void flat_idct16x16_add(const tran_low_t *input, uint8_t *dest, int stride) {
+  flat_idct_add(input, dest, stride, TXFM_16X16, aom_idct16x16_256_add);
+}
+
+void flat_idct32x32_add(const tran_low_t *input, uint8_t *dest, int stride) {
+  flat_idct_add(input, dest, stride, TXFM_32X32, aom_idct32x32_1024_add);
+}
@@ -0,0 +1,26 @@
+#ifndef FLAT_IDCT_H_
+#define FLAT_IDCT_H_
+
+#include "flat_fdct.h"
+
+/* Inverse DCTs with a fast path for DC-only blocks: when all the AC
+ * coefficients are zero, the reconstructed residual is the same for every
+ * pixel and is added with SIMD stores, otherwise aom_idctNxN_*_add (the
+ * version picked by aom_txfm_rtcd()) is called. The result is the same as
+ * aom_idctNxN_*_add_c. */
+void flat_idct4x4_add(const tran_low_t *input, uint8_t *dest, int stride);
+void flat_idct8x8_add(const tran_low_t *input, uint8_t *dest, int stride);
+void flat_idct16x16_add(const tran_low_t *input, uint8_t *dest, int stride);
+void flat_idct32x32_add(const tran_low_t *input, uint8_t *dest, int stride);
+
+// Returns 1 when the n2 coefficients after input[0] are all zero.
+int coeffs_dc_only_sse2(const tran_low_t *input, int n2);
+
+// Residual of a DC-only block, like aom_idctNxN_1_add_c.
+int dc_only_residual(tran_low_t dc, TXFM_SIZE size);
+
+// Adds v to the n x n block at dest (n = 4, 8, 16, 32 or 64), with clipping.
+void dc_only_add_c(int v, uint8_t *dest, int stride, int n);
+void dc_only_add_sse2(int v, uint8_t *dest, int stride, int n);
+
+#endif  // FLAT_IDCT_H_
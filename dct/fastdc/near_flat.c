@@ -0,0 +1,108 @@
+#include <stdlib.h>
+#include <string.h>
+#include <emmintrin.h>
+
+#include "aom_dsp/aom_txfm_rtcd.h"
+#include "near_flat.h"
+
+typedef void (*fdct_func_t)(const int16_t *, tran_low_t *, int);
+
+// The RTCD pointers are only set by aom_txfm_rtcd(), so the tables hold their
+// addresses.
+static fdct_func_t *const aom_fdct[TXFM_SIZES] = {
+  &aom_fdct4x4, &aom_fdct8x8, &aom_fdct16x16, &aom_fdct32x32
+};
+
+static fdct_func_t *const aom_fdct_1[TXFM_SIZES] = {
+  &aom_fdct4x4_1, &aom_fdct8x8_1, &aom_fdct16x16_1, &aom_fdct32x32_1
+};
+
+// Loads 8 values of a row, or 4 (and 4 zeros) when n = 4.
+static INLINE __m128i load_row(const int16_t *input, int n) {
+  return n == 4 ? _mm_loadl_epi64((const __m128i *)input)
+                : _mm_loadu_si128((const __m128i *)input);
+}
+
+static INLINE int hsum_epi32(__m128i v) {
+  v = _mm_add_epi32(v, _mm_srli_si128(v, 8));
+  v = _mm_add_epi32(v, _mm_srli_si128(v, 4));
+  return _mm_cvtsi128_si32(v);
+}
+
+/* An AC coefficient of the orthonormal DCT is the sum of (x - m)*b(x) for any
+ * constant m (the AC basis functions sum to 0), and |b(x)| <= 2/N, so
+ *   |AC| <= 2^scale_log2*2/N*SAD(x, m).
+ * The block passes when this bound (plus the rounding error of the integer
+ * DCT) is below the dead zone. */
+int block_is_near_flat_sad_sse2(const int16_t *input, int stride,
+                                TXFM_SIZE size, int dead_zone) {
+  const int n = 4 << size;
+  const int shift = txfm_scale[TXFM_AOM][size].scale_log2 + 1;
+  const int limit = (dead_zone - NEAR_FLAT_MARGIN) * n;
+  const __m128i ones = _mm_set1_epi16(1);
+  __m128i acc = _mm_setzero_si128();
+  __m128i m;
+  int i;
+  int j;
+  if (limit <= 0) return 0;
+  for (i = 0; i < n; i++) {
+    for (j = 0; j < n; j += 8) {
+      const __m128i row = load_row(input + i * stride + j, n);
+      acc = _mm_add_epi32(acc, _mm_madd_epi16(row, ones));
+    }
+  }
+  m = _mm_set1_epi16(
+      (int16_t)ROUND_POWER_OF_TWO_SIGNED(hsum_epi32(acc), 2 * (size + 2)));
+  // The 4 zeros loaded after each row of a 4x4 must stay zero.
+  if (n == 4) m = _mm_move_epi64(m);
+  acc = _mm_setzero_si128();
+  for (i = 0; i < n; i++) {
+    for (j = 0; j < n; j += 8) {
+      const __m128i row = load_row(input + i * stride + j, n);
+      const __m128i d = _mm_sub_epi16(row, m);
+      const __m128i ad =
+          _mm_max_epi16(d, _mm_sub_epi16(_mm_setzero_si128(), d));
+      acc = _mm_add_epi32(acc, _mm_madd_epi16(ad, ones));
+    }
+    // Exit once the bound is above the dead zone (checked every 4 rows).
+    if ((i & 3) == 3 && hsum_epi32(acc) << shift >= limit) return 0;
+  }
+  return 1;
+}
+
+/* The Hadamard transform is orthogonal like the DCT, and its AC basis
+ * functions are close to the ones of the DCT for smooth blocks, so its
+ * largest AC is used as an estimate of the largest AC of the DCT. This is not
+ * a bound. Blocks of other sizes fall back to the SAD. */
+int block_is_near_flat_hadamard(const int16_t *input, int stride,
+                                TXFM_SIZE size, int dead_zone) {
+  // aom_hadamard_8x8 has a gain of 8, aom_fdct8x8 has a gain of 8.
+  const int limit = dead_zone - NEAR_FLAT_MARGIN;
+  int16_t coeff[64];
+  int i;
+  if (size != TXFM_8X8) {
+    return block_is_near_flat_sad_sse2(input, stride, size, dead_zone);
+  }
+  if (limit <= 0) return 0;
+  aom_hadamard_8x8(input, stride, coeff);
+  for (i = 1; i < 64; i++) {
+    if (abs(coeff[i]) >= limit) return 0;
+  }
+  return 1;
+}
+
+int near_flat_fdct(const int16_t *input, tran_low_t *output, int stride,
+                   TXFM_SIZE size, int dead_zone, NEAR_FLAT_CHECK check) {
+  const int n = 4 << size;
+  const int near_flat =
+      check == NEAR_FLAT_HADAMARD
+          ? block_is_near_flat_hadamard(input, stride, size, dead_zone)
+          : block_is_near_flat_sad_sse2(input, stride, size, dead_zone);
+  if (near_flat) {
+    (*aom_fdct_1[size])(input, output, stride);
+    memset(output + 1, 0, sizeof(*output) * (n * n - 1));
+    return 1;
+  }
+  (*aom_fdct[size])(input, output, stride);
+  return 0;
+}
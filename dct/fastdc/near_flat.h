@@ -0,0 +1,34 @@
+#ifndef NEAR_FLAT_H_
+#define NEAR_FLAT_H_
+
+#include "flat_fdct.h"
+
+/* Forward DCTs with a DC-only shortcut for nearly flat blocks: when all the
+ * AC coefficients of aom_fdctNxN would be inside the dead zone of the
+ * quantizer (|AC| < dead_zone quantizes to 0), only the DC is computed (with
+ * aom_fdctNxN_1) and the AC coefficients are zeroed. The transforms are the
+ * versions picked by aom_txfm_rtcd(). */
+
+// Integer rounding error of the AC coefficients of aom_fdctNxN_c.
+#define NEAR_FLAT_MARGIN (8)
+
+typedef enum NEAR_FLAT_CHECK {
+  // Bound from the SAD to the mean: no AC outside of the dead zone is lost.
+  NEAR_FLAT_SAD,
+  // Estimate from the AC of aom_hadamard_8x8 (8x8 only): cheaper to pass,
+  // but a few AC outside of the dead zone can be lost.
+  NEAR_FLAT_HADAMARD,
+  NEAR_FLAT_CHECKS
+} NEAR_FLAT_CHECK;
+
+// Returns 1 when all the AC coefficients are below dead_zone.
+int block_is_near_flat_sad_sse2(const int16_t *input, int stride,
+                                TXFM_SIZE size, int dead_zone);
+int block_is_near_flat_hadamard(const int16_t *input, int stride,
+                                TXFM_SIZE size, int dead_zone);
+
+// Returns 1 when the DC-only shortcut was taken.
+int near_flat_fdct(const int16_t *input, tran_low_t *output, int stride,
+                   TXFM_SIZE size, int dead_zone, NEAR_FLAT_CHECK check);
+
+#endif  // NEAR_FLAT_H_
@@ -82,6 +82,9 @@
 #define CONFIG_TEMPORAL_DENOISING 1
 #define CONFIG_AV1_TEMPORAL_DENOISING 0
 #define CONFIG_COEFFICIENT_RANGE_CHECKING 0
+#ifndef CONFIG_COEFFICIENT_RANGE_STATS
+#define CONFIG_COEFFICIENT_RANGE_STATS 0
+#endif
 #define CONFIG_AOM_HIGHBITDEPTH 0
 #define CONFIG_BETTER_HW_COMPATIBILITY 0
 #define CONFIG_EXPERIMENTAL 1
@@ -1,6 +1,27 @@
 #! /bin/bash
 set -e
 
-gcc -g scaling.c aom/aom_dsp/fwd_txfm.c aom/aom_dsp/inv_txfm.c -Iaom/ -Iaom/build/ -o scaling
+gcc -g scaling.c txfm2d.c lift_dct.c aom/aom_dsp/fwd_txfm.c aom/aom_dsp/inv_txfm.c -Iaom/ -Iaom/build/ -o scaling
 
 ./scaling
+
+gcc -O2 -g -msse4.1 -mavx2 simd.c lift_dct.c lift_dct_sse4.c lift_dct_avx2.c -Iaom/ -Iaom/build/ -o simd
+
+./simd
+
+UTILS=../../utils
+# The SIMD transforms of aom_dsp, picked at run time by aom_txfm_rtcd() (its
+# RTCD has the Hadamard of avg.c too).
+AOM=../../tf/adst
+X86=$AOM/aom_dsp/x86
+AOM_SIMD="$AOM/aom_dsp/aom_txfm_rtcd.c $X86/fwd_txfm_sse2.c $X86/inv_txfm_sse2.c $AOM/aom_dsp/avg.c $X86/avg_intrin_sse2.c"
+# Only the SSE4.1 and AVX2 files are built with their ISA, the rest runs on
+# any SSE2 CPU (compare skips the lifting SIMD rows on CPUs without them).
+gcc -O2 -g -msse4.1 -c lift_dct_sse4.c -Iaom/ -Iaom/build/ -o lift_dct_sse4.o
+gcc -O2 -g -mavx2 -c lift_dct_avx2.c -Iaom/ -Iaom/build/ -o lift_dct_avx2.o
+gcc -O2 -g -mavx2 -c $X86/fwd_txfm_avx2.c -Iaom/ -Iaom/build/ -I$AOM/ -o fwd_txfm_avx2.o
+gcc -O2 -g -msse2 -pthread compare.c txfm2d.c lift_dct.c aom/aom_dsp/fwd_txfm.c aom/aom_dsp/inv_txfm.c $AOM_SIMD lift_dct_sse4.o lift_dct_avx2.o fwd_txfm_avx2.o $UTILS/vidinput.c $UTILS/y4m_input.c -Iaom/ -Iaom/build/ -I$AOM/ -I$UTILS/ -lm -o compare
+
+./compare 1000000 4 ../../videos/owl.y4m
+# AOM's C transforms
+./compare --force-c 1000000 4 ../../videos/owl.y4m
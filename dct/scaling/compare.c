@@ -0,0 +1,417 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "aom/aom_integer.h"
+#include "aom_dsp/aom_dsp_common.h"
+#include "aom_dsp/aom_txfm_rtcd.h"
+#include "aom_ports/x86.h"
+
+#include "lift_dct.h"
+#include "txfm2d.h"
+#include "vidinput.h"
+
+#define MAX_THREADS (64)
+#define NUM_SIZES (4)
+#define BATCH (256)
+
+enum { SOURCE_RANDOM, SOURCE_VIDEO, NUM_SOURCES };
+
+static const char *const source_names[NUM_SOURCES] = { "random", "video" };
+
+typedef void (*fwd_txfm)(const int16_t *input, tran_low_t *output, int stride);
+typedef void (*inv_txfm)(const tran_low_t *input, uint8_t *dest, int stride);
+
+typedef struct {
+  const char *name;
+  fwd_txfm fwd[NUM_SIZES];
+  inv_txfm inv[NUM_SIZES];
+  // The x86_simd_caps() flags the transforms need, the family is skipped on
+  // CPUs without them.
+  int caps;
+} FAMILY;
+
+/* The SIMD lifting DCTs, scaled like the other transforms with txfm_scale. */
+static INLINE void lift_fwd(const int16_t *input, tran_low_t *output,
+                            int stride, TXFM_SIZE size,
+                            void (*fdct)(const int16_t *, tran_low_t *, int)) {
+  const int n = 4 << size;
+  const int shift = txfm_fwd_scale[TXFM_FWD_LIFT(size)].shift[0];
+  int16_t tmp[32 * 32];
+  int i;
+  int j;
+  for (i = 0; i < n; i++) {
+    for (j = 0; j < n; j++) {
+      tmp[i * n + j] = input[i * stride + j] * (1 << shift);
+    }
+  }
+  fdct(tmp, output, n);
+}
+
+static INLINE void lift_inv_add(const tran_low_t *input, uint8_t *dest,
+                                int stride, TXFM_SIZE size,
+                                void (*idct)(const tran_low_t *, int16_t *,
+                                             int)) {
+  const int n = 4 << size;
+  const int shift = -txfm_scale[TXFM_LIFT][size].inv_shift[1];
+  int16_t tmp[32 * 32];
+  int i;
+  int j;
+  idct(input, tmp, n);
+  for (i = 0; i < n; i++) {
+    for (j = 0; j < n; j++) {
+      dest[i * stride + j] = clip_pixel(
+          dest[i * stride + j] + ROUND_POWER_OF_TWO(tmp[i * n + j], shift));
+    }
+  }
+}
+
+#define LIFT_WRAPPERS(n, size, isa)                                       \
+  static void lift_fwd##n##_##isa(const int16_t *input,                   \
+                                  tran_low_t *output, int stride) {       \
+    lift_fwd(input, output, stride, size, lift_fdct##n##x##n##_##isa);    \
+  }                                                                       \
+  static void lift_inv##n##_##isa(const tran_low_t *input, uint8_t *dest, \
+                                  int stride) {                           \
+    lift_inv_add(input, dest, stride, size, lift_idct##n##x##n##_##isa);  \
+  }
+
+/* The C version goes through the generic 2-D wrapper. */
+#define TXFM2D_WRAPPERS(n, size)                                          \
+  static void lift_fwd##n##_c(const int16_t *input, tran_low_t *output,   \
+                              int stride) {                               \
+    txfm2d_fwd(TXFM_FWD_LIFT(size), input, output, stride);               \
+  }                                                                       \
+  static void lift_inv##n##_c(const tran_low_t *input, uint8_t *dest,     \
+                              int stride) {                               \
+    txfm2d_inv_add(TXFM_LIFT, size, input, dest, stride);                 \
+  }
+
+TXFM2D_WRAPPERS(4, TXFM_4X4)
+TXFM2D_WRAPPERS(8, TXFM_8X8)
+TXFM2D_WRAPPERS(16, TXFM_16X16)
+TXFM2D_WRAPPERS(32, TXFM_32X32)
+LIFT_WRAPPERS(4, TXFM_4X4, sse4_1)
+LIFT_WRAPPERS(8, TXFM_8X8, avx2)
+LIFT_WRAPPERS(16, TXFM_16X16, avx2)
+LIFT_WRAPPERS(32, TXFM_32X32, avx2)
+
+// The AOM transforms are set by set_aom_family() once aom_txfm_rtcd() has
+// picked their versions.
+static FAMILY families[] = {
+  { "AOM", { NULL }, { NULL }, 0 },
+  { "Lifting",
+    { lift_fwd4_c, lift_fwd8_c, lift_fwd16_c, lift_fwd32_c },
+    { lift_inv4_c, lift_inv8_c, lift_inv16_c, lift_inv32_c }, 0 },
+  { "Lifting SIMD",
+    { lift_fwd4_sse4_1, lift_fwd8_avx2, lift_fwd16_avx2,
+      lift_fwd32_avx2 },
+    { lift_inv4_sse4_1, lift_inv8_avx2, lift_inv16_avx2,
+      lift_inv32_avx2 }, HAS_SSE4_1 | HAS_AVX2 },
+};
+
+#define NUM_FAMILIES ((int)(sizeof(families) / sizeof(families[0])))
+
+static void set_aom_family(FAMILY *family) {
+  family->fwd[TXFM_4X4] = aom_fdct4x4;
+  family->fwd[TXFM_8X8] = aom_fdct8x8;
+  family->fwd[TXFM_16X16] = aom_fdct16x16;
+  family->fwd[TXFM_32X32] = aom_fdct32x32;
+  family->inv[TXFM_4X4] = aom_idct4x4_16_add;
+  family->inv[TXFM_8X8] = aom_idct8x8_64_add;
+  family->inv[TXFM_16X16] = aom_idct16x16_256_add;
+  family->inv[TXFM_32X32] = aom_idct32x32_1024_add;
+}
+
+/* n x n blocks of the video and their prediction (the rounded average of the
+ * pixels above and to the left, like DC_PRED). */
+typedef struct {
+  int64_t count;
+  uint8_t *pixels;
+  uint8_t *pred;
+} VIDEO_BLOCKS;
+
+typedef struct {
+  int64_t blocks;
+  int64_t exact_blocks;
+  int64_t sse;
+  double res_energy;
+  double coef_energy;
+  int max_err;
+  int max_coef;
+  double fwd_time;
+  double inv_time;
+} TXFM_STATS;
+
+typedef struct {
+  const FAMILY *family;
+  int size_idx;
+  int source;
+  const VIDEO_BLOCKS *video;
+  int64_t first;
+  int64_t count;
+  TXFM_STATS stats;
+} TXFM_JOB;
+
+static double thread_time() {
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double wall_time() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// The random blocks only depend on their index, so that every family and
+// every thread count sees the same blocks.
+static INLINE uint32_t block_rand(uint32_t *state) {
+  *state = *state * 1103515245 + 12345;
+  return *state >> 16;
+}
+
+static void get_block(const TXFM_JOB *job, int64_t b, uint8_t *pixels,
+                      uint8_t *pred) {
+  const int n = 4 << job->size_idx;
+  int i;
+  if (job->source == SOURCE_VIDEO) {
+    memcpy(pixels, job->video->pixels + b * n * n, n * n);
+    memset(pred, job->video->pred[b], n * n);
+  } else {
+    uint32_t state = (uint32_t)b * 2654435761u + n;
+    for (i = 0; i < n * n; i++) {
+      pixels[i] = block_rand(&state) & 255;
+      pred[i] = block_rand(&state) & 255;
+    }
+  }
+}
+
+static void *process_job(void *arg) {
+  TXFM_JOB *const job = (TXFM_JOB *)arg;
+  TXFM_STATS *const s = &job->stats;
+  const int n = 4 << job->size_idx;
+  const int n2 = n * n;
+  const fwd_txfm fwd = job->family->fwd[job->size_idx];
+  const inv_txfm inv = job->family->inv[job->size_idx];
+  uint8_t *pixels = (uint8_t *)malloc(BATCH * n2);
+  uint8_t *recon = (uint8_t *)malloc(BATCH * n2);
+  int16_t *residual = (int16_t *)malloc(sizeof(int16_t) * BATCH * n2);
+  tran_low_t *coeffs = (tran_low_t *)malloc(sizeof(tran_low_t) * BATCH * n2);
+  int64_t b;
+  int i;
+  int k;
+  memset(s, 0, sizeof(*s));
+  for (b = 0; b < job->count; b += BATCH) {
+    const int batch = (int)AOMMIN(BATCH, job->count - b);
+    double t;
+    for (k = 0; k < batch; k++) {
+      get_block(job, job->first + b + k, pixels + k * n2, recon + k * n2);
+      for (i = 0; i < n2; i++) {
+        residual[k * n2 + i] = pixels[k * n2 + i] - recon[k * n2 + i];
+      }
+    }
+    t = thread_time();
+    for (k = 0; k < batch; k++) fwd(residual + k * n2, coeffs + k * n2, n);
+    s->fwd_time += thread_time() - t;
+    t = thread_time();
+    for (k = 0; k < batch; k++) inv(coeffs + k * n2, recon + k * n2, n);
+    s->inv_time += thread_time() - t;
+    for (k = 0; k < batch; k++) {
+      int exact = 1;
+      for (i = 0; i < n2; i++) {
+        const int err = abs(recon[k * n2 + i] - pixels[k * n2 + i]);
+        const int c = abs(coeffs[k * n2 + i]);
+        s->sse += err * err;
+        s->max_err = AOMMAX(s->max_err, err);
+        s->max_coef = AOMMAX(s->max_coef, c);
+        s->res_energy += residual[k * n2 + i] * residual[k * n2 + i];
+        s->coef_energy += (double)c * c;
+        exact &= err == 0;
+      }
+      s->exact_blocks += exact;
+    }
+    s->blocks += batch;
+  }
+  free(pixels);
+  free(recon);
+  free(residual);
+  free(coeffs);
+  return NULL;
+}
+
+static void stats_add(TXFM_STATS *dst, const TXFM_STATS *src) {
+  dst->blocks += src->blocks;
+  dst->exact_blocks += src->exact_blocks;
+  dst->sse += src->sse;
+  dst->res_energy += src->res_energy;
+  dst->coef_energy += src->coef_energy;
+  dst->max_err = AOMMAX(dst->max_err, src->max_err);
+  dst->max_coef = AOMMAX(dst->max_coef, src->max_coef);
+  dst->fwd_time += src->fwd_time;
+  dst->inv_time += src->inv_time;
+}
+
+// Number of bits of a signed value of magnitude up to v.
+static int signed_bits(int v) {
+  int bits = 1;
+  while (v >> (bits - 1)) bits++;
+  return bits;
+}
+
+static void load_video(const char *path, VIDEO_BLOCKS *blocks) {
+  FILE *fin = fopen(path, "rb");
+  video_input vid;
+  video_input_info info;
+  video_input_ycbcr f;
+  int s;
+  int p;
+  memset(blocks, 0, sizeof(*blocks) * NUM_SIZES);
+  if (!fin || video_input_open(&vid, fin)) {
+    fprintf(stderr, "Could not open %s\n", path);
+    exit(1);
+  }
+  video_input_get_info(&vid, &info);
+  if (info.depth != 8) {
+    fprintf(stderr, "Only 8 bit content is supported\n");
+    exit(1);
+  }
+  while (video_input_fetch_frame(&vid, f, NULL) == 1) {
+    for (s = 0; s < NUM_SIZES; s++) {
+      const int n = 4 << s;
+      VIDEO_BLOCKS *const v = &blocks[s];
+      int64_t frame_blocks = 0;
+      for (p = 0; p < 3; p++) {
+        frame_blocks += (int64_t)(f[p].width / n) * (f[p].height / n);
+      }
+      v->pixels = (uint8_t *)realloc(v->pixels,
+                                     (v->count + frame_blocks) * n * n);
+      v->pred = (uint8_t *)realloc(v->pred, v->count + frame_blocks);
+      for (p = 0; p < 3; p++) {
+        const video_input_plane *const plane = &f[p];
+        int x;
+        int y;
+        int i;
+        for (y = 0; y + n <= plane->height; y += n) {
+          for (x = 0; x + n <= plane->width; x += n) {
+            const uint8_t *src = plane->data + y * plane->stride + x;
+            int sum = 0;
+            int num = 0;
+            for (i = 0; i < n; i++) {
+              memcpy(v->pixels + v->count * n * n + i * n,
+                     src + i * plane->stride, n);
+              if (y > 0) sum += src[i - plane->stride];
+              if (x > 0) sum += src[i * plane->stride - 1];
+            }
+            num = (y > 0) * n + (x > 0) * n;
+            v->pred[v->count] = num ? (sum + num / 2) / num : 128;
+            v->count++;
+          }
+        }
+      }
+    }
+  }
+  video_input_close(&vid);
+}
+
+int main(int _argc, char **_argv) {
+  int64_t num_random;
+  int num_threads;
+  int force_c = 0;
+  int caps;
+  VIDEO_BLOCKS video[NUM_SIZES];
+  TXFM_JOB jobs[MAX_THREADS];
+  pthread_t threads[MAX_THREADS];
+  int source;
+  int s;
+  int f;
+  int t;
+
+  // --force-c runs the C versions of the AOM transforms.
+  if (_argc > 1 && !strcmp(_argv[1], "--force-c")) {
+    force_c = 1;
+    _argc--;
+    _argv++;
+  }
+  num_random = _argc > 1 ? atoll(_argv[1]) : 100000;
+  num_threads = _argc > 2 ? atoi(_argv[2]) : 1;
+  if (_argc > 4 || num_random < 0 || num_threads < 1
+      || num_threads > MAX_THREADS) {
+    fprintf(stderr, "usage: compare [--force-c] [random_blocks] [threads] "
+            "[video.y4m]\n");
+    fprintf(stderr, "Number of threads must be between 1 and %d\n",
+            MAX_THREADS);
+    return -1;
+  }
+  aom_txfm_rtcd(force_c);
+  set_aom_family(&families[0]);
+  caps = x86_simd_caps();
+  if (_argc > 3) {
+    load_video(_argv[3], video);
+  } else {
+    memset(video, 0, sizeof(video));
+  }
+
+  printf("| Source | Size  | Transform    | Blocks   | Exact   | PSNR (dB) "
+         "| Max err | Max coef | Coef bits | Gain  | Fwd ns  | Inv ns  "
+         "| Mblocks/s |\n");
+  printf("| ------ | ----- | ------------ | -------- | ------- | --------- "
+         "| ------- | -------- | --------- | ----- | ------- | ------- "
+         "| --------- |\n");
+  for (source = 0; source < NUM_SOURCES; source++) {
+    for (s = 0; s < NUM_SIZES; s++) {
+      const int n = 4 << s;
+      const int64_t count =
+          source == SOURCE_VIDEO ? video[s].count : num_random;
+      if (count == 0) continue;
+      for (f = 0; f < NUM_FAMILIES; f++) {
+        TXFM_STATS total;
+        double wall;
+        double psnr;
+        if ((families[f].caps & caps) != families[f].caps) continue;
+        memset(&total, 0, sizeof(total));
+        wall = wall_time();
+        for (t = 0; t < num_threads; t++) {
+          jobs[t].family = &families[f];
+          jobs[t].size_idx = s;
+          jobs[t].source = source;
+          jobs[t].video = &video[s];
+          jobs[t].first = count * t / num_threads;
+          jobs[t].count = count * (t + 1) / num_threads - jobs[t].first;
+          pthread_create(&threads[t], NULL, process_job, &jobs[t]);
+        }
+        for (t = 0; t < num_threads; t++) {
+          pthread_join(threads[t], NULL);
+          stats_add(&total, &jobs[t].stats);
+        }
+        wall = wall_time() - wall;
+        psnr = total.sse ? 10 * log10(255.0 * 255 * n * n * total.blocks
+                                      / total.sse)
+                         : INFINITY;
+        printf("| %-6s | %2dx%-2d | %-12s | %8ld | %6.2f%% | %9.2f "
+               "| %7d | %8d | %9d | %5.2f | %7.1f | %7.1f | %9.3f |\n",
+               source_names[source], n, n, families[f].name,
+               (long)total.blocks, 100.0 * total.exact_blocks / total.blocks,
+               psnr, total.max_err, total.max_coef,
+               signed_bits(total.max_coef),
+               sqrt(total.coef_energy / AOMMAX(total.res_energy, 1)),
+               total.fwd_time * 1e9 / total.blocks,
+               total.inv_time * 1e9 / total.blocks,
+               total.blocks * 1e-6 / wall);
+      }
+    }
+  }
+  for (s = 0; s < NUM_SIZES; s++) {
+    free(video[s].pixels);
+    free(video[s].pred);
+  }
+  return 0;
+}
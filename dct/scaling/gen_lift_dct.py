@@ -0,0 +1,420 @@
+#!/usr/bin/env python3
+"""Generate reversible, orthonormal lifting DCTs of size 8, 16 and 32 from the
+butterfly structure of AV1's forward DCTs. They use Daala's lifting
+butterflies, but they are not Daala's factorizations (od_bin_fdct8/16/32).
+
+The flow graph of av1_fdctN_kernel (av1_fwd_txfm1d_kernels.h, or
+av1_fdctN_new in older trees) is made of +1/-1 butterflies and rotations.
+Each value is tracked with a scale of +-sqrt(2)^e relative to its
+orthonormal value:
+
+  * Butterflies become Daala's asymmetric lifting butterflies
+    (t1 = t0 - t1; t0 -= OD_DCT_RSHIFT(t1, 1)), one output gets e + 1 and the
+    other e - 1. Inputs with different (even) e are combined with shifts.
+  * Rotations become 3 lifting steps. They can change the scales of their
+    outputs (the determinant stays 1), which brings them back to e = 0.
+  * 45 degree rotations can be done as butterflies (no multiply) when the
+    scales allow it.
+
+A search picks the scales so that all outputs are orthonormal (e = 0) while
+minimizing the number of multiplies. All steps are lifting steps, so the
+inverse is exact.
+
+usage: gen_lift_dct.py path/to/av1_fwd_txfm1d_kernels.h > lift_dct_gen.c
+       gen_lift_dct.py --simd path/to/av1_fwd_txfm1d_kernels.h \
+           > lift_dct_kernels.h
+
+With --simd, the same lifting steps are written with the OD_ADD, OD_SUB,
+OD_SHL, OD_RSHIFT, OD_MUL and OD_NEG macros on od_simd vectors (see
+lift_dct_simd.h), one lane per column.
+"""
+import math
+import re
+import sys
+
+SQ2 = math.sqrt(2)
+SEARCH_LIMIT = 2000000
+
+
+def cospi(n):
+  return math.cos(n * math.pi / 128)
+
+
+def wval(w):
+  return math.copysign(cospi(abs(w)), w)
+
+
+def parse(src, n):
+  """Symbolic execution of av1_fdct<n>_kernel (or _new). Returns the output
+  nodes and the nodes as ('add', stage, sign, a, sign, b) or
+  ('btf', stage, w, a, w, b)."""
+  m = re.search(r'void av1_fdct%d_(?:new|kernel)\(.*?\n}\n' % n, src, re.S)
+  bufs = {'input': [('in', i) for i in range(n)], 'output': [None] * n,
+          'step': [None] * n}
+  alias = {}
+  nodes = {}
+  stage = 0
+
+  def ref(s):
+    r = re.match(r'(-?)(\w+)\[(\d+)\]', s.strip())
+    return (-1 if r.group(1) else 1), \
+        bufs[alias.get(r.group(2), r.group(2))][int(r.group(3))]
+
+  def weight(s):
+    r = re.match(r'(-?)cospi\[(\d+)\]', s.strip())
+    return (-1 if r.group(1) else 1) * int(r.group(2))
+
+  for line in m.group(0).split('\n'):
+    line = line.strip()
+    if line.startswith('stage++'):
+      stage += 1
+      continue
+    a = re.match(r'(bf[01]) = (\w+);', line)
+    if a:
+      alias[a.group(1)] = a.group(2)
+      continue
+    a = re.match(r'(bf1|output)\[(\d+)\] = (.*);', line)
+    if not a:
+      continue
+    dst = bufs[alias.get(a.group(1), a.group(1))]
+    i = int(a.group(2))
+    # The shifts folded into the first and last stages are not part of the
+    # graph.
+    e = re.sub(r'^txfm_shift_(?:in|out)\((.*), \w+_shift\)$', r'\1',
+               a.group(3))
+    if e.startswith('half_btf'):
+      args = e[len('half_btf('):-1].split(',')
+      node = ('n', len(nodes))
+      nodes[node] = ('btf', stage, weight(args[0]), ref(args[1])[1],
+                     weight(args[2]), ref(args[3])[1])
+      dst[i] = node
+    elif '+' in e:
+      x, y = e.split('+')
+      sx, na = ref(x)
+      sy, nb = ref(y)
+      node = ('n', len(nodes))
+      nodes[node] = ('add', stage, sx, na, sy, nb)
+      dst[i] = node
+    else:
+      dst[i] = ref(e)[1]
+  return bufs['output'], nodes
+
+
+def build_pairs(src, n):
+  """Group nodes operating on the same two inputs. Each pair has the
+  orthonormal 2x2 matrix from its inputs to its outputs."""
+  outs, nodes = parse(src, n)
+  groups = {}
+  order = []
+  for k, d in sorted(nodes.items(), key=lambda kv: kv[0][1]):
+    key = (d[1], frozenset([d[3], d[5]]))
+    if key not in groups:
+      groups[key] = []
+      order.append(key)
+    groups[key].append(k)
+  pairs = []
+  for key in order:
+    ks = groups[key]
+    assert len(ks) == 2
+    a = nodes[ks[0]][3]
+    b = nodes[ks[0]][5]
+    rows = []
+    for k in ks:
+      d = nodes[k]
+      if d[0] == 'add':
+        # Normalized butterfly: (a +- b)/sqrt(2)
+        ca = d[2] if d[3] == a else d[4]
+        cb = d[4] if d[5] == b else d[2]
+        rows.append((k, ca / SQ2, cb / SQ2))
+      else:
+        ca = wval(d[2]) if d[3] == a else wval(d[4])
+        cb = wval(d[4]) if d[5] == b else wval(d[2])
+        rows.append((k, ca, cb))
+    kind = 'add' if nodes[ks[0]][0] == 'add' else 'rot'
+    if kind == 'rot' and all(abs(abs(r[1]) - 1 / SQ2) < 1e-12
+                             and abs(abs(r[2]) - 1 / SQ2) < 1e-12 for r in rows):
+      kind = 'rot45'
+    pairs.append((kind, a, b, rows))
+  return outs, pairs
+
+
+def search(outs, pairs, n, maxe=1):
+  """Depth first search of the scale of each value (branch and bound on the
+  number of multiplies)."""
+  cons = {}
+  for (kind, a, b, rows) in pairs:
+    cons[a] = b
+    cons[b] = a
+  finals = set(outs)
+  best = [None]
+  state = dict((('in', i), 0) for i in range(n))
+  count = [0]
+  sys.setrecursionlimit(10000)
+
+  def score(u, w, eu, ew):
+    sc = 0
+    for node, e in ((u, eu), (w, ew)):
+      if abs(e) > maxe:
+        return None
+      if node in finals:
+        if e != 0:
+          return None
+      elif node in cons:
+        partner = cons[node]
+        if partner in state:
+          if (state[partner] - e) % 2:
+            return None
+          sc += abs(state[partner] + e)
+        sc += abs(e) * 0.1
+    return sc
+
+  def rec(i, cost, choices):
+    count[0] += 1
+    if count[0] > SEARCH_LIMIT:
+      return
+    if best[0] and cost >= best[0][0]:
+      return
+    if i == len(pairs):
+      best[0] = (cost, list(choices))
+      return
+    kind, a, b, rows = pairs[i]
+    p = state[a]
+    q = state[b]
+    u = rows[0][0]
+    w = rows[1][0]
+    opts = []
+    if kind in ('add', 'rot45') and (p - q) % 2 == 0:
+      for eu, ew in ((p + 1, q - 1), (q + 1, p - 1), (q - 1, p + 1),
+                     (p - 1, q + 1)):
+        opts.append((0, ('bf', eu, ew)))
+    if kind in ('rot', 'rot45'):
+      for eu in range(-maxe, maxe + 1):
+        opts.append((3, ('rot', eu, p + q - eu)))
+    scored = []
+    for c, o in opts:
+      s = score(u, w, o[1], o[2])
+      if s is not None:
+        scored.append((c + s, c, o))
+    scored.sort(key=lambda t: t[0])
+    seen = set()
+    for _, c, o in scored:
+      if o in seen:
+        continue
+      seen.add(o)
+      state[u] = o[1]
+      state[w] = o[2]
+      choices.append(o)
+      rec(i + 1, cost + c, choices)
+      choices.pop()
+      del state[u]
+      del state[w]
+
+  rec(0, 0, [])
+  return best[0][1]
+
+
+def factor(m):
+  """3 lifting steps (dst, src, coef) for a 2x2 matrix with determinant 1."""
+  (a, b), (c, d) = m
+  res = []
+  if abs(c) > 1e-9:
+    res.append([(0, 1, (d - 1) / c), (1, 0, c), (0, 1, (a - 1) / c)])
+  if abs(b) > 1e-9:
+    res.append([(1, 0, (a - 1) / b), (0, 1, b), (1, 0, (d - 1) / b)])
+  return res
+
+
+def lifting(outs, pairs, choices, n):
+  """Lifting steps (dst, src, sign, power of two, coef) and the slot and sign
+  of each output."""
+  ops = []
+  st = dict((('in', i), (i, 1, 0)) for i in range(n))
+  for (kind, a, b, rows), ch in zip(pairs, choices):
+    sa, ga, ea = st.pop(a)
+    sb, gb, eb = st.pop(b)
+    (u, cua, cub), (w, cwa, cwb) = rows
+    eu, ew = ch[1], ch[2]
+    if ch[0] == 'bf':
+      # Orthonormal sum P = (a + b)/sqrt(2) or difference M = (a - b)/sqrt(2)
+      def pm(ca, cb):
+        return ('P' if (ca > 0) == (cb > 0) else 'M'), (1 if ca > 0 else -1)
+      tu, su = pm(cua, cub)
+      tw, sw = pm(cwa, cwb)
+      rs = ga * gb
+      h = (ea - eb) // 2
+      variants = [
+          ((sa, 'M', ga, ea + 1), (sb, 'P', gb, eb - 1),
+           [(sa, sb, -rs, h), (sb, sa, rs, -h - 1)]),
+          ((sb, 'M', -gb, eb + 1), (sa, 'P', ga, ea - 1),
+           [(sb, sa, -rs, -h), (sa, sb, rs, h - 1)]),
+          ((sa, 'P', ga, ea + 1), (sb, 'M', -gb, eb - 1),
+           [(sa, sb, rs, h), (sb, sa, -rs, -h - 1)]),
+          ((sb, 'P', gb, eb + 1), (sa, 'M', ga, ea - 1),
+           [(sb, sa, rs, -h), (sa, sb, -rs, h - 1)]),
+      ]
+      for r0, r1, steps in variants:
+        e = {r0[1]: r0[3], r1[1]: r1[3]}
+        if e[tu] == eu and e[tw] == ew:
+          ops += [(d, s, g, p, None) for d, s, g, p in steps]
+          for slot, t, g, ex in (r0, r1):
+            if t == tu:
+              st[u] = (slot, g * su, ex)
+            else:
+              st[w] = (slot, g * sw, ex)
+          break
+      else:
+        assert False
+    else:
+      r = [[cua, cub], [cwa, cwb]]
+      ka = ga * 2 ** (ea / 2)
+      kb = gb * 2 ** (eb / 2)
+      best = None
+      for swap in (0, 1):
+        for gu in (1, -1):
+          ku = gu * 2 ** (eu / 2)
+          kw = 2 ** (ew / 2)
+          m = [[ku * r[0][0] / ka, ku * r[0][1] / kb],
+               [kw * r[1][0] / ka, kw * r[1][1] / kb]]
+          gw = 1 if m[0][0] * m[1][1] - m[0][1] * m[1][0] > 0 else -1
+          m[1] = [x * gw for x in m[1]]
+          if swap:
+            m = [m[1], [-x for x in m[0]]]
+          for f in factor(m):
+            cost = max(abs(x) for _, _, x in f)
+            if best is None or cost < best[0]:
+              best = (cost, swap, gu, gw, f)
+      _, swap, gu, gw, f = best
+      slots = (sa, sb)
+      ops += [(slots[d], slots[s], 1, None, c) for d, s, c in f]
+      if swap:
+        st[w] = (sa, gw, ew)
+        st[u] = (sb, -gu, eu)
+      else:
+        st[u] = (sa, gu, eu)
+        st[w] = (sb, gw, ew)
+  final = [st[o] for o in outs]
+  assert all(e == 0 for _, _, e in final)
+  return ops, final
+
+
+def frac(c):
+  """P/2^B ~= |c| with P < 32768."""
+  a = abs(c)
+  b = 15
+  while a * (1 << b) >= 32767.5:
+    b -= 1
+  p = int(round(a * (1 << b)))
+  while p and p % 2 == 0 and b > 0:
+    p //= 2
+    b -= 1
+  return p, b
+
+
+def lifting_steps(ops, simd):
+  """C expressions of the lifting steps: (dst, sign, expression, comment)."""
+  steps = []
+  adds = shifts = muls = 0
+  for dst, src, sign, p2, coef in ops:
+    t = ('t[%d]' if simd else 't%d') % src
+    if coef is None:
+      if p2 == 0:
+        e = t
+      elif p2 > 0:
+        e = ('OD_SHL(%s, %d)' % (t, p2)) if simd else '%s*%d' % (t, 1 << p2)
+      else:
+        e = ('OD_RSHIFT(%s, %d)' if simd else 'OD_DCT_RSHIFT(%s, %d)') % \
+            (t, -p2)
+        shifts += 1
+      steps.append((dst, sign, e, None))
+    else:
+      p, b = frac(coef)
+      if p == 0:
+        continue
+      muls += 1
+      if simd:
+        e = 'OD_MUL(%s, %d, %d)' % (t, p, b)
+      else:
+        e = '(%s*%d + %d) >> %d' % (t, p, 1 << (b - 1), b) if b else \
+            '%s*%d' % (t, p)
+      steps.append((dst, 1 if coef > 0 else -1, e,
+                    '/*%d/%d ~= %.17g*/' % (p, 1 << b, abs(coef))))
+    adds += 1
+  return steps, '  /*%d adds, %d shifts, %d "muls".*/' % (adds, shifts, muls)
+
+
+def simd_code(n, ops, final):
+  steps, head = lifting_steps(ops, True)
+
+  def body(inverse, var):
+    out = []
+    for dst, sign, e, comment in (reversed(steps) if inverse else steps):
+      if comment:
+        out.append('  ' + comment)
+      op = 'OD_SUB' if (sign < 0) != inverse else 'OD_ADD'
+      out.append('  %s[%d] = %s(%s[%d], %s);' % (var, dst, op, var, dst,
+                                                 e.replace('t[', var + '[')))
+    return out
+
+  f = ['static INLINE void od_fdct%d_simd(od_simd *out, od_simd *t) {' % n,
+       head]
+  f += body(False, 't')
+  f += ['  out[%d] = %s;' % (k, ('OD_NEG(t[%d])' if g < 0 else 't[%d]') % s)
+        for k, (s, g, _) in enumerate(final)]
+  f.append('}')
+  g = ['static INLINE void od_idct%d_simd(od_simd *out, od_simd *t) {' % n,
+       head]
+  g += ['  out[%d] = %s;' % (s, ('OD_NEG(t[%d])' if gg < 0 else 't[%d]') % k)
+        for k, (s, gg, _) in enumerate(final)]
+  g += body(True, 'out')
+  g.append('}')
+  return '\n'.join(f) + '\n\n' + '\n'.join(g) + '\n'
+
+
+def c_code(n, ops, final):
+  steps, head = lifting_steps(ops, False)
+
+  def body(inverse):
+    out = []
+    for dst, sign, e, comment in (reversed(steps) if inverse else steps):
+      if comment:
+        out.append('  ' + comment)
+      out.append('  t%d %s= %s;' % (dst, '-' if (sign < 0) != inverse else '+',
+                                    e))
+    return out
+
+  decl = ['  int t%d;' % i for i in range(n)]
+  f = ['void lift_fdct%d(const tran_low_t *input, tran_low_t *output) {' % n,
+       head] + decl
+  f += ['  t%d = input[%d];' % (i, i) for i in range(n)]
+  f += body(False)
+  f += ['  output[%d] = (tran_low_t)%st%d;' % (k, '-' if g < 0 else '', s)
+        for k, (s, g, _) in enumerate(final)]
+  f.append('}')
+  g = ['void lift_idct%d(const tran_low_t *input, tran_low_t *output) {' % n,
+       head] + decl
+  g += ['  t%d = %sinput[%d];' % (s, '-' if gg < 0 else '', k)
+        for k, (s, gg, _) in enumerate(final)]
+  g += body(True)
+  g += ['  output[%d] = (tran_low_t)t%d;' % (i, i) for i in range(n)]
+  g.append('}')
+  return '\n'.join(f) + '\n\n' + '\n'.join(g) + '\n'
+
+
+def main():
+  simd = sys.argv[1] == '--simd'
+  src = open(sys.argv[-1]).read()
+  out = []
+  for n in (8, 16, 32):
+    outs, pairs = build_pairs(src, n)
+    choices = search(outs, pairs, n)
+    ops, final = lifting(outs, pairs, choices, n)
+    out.append((simd_code if simd else c_code)(n, ops, final))
+  if simd:
+    out.insert(0, '/* Generated by gen_lift_dct.py --simd, do not edit. */\n'
+               '#ifndef LIFT_DCT_KERNELS_H_\n#define LIFT_DCT_KERNELS_H_\n')
+    out.append('#endif  // LIFT_DCT_KERNELS_H_\n')
+  sys.stdout.write('\n'.join(out))
+
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,1495 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#include <assert.h>
+
+#include "lift_dct.h"
+
+void daala_fdct4(const tran_low_t *input, tran_low_t *output) {
+
+  /*9 adds, 2 shifts, 3 "muls".*/
+  int t0;
+  int t1;
+  int t2;
+  int t2h;
+  int t3;
+  /*Initial permutation:*/
+  t0 = input[0];
+  t2 = input[1];
+  t1 = input[2];
+  t3 = input[3];
+  /*+1/-1 butterflies:*/
+  t3 = t0 - t3;
+  t2 += t1;
+  t2h = OD_DCT_RSHIFT(t2, 1);
+  t1 = t2h - t1;
+  t0 -= OD_DCT_RSHIFT(t3, 1);
+  /*+ Embedded 2-point type-II DCT.*/
+  t0 += t2h;
+  t2 = t0 - t2;
+  /*+ Embedded 2-point type-IV DST.*/
+  /*23013/32768 ~= 4*sin(\frac{\pi}{8}) - 2*tan(\frac{\pi}{8}) ~=
+    0.70230660471416898931046248770220*/
+  //OD_DCT_OVERFLOW_CHECK(t1, 23013, 16384, 0);
+  t3 -= (t1*23013 + 16384) >> 15;
+  /*21407/32768~=\sqrt{1/2}*cos(\frac{\pi}{8}))
+    ~=0.65328148243818826392832158671359*/
+  //OD_DCT_OVERFLOW_CHECK(t3, 21407, 16384, 1);
+  t1 += (t3*21407 + 16384) >> 15;
+  /*18293/16384 ~= 4*sin(\frac{\pi}{8}) - tan(\frac{\pi}{8}) ~=
+    1.1165201670872640381121512119119*/
+  //OD_DCT_OVERFLOW_CHECK(t1, 18293, 8192, 2);
+  t3 -= (t1*18293 + 8192) >> 14;
+
+  // Checking for overflow since Daala code uses 32bit ints.
+  assert(t0 < 32767 && t0 > -32767);
+  assert(t1 < 32767 && t1 > -32767);
+  assert(t2 < 32767 && t2 > -32767);
+  assert(t3 < 32767 && t3 > -32767);
+
+  output[0] = (tran_low_t)t0;
+  output[1] = (tran_low_t)t1;
+  output[2] = (tran_low_t)t2;
+  output[3] = (tran_low_t)t3;
+}
+
+void daala_idct4(const tran_low_t *input, tran_low_t *output) {
+  int t0;
+  int t1;
+  int t2;
+  int t2h;
+  int t3;
+  t0 = input[0];
+  t1 = input[1];
+  t2 = input[2];
+  t3 = input[3];
+  t3 += (t1*18293 + 8192) >> 14;
+  t1 -= (t3*21407 + 16384) >> 15;
+  t3 += (t1*23013 + 16384) >> 15;
+  t2 = t0 - t2;
+  t2h = OD_DCT_RSHIFT(t2, 1);
+  t0 -= t2h - OD_DCT_RSHIFT(t3, 1);
+  t1 = t2h - t1;
+  output[0] = (tran_low_t)t0;
+  output[1] = (tran_low_t)(t2 - t1);
+  output[2] = (tran_low_t)t1;
+  output[3] = (tran_low_t)(t0 - t3);
+}
+
+/* The 8, 16 and 32 point DCTs below are generated by gen_lift_dct.py from
+ * the butterfly structure of AV1's DCTs (see README.md). */
+
+void lift_fdct8(const tran_low_t *input, tran_low_t *output) {
+  /*31 adds, 8 shifts, 15 "muls".*/
+  int t0;
+  int t1;
+  int t2;
+  int t3;
+  int t4;
+  int t5;
+  int t6;
+  int t7;
+  t0 = input[0];
+  t1 = input[1];
+  t2 = input[2];
+  t3 = input[3];
+  t4 = input[4];
+  t5 = input[5];
+  t6 = input[6];
+  t7 = input[7];
+  t0 += t7;
+  t7 -= OD_DCT_RSHIFT(t0, 1);
+  t1 += t6;
+  t6 -= OD_DCT_RSHIFT(t1, 1);
+  t2 -= t5;
+  t5 += OD_DCT_RSHIFT(t2, 1);
+  t3 -= t4;
+  t4 += OD_DCT_RSHIFT(t3, 1);
+  t4 -= OD_DCT_RSHIFT(t0, 1);
+  t0 += t4;
+  t5 -= OD_DCT_RSHIFT(t1, 1);
+  t1 += t5;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t2 -= (t6*13573 + 8192) >> 14;
+  /*11585/32768 ~= 0.35355339059327384*/
+  t6 += (t2*11585 + 16384) >> 15;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t2 -= (t6*13573 + 8192) >> 14;
+  /*13573/32768 ~= 0.41421356237309498*/
+  t0 += (t1*13573 + 16384) >> 15;
+  /*11585/16384 ~= 0.70710678118654757*/
+  t1 -= (t0*11585 + 8192) >> 14;
+  /*13573/32768 ~= 0.41421356237309498*/
+  t0 += (t1*13573 + 16384) >> 15;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t5 -= (t4*3259 + 8192) >> 14;
+  /*3135/8192 ~= 0.38268343236508984*/
+  t4 += (t5*3135 + 4096) >> 13;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t5 -= (t4*3259 + 8192) >> 14;
+  t6 += OD_DCT_RSHIFT(t3, 1);
+  t3 -= t6;
+  t7 += OD_DCT_RSHIFT(t2, 1);
+  t2 -= t7;
+  /*3227/32768 ~= 0.098491403357164317*/
+  t3 -= (t2*3227 + 16384) >> 15;
+  /*6393/32768 ~= 0.19509032201612833*/
+  t2 += (t3*6393 + 16384) >> 15;
+  /*3227/32768 ~= 0.098491403357164317*/
+  t3 -= (t2*3227 + 16384) >> 15;
+  /*2485/8192 ~= 0.30334668360734235*/
+  t6 -= (t7*2485 + 4096) >> 13;
+  /*18205/32768 ~= 0.55557023301960229*/
+  t7 += (t6*18205 + 16384) >> 15;
+  /*2485/8192 ~= 0.30334668360734235*/
+  t6 -= (t7*2485 + 4096) >> 13;
+  output[0] = (tran_low_t)t0;
+  output[1] = (tran_low_t)t2;
+  output[2] = (tran_low_t)-t4;
+  output[3] = (tran_low_t)-t7;
+  output[4] = (tran_low_t)-t1;
+  output[5] = (tran_low_t)t6;
+  output[6] = (tran_low_t)t5;
+  output[7] = (tran_low_t)-t3;
+}
+
+void lift_idct8(const tran_low_t *input, tran_low_t *output) {
+  /*31 adds, 8 shifts, 15 "muls".*/
+  int t0;
+  int t1;
+  int t2;
+  int t3;
+  int t4;
+  int t5;
+  int t6;
+  int t7;
+  t0 = input[0];
+  t2 = input[1];
+  t4 = -input[2];
+  t7 = -input[3];
+  t1 = -input[4];
+  t6 = input[5];
+  t5 = input[6];
+  t3 = -input[7];
+  /*2485/8192 ~= 0.30334668360734235*/
+  t6 += (t7*2485 + 4096) >> 13;
+  /*18205/32768 ~= 0.55557023301960229*/
+  t7 -= (t6*18205 + 16384) >> 15;
+  /*2485/8192 ~= 0.30334668360734235*/
+  t6 += (t7*2485 + 4096) >> 13;
+  /*3227/32768 ~= 0.098491403357164317*/
+  t3 += (t2*3227 + 16384) >> 15;
+  /*6393/32768 ~= 0.19509032201612833*/
+  t2 -= (t3*6393 + 16384) >> 15;
+  /*3227/32768 ~= 0.098491403357164317*/
+  t3 += (t2*3227 + 16384) >> 15;
+  t2 += t7;
+  t7 -= OD_DCT_RSHIFT(t2, 1);
+  t3 += t6;
+  t6 -= OD_DCT_RSHIFT(t3, 1);
+  /*3259/16384 ~= 0.19891236737965801*/
+  t5 += (t4*3259 + 8192) >> 14;
+  /*3135/8192 ~= 0.38268343236508984*/
+  t4 -= (t5*3135 + 4096) >> 13;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t5 += (t4*3259 + 8192) >> 14;
+  /*13573/32768 ~= 0.41421356237309498*/
+  t0 -= (t1*13573 + 16384) >> 15;
+  /*11585/16384 ~= 0.70710678118654757*/
+  t1 += (t0*11585 + 8192) >> 14;
+  /*13573/32768 ~= 0.41421356237309498*/
+  t0 -= (t1*13573 + 16384) >> 15;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t2 += (t6*13573 + 8192) >> 14;
+  /*11585/32768 ~= 0.35355339059327384*/
+  t6 -= (t2*11585 + 16384) >> 15;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t2 += (t6*13573 + 8192) >> 14;
+  t1 -= t5;
+  t5 += OD_DCT_RSHIFT(t1, 1);
+  t0 -= t4;
+  t4 += OD_DCT_RSHIFT(t0, 1);
+  t4 -= OD_DCT_RSHIFT(t3, 1);
+  t3 += t4;
+  t5 -= OD_DCT_RSHIFT(t2, 1);
+  t2 += t5;
+  t6 += OD_DCT_RSHIFT(t1, 1);
+  t1 -= t6;
+  t7 += OD_DCT_RSHIFT(t0, 1);
+  t0 -= t7;
+  output[0] = (tran_low_t)t0;
+  output[1] = (tran_low_t)t1;
+  output[2] = (tran_low_t)t2;
+  output[3] = (tran_low_t)t3;
+  output[4] = (tran_low_t)t4;
+  output[5] = (tran_low_t)t5;
+  output[6] = (tran_low_t)t6;
+  output[7] = (tran_low_t)t7;
+}
+
+void lift_fdct16(const tran_low_t *input, tran_low_t *output) {
+  /*86 adds, 25 shifts, 36 "muls".*/
+  int t0;
+  int t1;
+  int t2;
+  int t3;
+  int t4;
+  int t5;
+  int t6;
+  int t7;
+  int t8;
+  int t9;
+  int t10;
+  int t11;
+  int t12;
+  int t13;
+  int t14;
+  int t15;
+  t0 = input[0];
+  t1 = input[1];
+  t2 = input[2];
+  t3 = input[3];
+  t4 = input[4];
+  t5 = input[5];
+  t6 = input[6];
+  t7 = input[7];
+  t8 = input[8];
+  t9 = input[9];
+  t10 = input[10];
+  t11 = input[11];
+  t12 = input[12];
+  t13 = input[13];
+  t14 = input[14];
+  t15 = input[15];
+  t0 += t15;
+  t15 -= OD_DCT_RSHIFT(t0, 1);
+  t1 += t14;
+  t14 -= OD_DCT_RSHIFT(t1, 1);
+  t2 += t13;
+  t13 -= OD_DCT_RSHIFT(t2, 1);
+  t3 += t12;
+  t12 -= OD_DCT_RSHIFT(t3, 1);
+  t4 -= t11;
+  t11 += OD_DCT_RSHIFT(t4, 1);
+  t5 -= t10;
+  t10 += OD_DCT_RSHIFT(t5, 1);
+  t6 -= t9;
+  t9 += OD_DCT_RSHIFT(t6, 1);
+  t7 -= t8;
+  t8 += OD_DCT_RSHIFT(t7, 1);
+  t8 -= OD_DCT_RSHIFT(t0, 1);
+  t0 += t8;
+  t9 -= OD_DCT_RSHIFT(t1, 1);
+  t1 += t9;
+  t10 -= OD_DCT_RSHIFT(t2, 1);
+  t2 += t10;
+  t11 -= OD_DCT_RSHIFT(t3, 1);
+  t3 += t11;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t5 -= (t13*13573 + 8192) >> 14;
+  /*11585/32768 ~= 0.35355339059327384*/
+  t13 += (t5*11585 + 16384) >> 15;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t5 -= (t13*13573 + 8192) >> 14;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t4 -= (t12*13573 + 8192) >> 14;
+  /*11585/32768 ~= 0.35355339059327384*/
+  t12 += (t4*11585 + 16384) >> 15;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t4 -= (t12*13573 + 8192) >> 14;
+  t0 += t3;
+  t3 -= OD_DCT_RSHIFT(t0, 1);
+  t1 -= t2;
+  t2 += OD_DCT_RSHIFT(t1, 1);
+  /*13573/32768 ~= 0.41421356237309498*/
+  t10 -= (t9*13573 + 16384) >> 15;
+  /*11585/16384 ~= 0.70710678118654757*/
+  t9 += (t10*11585 + 8192) >> 14;
+  /*13573/32768 ~= 0.41421356237309498*/
+  t10 -= (t9*13573 + 16384) >> 15;
+  t12 += OD_DCT_RSHIFT(t7, 1);
+  t7 -= t12;
+  t13 += OD_DCT_RSHIFT(t6, 1);
+  t6 -= t13;
+  t15 += OD_DCT_RSHIFT(t4, 1);
+  t4 -= t15;
+  t14 += OD_DCT_RSHIFT(t5, 1);
+  t5 -= t14;
+  t2 -= OD_DCT_RSHIFT(t0, 1);
+  t0 += t2;
+  /*20993/32768 ~= 0.64065228383602613*/
+  t3 -= (t1*20993 + 16384) >> 15;
+  /*8867/16384 ~= 0.54119610014619701*/
+  t1 += (t3*8867 + 8192) >> 14;
+  /*9281/16384 ~= 0.56645449735052122*/
+  t3 += (t1*9281 + 8192) >> 14;
+  t11 -= t10;
+  t10 += OD_DCT_RSHIFT(t11, 1);
+  t9 -= t8;
+  t8 += OD_DCT_RSHIFT(t9, 1);
+  /*3259/16384 ~= 0.19891236737965801*/
+  t6 -= (t5*3259 + 8192) >> 14;
+  /*3135/8192 ~= 0.38268343236508984*/
+  t5 += (t6*3135 + 4096) >> 13;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t6 -= (t5*3259 + 8192) >> 14;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t13 += (t14*3259 + 8192) >> 14;
+  /*3135/8192 ~= 0.38268343236508984*/
+  t14 -= (t13*3135 + 4096) >> 13;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t13 += (t14*3259 + 8192) >> 14;
+  /*8553/8192 ~= 1.0440949092545799*/
+  t11 += (t8*8553 + 4096) >> 13;
+  /*22725/32768 ~= 0.69351992266107365*/
+  t8 -= (t11*22725 + 16384) >> 15;
+  /*20365/16384 ~= 1.2430072766342379*/
+  t11 += (t8*20365 + 8192) >> 14;
+  /*17185/32768 ~= 0.5244556992400895*/
+  t10 -= (t9*17185 + 16384) >> 15;
+  /*12873/16384 ~= 0.78569495838710224*/
+  t9 += (t10*12873 + 8192) >> 14;
+  /*7335/32768 ~= 0.22384718209265494*/
+  t10 += (t9*7335 + 16384) >> 15;
+  t7 -= t6;
+  t6 += OD_DCT_RSHIFT(t7, 1);
+  t14 -= t12;
+  t12 += OD_DCT_RSHIFT(t14, 1);
+  t15 += t13;
+  t13 -= OD_DCT_RSHIFT(t15, 1);
+  t5 -= t4;
+  t4 += OD_DCT_RSHIFT(t5, 1);
+  /*20055/16384 ~= 1.2240735303358696*/
+  t7 += (t4*20055 + 8192) >> 14;
+  /*23059/32768 ~= 0.70370186876319119*/
+  t4 -= (t7*23059 + 16384) >> 15;
+  /*21669/16384 ~= 1.3225649336930341*/
+  t7 += (t4*21669 + 8192) >> 14;
+  /*1035/2048 ~= 0.50536719493782989*/
+  t6 -= (t5*1035 + 1024) >> 11;
+  /*14699/16384 ~= 0.89716758634263616*/
+  t5 += (t6*14699 + 8192) >> 14;
+  /*851/8192 ~= 0.10388456785615832*/
+  t6 += (t5*851 + 4096) >> 13;
+  /*18501/32768 ~= 0.5645905629393656*/
+  t13 -= (t14*18501 + 16384) >> 15;
+  /*21845/32768 ~= 0.66665565847774666*/
+  t14 += (t13*21845 + 16384) >> 15;
+  /*1519/4096 ~= 0.37084364295532879*/
+  t13 += (t14*1519 + 2048) >> 12;
+  /*25809/32768 ~= 0.78762894232967462*/
+  t12 -= (t15*25809 + 16384) >> 15;
+  /*3363/8192 ~= 0.4105245275223573*/
+  t15 += (t12*3363 + 4096) >> 13;
+  /*14101/16384 ~= 0.86065016213948586*/
+  t12 += (t15*14101 + 8192) >> 14;
+  output[0] = (tran_low_t)t0;
+  output[1] = (tran_low_t)t7;
+  output[2] = (tran_low_t)-t11;
+  output[3] = (tran_low_t)-t15;
+  output[4] = (tran_low_t)-t3;
+  output[5] = (tran_low_t)t13;
+  output[6] = (tran_low_t)t9;
+  output[7] = (tran_low_t)-t5;
+  output[8] = (tran_low_t)-t2;
+  output[9] = (tran_low_t)t6;
+  output[10] = (tran_low_t)-t10;
+  output[11] = (tran_low_t)t14;
+  output[12] = (tran_low_t)-t1;
+  output[13] = (tran_low_t)t12;
+  output[14] = (tran_low_t)-t8;
+  output[15] = (tran_low_t)t4;
+}
+
+void lift_idct16(const tran_low_t *input, tran_low_t *output) {
+  /*86 adds, 25 shifts, 36 "muls".*/
+  int t0;
+  int t1;
+  int t2;
+  int t3;
+  int t4;
+  int t5;
+  int t6;
+  int t7;
+  int t8;
+  int t9;
+  int t10;
+  int t11;
+  int t12;
+  int t13;
+  int t14;
+  int t15;
+  t0 = input[0];
+  t7 = input[1];
+  t11 = -input[2];
+  t15 = -input[3];
+  t3 = -input[4];
+  t13 = input[5];
+  t9 = input[6];
+  t5 = -input[7];
+  t2 = -input[8];
+  t6 = input[9];
+  t10 = -input[10];
+  t14 = input[11];
+  t1 = -input[12];
+  t12 = input[13];
+  t8 = -input[14];
+  t4 = input[15];
+  /*14101/16384 ~= 0.86065016213948586*/
+  t12 -= (t15*14101 + 8192) >> 14;
+  /*3363/8192 ~= 0.4105245275223573*/
+  t15 -= (t12*3363 + 4096) >> 13;
+  /*25809/32768 ~= 0.78762894232967462*/
+  t12 += (t15*25809 + 16384) >> 15;
+  /*1519/4096 ~= 0.37084364295532879*/
+  t13 -= (t14*1519 + 2048) >> 12;
+  /*21845/32768 ~= 0.66665565847774666*/
+  t14 -= (t13*21845 + 16384) >> 15;
+  /*18501/32768 ~= 0.5645905629393656*/
+  t13 += (t14*18501 + 16384) >> 15;
+  /*851/8192 ~= 0.10388456785615832*/
+  t6 -= (t5*851 + 4096) >> 13;
+  /*14699/16384 ~= 0.89716758634263616*/
+  t5 -= (t6*14699 + 8192) >> 14;
+  /*1035/2048 ~= 0.50536719493782989*/
+  t6 += (t5*1035 + 1024) >> 11;
+  /*21669/16384 ~= 1.3225649336930341*/
+  t7 -= (t4*21669 + 8192) >> 14;
+  /*23059/32768 ~= 0.70370186876319119*/
+  t4 += (t7*23059 + 16384) >> 15;
+  /*20055/16384 ~= 1.2240735303358696*/
+  t7 -= (t4*20055 + 8192) >> 14;
+  t4 -= OD_DCT_RSHIFT(t5, 1);
+  t5 += t4;
+  t13 += OD_DCT_RSHIFT(t15, 1);
+  t15 -= t13;
+  t12 -= OD_DCT_RSHIFT(t14, 1);
+  t14 += t12;
+  t6 -= OD_DCT_RSHIFT(t7, 1);
+  t7 += t6;
+  /*7335/32768 ~= 0.22384718209265494*/
+  t10 -= (t9*7335 + 16384) >> 15;
+  /*12873/16384 ~= 0.78569495838710224*/
+  t9 -= (t10*12873 + 8192) >> 14;
+  /*17185/32768 ~= 0.5244556992400895*/
+  t10 += (t9*17185 + 16384) >> 15;
+  /*20365/16384 ~= 1.2430072766342379*/
+  t11 -= (t8*20365 + 8192) >> 14;
+  /*22725/32768 ~= 0.69351992266107365*/
+  t8 += (t11*22725 + 16384) >> 15;
+  /*8553/8192 ~= 1.0440949092545799*/
+  t11 -= (t8*8553 + 4096) >> 13;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t13 -= (t14*3259 + 8192) >> 14;
+  /*3135/8192 ~= 0.38268343236508984*/
+  t14 += (t13*3135 + 4096) >> 13;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t13 -= (t14*3259 + 8192) >> 14;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t6 += (t5*3259 + 8192) >> 14;
+  /*3135/8192 ~= 0.38268343236508984*/
+  t5 -= (t6*3135 + 4096) >> 13;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t6 += (t5*3259 + 8192) >> 14;
+  t8 -= OD_DCT_RSHIFT(t9, 1);
+  t9 += t8;
+  t10 -= OD_DCT_RSHIFT(t11, 1);
+  t11 += t10;
+  /*9281/16384 ~= 0.56645449735052122*/
+  t3 -= (t1*9281 + 8192) >> 14;
+  /*8867/16384 ~= 0.54119610014619701*/
+  t1 -= (t3*8867 + 8192) >> 14;
+  /*20993/32768 ~= 0.64065228383602613*/
+  t3 += (t1*20993 + 16384) >> 15;
+  t0 -= t2;
+  t2 += OD_DCT_RSHIFT(t0, 1);
+  t5 += t14;
+  t14 -= OD_DCT_RSHIFT(t5, 1);
+  t4 += t15;
+  t15 -= OD_DCT_RSHIFT(t4, 1);
+  t6 += t13;
+  t13 -= OD_DCT_RSHIFT(t6, 1);
+  t7 += t12;
+  t12 -= OD_DCT_RSHIFT(t7, 1);
+  /*13573/32768 ~= 0.41421356237309498*/
+  t10 += (t9*13573 + 16384) >> 15;
+  /*11585/16384 ~= 0.70710678118654757*/
+  t9 -= (t10*11585 + 8192) >> 14;
+  /*13573/32768 ~= 0.41421356237309498*/
+  t10 += (t9*13573 + 16384) >> 15;
+  t2 -= OD_DCT_RSHIFT(t1, 1);
+  t1 += t2;
+  t3 += OD_DCT_RSHIFT(t0, 1);
+  t0 -= t3;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t4 += (t12*13573 + 8192) >> 14;
+  /*11585/32768 ~= 0.35355339059327384*/
+  t12 -= (t4*11585 + 16384) >> 15;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t4 += (t12*13573 + 8192) >> 14;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t5 += (t13*13573 + 8192) >> 14;
+  /*11585/32768 ~= 0.35355339059327384*/
+  t13 -= (t5*11585 + 16384) >> 15;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t5 += (t13*13573 + 8192) >> 14;
+  t3 -= t11;
+  t11 += OD_DCT_RSHIFT(t3, 1);
+  t2 -= t10;
+  t10 += OD_DCT_RSHIFT(t2, 1);
+  t1 -= t9;
+  t9 += OD_DCT_RSHIFT(t1, 1);
+  t0 -= t8;
+  t8 += OD_DCT_RSHIFT(t0, 1);
+  t8 -= OD_DCT_RSHIFT(t7, 1);
+  t7 += t8;
+  t9 -= OD_DCT_RSHIFT(t6, 1);
+  t6 += t9;
+  t10 -= OD_DCT_RSHIFT(t5, 1);
+  t5 += t10;
+  t11 -= OD_DCT_RSHIFT(t4, 1);
+  t4 += t11;
+  t12 += OD_DCT_RSHIFT(t3, 1);
+  t3 -= t12;
+  t13 += OD_DCT_RSHIFT(t2, 1);
+  t2 -= t13;
+  t14 += OD_DCT_RSHIFT(t1, 1);
+  t1 -= t14;
+  t15 += OD_DCT_RSHIFT(t0, 1);
+  t0 -= t15;
+  output[0] = (tran_low_t)t0;
+  output[1] = (tran_low_t)t1;
+  output[2] = (tran_low_t)t2;
+  output[3] = (tran_low_t)t3;
+  output[4] = (tran_low_t)t4;
+  output[5] = (tran_low_t)t5;
+  output[6] = (tran_low_t)t6;
+  output[7] = (tran_low_t)t7;
+  output[8] = (tran_low_t)t8;
+  output[9] = (tran_low_t)t9;
+  output[10] = (tran_low_t)t10;
+  output[11] = (tran_low_t)t11;
+  output[12] = (tran_low_t)t12;
+  output[13] = (tran_low_t)t13;
+  output[14] = (tran_low_t)t14;
+  output[15] = (tran_low_t)t15;
+}
+
+void lift_fdct32(const tran_low_t *input, tran_low_t *output) {
+  /*227 adds, 64 shifts, 99 "muls".*/
+  int t0;
+  int t1;
+  int t2;
+  int t3;
+  int t4;
+  int t5;
+  int t6;
+  int t7;
+  int t8;
+  int t9;
+  int t10;
+  int t11;
+  int t12;
+  int t13;
+  int t14;
+  int t15;
+  int t16;
+  int t17;
+  int t18;
+  int t19;
+  int t20;
+  int t21;
+  int t22;
+  int t23;
+  int t24;
+  int t25;
+  int t26;
+  int t27;
+  int t28;
+  int t29;
+  int t30;
+  int t31;
+  t0 = input[0];
+  t1 = input[1];
+  t2 = input[2];
+  t3 = input[3];
+  t4 = input[4];
+  t5 = input[5];
+  t6 = input[6];
+  t7 = input[7];
+  t8 = input[8];
+  t9 = input[9];
+  t10 = input[10];
+  t11 = input[11];
+  t12 = input[12];
+  t13 = input[13];
+  t14 = input[14];
+  t15 = input[15];
+  t16 = input[16];
+  t17 = input[17];
+  t18 = input[18];
+  t19 = input[19];
+  t20 = input[20];
+  t21 = input[21];
+  t22 = input[22];
+  t23 = input[23];
+  t24 = input[24];
+  t25 = input[25];
+  t26 = input[26];
+  t27 = input[27];
+  t28 = input[28];
+  t29 = input[29];
+  t30 = input[30];
+  t31 = input[31];
+  t0 += t31;
+  t31 -= OD_DCT_RSHIFT(t0, 1);
+  t1 += t30;
+  t30 -= OD_DCT_RSHIFT(t1, 1);
+  t2 += t29;
+  t29 -= OD_DCT_RSHIFT(t2, 1);
+  t3 += t28;
+  t28 -= OD_DCT_RSHIFT(t3, 1);
+  t4 += t27;
+  t27 -= OD_DCT_RSHIFT(t4, 1);
+  t5 += t26;
+  t26 -= OD_DCT_RSHIFT(t5, 1);
+  t6 += t25;
+  t25 -= OD_DCT_RSHIFT(t6, 1);
+  t7 += t24;
+  t24 -= OD_DCT_RSHIFT(t7, 1);
+  t8 -= t23;
+  t23 += OD_DCT_RSHIFT(t8, 1);
+  t9 -= t22;
+  t22 += OD_DCT_RSHIFT(t9, 1);
+  t10 -= t21;
+  t21 += OD_DCT_RSHIFT(t10, 1);
+  t11 -= t20;
+  t20 += OD_DCT_RSHIFT(t11, 1);
+  t12 -= t19;
+  t19 += OD_DCT_RSHIFT(t12, 1);
+  t13 -= t18;
+  t18 += OD_DCT_RSHIFT(t13, 1);
+  t14 -= t17;
+  t17 += OD_DCT_RSHIFT(t14, 1);
+  t15 -= t16;
+  t16 += OD_DCT_RSHIFT(t15, 1);
+  t16 -= OD_DCT_RSHIFT(t0, 1);
+  t0 += t16;
+  t17 -= OD_DCT_RSHIFT(t1, 1);
+  t1 += t17;
+  t18 -= OD_DCT_RSHIFT(t2, 1);
+  t2 += t18;
+  t19 -= OD_DCT_RSHIFT(t3, 1);
+  t3 += t19;
+  t20 -= OD_DCT_RSHIFT(t4, 1);
+  t4 += t20;
+  t21 -= OD_DCT_RSHIFT(t5, 1);
+  t5 += t21;
+  t22 -= OD_DCT_RSHIFT(t6, 1);
+  t6 += t22;
+  t23 -= OD_DCT_RSHIFT(t7, 1);
+  t7 += t23;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t11 -= (t27*13573 + 8192) >> 14;
+  /*11585/32768 ~= 0.35355339059327384*/
+  t27 += (t11*11585 + 16384) >> 15;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t11 -= (t27*13573 + 8192) >> 14;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t10 -= (t26*13573 + 8192) >> 14;
+  /*11585/32768 ~= 0.35355339059327384*/
+  t26 += (t10*11585 + 16384) >> 15;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t10 -= (t26*13573 + 8192) >> 14;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t9 -= (t25*13573 + 8192) >> 14;
+  /*11585/32768 ~= 0.35355339059327384*/
+  t25 += (t9*11585 + 16384) >> 15;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t9 -= (t25*13573 + 8192) >> 14;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t8 -= (t24*13573 + 8192) >> 14;
+  /*11585/32768 ~= 0.35355339059327384*/
+  t24 += (t8*11585 + 16384) >> 15;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t8 -= (t24*13573 + 8192) >> 14;
+  t0 += t7;
+  t7 -= OD_DCT_RSHIFT(t0, 1);
+  t1 += t6;
+  t6 -= OD_DCT_RSHIFT(t1, 1);
+  t2 -= t5;
+  t5 += OD_DCT_RSHIFT(t2, 1);
+  t3 -= t4;
+  t4 += OD_DCT_RSHIFT(t3, 1);
+  /*13573/32768 ~= 0.41421356237309498*/
+  t21 -= (t18*13573 + 16384) >> 15;
+  /*11585/16384 ~= 0.70710678118654757*/
+  t18 += (t21*11585 + 8192) >> 14;
+  /*13573/32768 ~= 0.41421356237309498*/
+  t21 -= (t18*13573 + 16384) >> 15;
+  /*13573/32768 ~= 0.41421356237309498*/
+  t20 -= (t19*13573 + 16384) >> 15;
+  /*11585/16384 ~= 0.70710678118654757*/
+  t19 += (t20*11585 + 8192) >> 14;
+  /*13573/32768 ~= 0.41421356237309498*/
+  t20 -= (t19*13573 + 16384) >> 15;
+  t24 += OD_DCT_RSHIFT(t15, 1);
+  t15 -= t24;
+  t25 += OD_DCT_RSHIFT(t14, 1);
+  t14 -= t25;
+  t26 += OD_DCT_RSHIFT(t13, 1);
+  t13 -= t26;
+  t27 += OD_DCT_RSHIFT(t12, 1);
+  t12 -= t27;
+  t31 += OD_DCT_RSHIFT(t8, 1);
+  t8 -= t31;
+  t30 += OD_DCT_RSHIFT(t9, 1);
+  t9 -= t30;
+  t29 += OD_DCT_RSHIFT(t10, 1);
+  t10 -= t29;
+  t28 += OD_DCT_RSHIFT(t11, 1);
+  t11 -= t28;
+  t4 -= OD_DCT_RSHIFT(t0, 1);
+  t0 += t4;
+  t5 -= OD_DCT_RSHIFT(t1, 1);
+  t1 += t5;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t2 -= (t6*13573 + 8192) >> 14;
+  /*11585/32768 ~= 0.35355339059327384*/
+  t6 += (t2*11585 + 16384) >> 15;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t2 -= (t6*13573 + 8192) >> 14;
+  t23 -= t20;
+  t20 += OD_DCT_RSHIFT(t23, 1);
+  t22 -= t21;
+  t21 += OD_DCT_RSHIFT(t22, 1);
+  t19 -= t16;
+  t16 += OD_DCT_RSHIFT(t19, 1);
+  t18 -= t17;
+  t17 += OD_DCT_RSHIFT(t18, 1);
+  /*3259/16384 ~= 0.19891236737965801*/
+  t13 -= (t10*3259 + 8192) >> 14;
+  /*3135/8192 ~= 0.38268343236508984*/
+  t10 += (t13*3135 + 4096) >> 13;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t13 -= (t10*3259 + 8192) >> 14;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t12 -= (t11*3259 + 8192) >> 14;
+  /*3135/8192 ~= 0.38268343236508984*/
+  t11 += (t12*3135 + 4096) >> 13;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t12 -= (t11*3259 + 8192) >> 14;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t27 += (t28*3259 + 8192) >> 14;
+  /*3135/8192 ~= 0.38268343236508984*/
+  t28 -= (t27*3135 + 4096) >> 13;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t27 += (t28*3259 + 8192) >> 14;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t26 += (t29*3259 + 8192) >> 14;
+  /*3135/8192 ~= 0.38268343236508984*/
+  t29 -= (t26*3135 + 4096) >> 13;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t26 += (t29*3259 + 8192) >> 14;
+  /*13573/32768 ~= 0.41421356237309498*/
+  t0 += (t1*13573 + 16384) >> 15;
+  /*11585/16384 ~= 0.70710678118654757*/
+  t1 -= (t0*11585 + 8192) >> 14;
+  /*13573/32768 ~= 0.41421356237309498*/
+  t0 += (t1*13573 + 16384) >> 15;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t5 -= (t4*3259 + 8192) >> 14;
+  /*3135/8192 ~= 0.38268343236508984*/
+  t4 += (t5*3135 + 4096) >> 13;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t5 -= (t4*3259 + 8192) >> 14;
+  t6 += OD_DCT_RSHIFT(t3, 1);
+  t3 -= t6;
+  t7 += OD_DCT_RSHIFT(t2, 1);
+  t2 -= t7;
+  /*21895/16384 ~= 1.3363572758385978*/
+  t22 += (t17*21895 + 8192) >> 14;
+  /*15137/32768 ~= 0.46193976625564337*/
+  t17 -= (t22*15137 + 16384) >> 15;
+  /*21895/16384 ~= 1.3363572758385978*/
+  t22 += (t17*21895 + 8192) >> 14;
+  /*3259/8192 ~= 0.39782473475931601*/
+  t18 -= (t21*3259 + 4096) >> 13;
+  /*3135/16384 ~= 0.19134171618254492*/
+  t21 += (t18*3135 + 8192) >> 14;
+  /*3259/8192 ~= 0.39782473475931601*/
+  t18 -= (t21*3259 + 4096) >> 13;
+  t15 -= t12;
+  t12 += OD_DCT_RSHIFT(t15, 1);
+  t14 -= t13;
+  t13 += OD_DCT_RSHIFT(t14, 1);
+  t28 -= t24;
+  t24 += OD_DCT_RSHIFT(t28, 1);
+  t29 -= t25;
+  t25 += OD_DCT_RSHIFT(t29, 1);
+  t31 += t27;
+  t27 -= OD_DCT_RSHIFT(t31, 1);
+  t30 += t26;
+  t26 -= OD_DCT_RSHIFT(t30, 1);
+  t11 -= t8;
+  t8 += OD_DCT_RSHIFT(t11, 1);
+  t10 -= t9;
+  t9 += OD_DCT_RSHIFT(t10, 1);
+  /*3227/32768 ~= 0.098491403357164317*/
+  t3 -= (t2*3227 + 16384) >> 15;
+  /*6393/32768 ~= 0.19509032201612833*/
+  t2 += (t3*6393 + 16384) >> 15;
+  /*3227/32768 ~= 0.098491403357164317*/
+  t3 -= (t2*3227 + 16384) >> 15;
+  /*2485/8192 ~= 0.30334668360734235*/
+  t6 -= (t7*2485 + 4096) >> 13;
+  /*18205/32768 ~= 0.55557023301960229*/
+  t7 += (t6*18205 + 16384) >> 15;
+  /*2485/8192 ~= 0.30334668360734235*/
+  t6 -= (t7*2485 + 4096) >> 13;
+  t17 -= OD_DCT_RSHIFT(t23, 1);
+  t23 += t17;
+  t20 -= OD_DCT_RSHIFT(t18, 1);
+  t18 += t20;
+  t21 -= OD_DCT_RSHIFT(t19, 1);
+  t19 += t21;
+  t16 -= OD_DCT_RSHIFT(t22, 1);
+  t22 += t16;
+  /*6723/4096 ~= 1.6413575816573207*/
+  t14 += (t9*6723 + 2048) >> 12;
+  /*16069/32768 ~= 0.49039264020161522*/
+  t9 -= (t14*16069 + 16384) >> 15;
+  /*6723/4096 ~= 1.6413575816573207*/
+  t14 += (t9*6723 + 2048) >> 12;
+  /*6455/32768 ~= 0.19698280671432863*/
+  t10 -= (t13*6455 + 16384) >> 15;
+  /*799/8192 ~= 0.097545161008064166*/
+  t13 += (t10*799 + 4096) >> 13;
+  /*6455/32768 ~= 0.19698280671432863*/
+  t10 -= (t13*6455 + 16384) >> 15;
+  /*2485/4096 ~= 0.6066933672146847*/
+  t29 -= (t26*2485 + 2048) >> 12;
+  /*4551/16384 ~= 0.27778511650980114*/
+  t26 += (t29*4551 + 8192) >> 14;
+  /*2485/4096 ~= 0.6066933672146847*/
+  t29 -= (t26*2485 + 2048) >> 12;
+  /*17515/16384 ~= 1.0690222719015832*/
+  t30 -= (t25*17515 + 8192) >> 14;
+  /*13623/32768 ~= 0.41573480615127262*/
+  t25 += (t30*13623 + 16384) >> 15;
+  /*17515/16384 ~= 1.0690222719015832*/
+  t30 -= (t25*17515 + 8192) >> 14;
+  /*805/16384 ~= 0.049126849769466734*/
+  t23 -= (t22*805 + 8192) >> 14;
+  /*803/8192 ~= 0.09801714032956077*/
+  t22 += (t23*803 + 4096) >> 13;
+  /*805/16384 ~= 0.049126849769466734*/
+  t23 -= (t22*805 + 8192) >> 14;
+  /*11725/32768 ~= 0.35780572131452404*/
+  t17 -= (t16*11725 + 16384) >> 15;
+  /*5197/8192 ~= 0.63439328416364549*/
+  t16 += (t17*5197 + 4096) >> 13;
+  /*11725/32768 ~= 0.35780572131452404*/
+  t17 -= (t16*11725 + 16384) >> 15;
+  /*513/2048 ~= 0.25048696019130534*/
+  t20 -= (t21*513 + 1024) >> 11;
+  /*15447/32768 ~= 0.47139673682599781*/
+  t21 += (t20*15447 + 16384) >> 15;
+  /*513/2048 ~= 0.25048696019130534*/
+  t20 -= (t21*513 + 1024) >> 11;
+  /*4861/32768 ~= 0.14833598753834759*/
+  t18 -= (t19*4861 + 16384) >> 15;
+  /*1189/4096 ~= 0.29028467725446233*/
+  t19 += (t18*1189 + 2048) >> 12;
+  /*4861/32768 ~= 0.14833598753834759*/
+  t18 -= (t19*4861 + 16384) >> 15;
+  t9 -= OD_DCT_RSHIFT(t15, 1);
+  t15 += t9;
+  t12 -= OD_DCT_RSHIFT(t10, 1);
+  t10 += t12;
+  t26 += OD_DCT_RSHIFT(t28, 1);
+  t28 -= t26;
+  t24 -= OD_DCT_RSHIFT(t30, 1);
+  t30 += t24;
+  t25 -= OD_DCT_RSHIFT(t31, 1);
+  t31 += t25;
+  t27 += OD_DCT_RSHIFT(t29, 1);
+  t29 -= t27;
+  t13 -= OD_DCT_RSHIFT(t11, 1);
+  t11 += t13;
+  t8 -= OD_DCT_RSHIFT(t14, 1);
+  t14 += t8;
+  /*201/8192 ~= 0.024548622108925139*/
+  t15 -= (t14*201 + 4096) >> 13;
+  /*201/4096 ~= 0.049067674327418126*/
+  t14 += (t15*201 + 2048) >> 12;
+  /*201/8192 ~= 0.024548622108925139*/
+  t15 -= (t14*201 + 4096) >> 13;
+  /*395/1024 ~= 0.38574256627112125*/
+  t9 -= (t8*395 + 512) >> 10;
+  /*11003/16384 ~= 0.67155895484701833*/
+  t8 += (t9*11003 + 8192) >> 14;
+  /*395/1024 ~= 0.38574256627112125*/
+  t9 -= (t8*395 + 512) >> 10;
+  /*3679/16384 ~= 0.22455750931712926*/
+  t12 -= (t13*3679 + 8192) >> 14;
+  /*7005/16384 ~= 0.4275550934302822*/
+  t13 += (t12*7005 + 8192) >> 14;
+  /*3679/16384 ~= 0.22455750931712926*/
+  t12 -= (t13*3679 + 8192) >> 14;
+  /*2843/16384 ~= 0.17351646013785568*/
+  t10 -= (t11*2843 + 8192) >> 14;
+  /*11039/32768 ~= 0.33688985339222005*/
+  t11 += (t10*11039 + 16384) >> 15;
+  /*2843/16384 ~= 0.17351646013785568*/
+  t10 -= (t11*2843 + 8192) >> 14;
+  /*2021/16384 ~= 0.12333823613673871*/
+  t28 -= (t29*2021 + 8192) >> 14;
+  /*3981/16384 ~= 0.24298017990326398*/
+  t29 += (t28*3981 + 8192) >> 14;
+  /*2021/16384 ~= 0.12333823613673871*/
+  t28 -= (t29*2021 + 8192) >> 14;
+  /*2267/8192 ~= 0.27673727014041427*/
+  t26 -= (t27*2267 + 4096) >> 13;
+  /*8423/16384 ~= 0.51410274419322166*/
+  t27 += (t26*8423 + 8192) >> 14;
+  /*2267/8192 ~= 0.27673727014041427*/
+  t26 -= (t27*2267 + 4096) >> 13;
+  /*10825/32768 ~= 0.33035537734433379*/
+  t24 -= (t25*10825 + 16384) >> 15;
+  /*305/512 ~= 0.59569930449243347*/
+  t25 += (t24*305 + 256) >> 9;
+  /*10825/32768 ~= 0.33035537734433379*/
+  t24 -= (t25*10825 + 16384) >> 15;
+  /*2417/32768 ~= 0.073764431522449006*/
+  t30 -= (t31*2417 + 16384) >> 15;
+  /*601/4096 ~= 0.14673047445536175*/
+  t31 += (t30*601 + 2048) >> 12;
+  /*2417/32768 ~= 0.073764431522449006*/
+  t30 -= (t31*2417 + 16384) >> 15;
+  output[0] = (tran_low_t)t0;
+  output[1] = (tran_low_t)t14;
+  output[2] = (tran_low_t)-t22;
+  output[3] = (tran_low_t)-t31;
+  output[4] = (tran_low_t)t2;
+  output[5] = (tran_low_t)-t29;
+  output[6] = (tran_low_t)t19;
+  output[7] = (tran_low_t)-t11;
+  output[8] = (tran_low_t)-t4;
+  output[9] = (tran_low_t)t13;
+  output[10] = (tran_low_t)-t21;
+  output[11] = (tran_low_t)t27;
+  output[12] = (tran_low_t)-t7;
+  output[13] = (tran_low_t)t25;
+  output[14] = (tran_low_t)-t16;
+  output[15] = (tran_low_t)t8;
+  output[16] = (tran_low_t)-t1;
+  output[17] = (tran_low_t)-t9;
+  output[18] = (tran_low_t)t17;
+  output[19] = (tran_low_t)-t24;
+  output[20] = (tran_low_t)t6;
+  output[21] = (tran_low_t)-t26;
+  output[22] = (tran_low_t)t20;
+  output[23] = (tran_low_t)-t12;
+  output[24] = (tran_low_t)t5;
+  output[25] = (tran_low_t)t10;
+  output[26] = (tran_low_t)-t18;
+  output[27] = (tran_low_t)t28;
+  output[28] = (tran_low_t)-t3;
+  output[29] = (tran_low_t)t30;
+  output[30] = (tran_low_t)t23;
+  output[31] = (tran_low_t)-t15;
+}
+
+void lift_idct32(const tran_low_t *input, tran_low_t *output) {
+  /*227 adds, 64 shifts, 99 "muls".*/
+  int t0;
+  int t1;
+  int t2;
+  int t3;
+  int t4;
+  int t5;
+  int t6;
+  int t7;
+  int t8;
+  int t9;
+  int t10;
+  int t11;
+  int t12;
+  int t13;
+  int t14;
+  int t15;
+  int t16;
+  int t17;
+  int t18;
+  int t19;
+  int t20;
+  int t21;
+  int t22;
+  int t23;
+  int t24;
+  int t25;
+  int t26;
+  int t27;
+  int t28;
+  int t29;
+  int t30;
+  int t31;
+  t0 = input[0];
+  t14 = input[1];
+  t22 = -input[2];
+  t31 = -input[3];
+  t2 = input[4];
+  t29 = -input[5];
+  t19 = input[6];
+  t11 = -input[7];
+  t4 = -input[8];
+  t13 = input[9];
+  t21 = -input[10];
+  t27 = input[11];
+  t7 = -input[12];
+  t25 = input[13];
+  t16 = -input[14];
+  t8 = input[15];
+  t1 = -input[16];
+  t9 = -input[17];
+  t17 = input[18];
+  t24 = -input[19];
+  t6 = input[20];
+  t26 = -input[21];
+  t20 = input[22];
+  t12 = -input[23];
+  t5 = input[24];
+  t10 = input[25];
+  t18 = -input[26];
+  t28 = input[27];
+  t3 = -input[28];
+  t30 = input[29];
+  t23 = input[30];
+  t15 = -input[31];
+  /*2417/32768 ~= 0.073764431522449006*/
+  t30 += (t31*2417 + 16384) >> 15;
+  /*601/4096 ~= 0.14673047445536175*/
+  t31 -= (t30*601 + 2048) >> 12;
+  /*2417/32768 ~= 0.073764431522449006*/
+  t30 += (t31*2417 + 16384) >> 15;
+  /*10825/32768 ~= 0.33035537734433379*/
+  t24 += (t25*10825 + 16384) >> 15;
+  /*305/512 ~= 0.59569930449243347*/
+  t25 -= (t24*305 + 256) >> 9;
+  /*10825/32768 ~= 0.33035537734433379*/
+  t24 += (t25*10825 + 16384) >> 15;
+  /*2267/8192 ~= 0.27673727014041427*/
+  t26 += (t27*2267 + 4096) >> 13;
+  /*8423/16384 ~= 0.51410274419322166*/
+  t27 -= (t26*8423 + 8192) >> 14;
+  /*2267/8192 ~= 0.27673727014041427*/
+  t26 += (t27*2267 + 4096) >> 13;
+  /*2021/16384 ~= 0.12333823613673871*/
+  t28 += (t29*2021 + 8192) >> 14;
+  /*3981/16384 ~= 0.24298017990326398*/
+  t29 -= (t28*3981 + 8192) >> 14;
+  /*2021/16384 ~= 0.12333823613673871*/
+  t28 += (t29*2021 + 8192) >> 14;
+  /*2843/16384 ~= 0.17351646013785568*/
+  t10 += (t11*2843 + 8192) >> 14;
+  /*11039/32768 ~= 0.33688985339222005*/
+  t11 -= (t10*11039 + 16384) >> 15;
+  /*2843/16384 ~= 0.17351646013785568*/
+  t10 += (t11*2843 + 8192) >> 14;
+  /*3679/16384 ~= 0.22455750931712926*/
+  t12 += (t13*3679 + 8192) >> 14;
+  /*7005/16384 ~= 0.4275550934302822*/
+  t13 -= (t12*7005 + 8192) >> 14;
+  /*3679/16384 ~= 0.22455750931712926*/
+  t12 += (t13*3679 + 8192) >> 14;
+  /*395/1024 ~= 0.38574256627112125*/
+  t9 += (t8*395 + 512) >> 10;
+  /*11003/16384 ~= 0.67155895484701833*/
+  t8 -= (t9*11003 + 8192) >> 14;
+  /*395/1024 ~= 0.38574256627112125*/
+  t9 += (t8*395 + 512) >> 10;
+  /*201/8192 ~= 0.024548622108925139*/
+  t15 += (t14*201 + 4096) >> 13;
+  /*201/4096 ~= 0.049067674327418126*/
+  t14 -= (t15*201 + 2048) >> 12;
+  /*201/8192 ~= 0.024548622108925139*/
+  t15 += (t14*201 + 4096) >> 13;
+  t14 -= t8;
+  t8 += OD_DCT_RSHIFT(t14, 1);
+  t11 -= t13;
+  t13 += OD_DCT_RSHIFT(t11, 1);
+  t29 += t27;
+  t27 -= OD_DCT_RSHIFT(t29, 1);
+  t31 -= t25;
+  t25 += OD_DCT_RSHIFT(t31, 1);
+  t30 -= t24;
+  t24 += OD_DCT_RSHIFT(t30, 1);
+  t28 += t26;
+  t26 -= OD_DCT_RSHIFT(t28, 1);
+  t10 -= t12;
+  t12 += OD_DCT_RSHIFT(t10, 1);
+  t15 -= t9;
+  t9 += OD_DCT_RSHIFT(t15, 1);
+  /*4861/32768 ~= 0.14833598753834759*/
+  t18 += (t19*4861 + 16384) >> 15;
+  /*1189/4096 ~= 0.29028467725446233*/
+  t19 -= (t18*1189 + 2048) >> 12;
+  /*4861/32768 ~= 0.14833598753834759*/
+  t18 += (t19*4861 + 16384) >> 15;
+  /*513/2048 ~= 0.25048696019130534*/
+  t20 += (t21*513 + 1024) >> 11;
+  /*15447/32768 ~= 0.47139673682599781*/
+  t21 -= (t20*15447 + 16384) >> 15;
+  /*513/2048 ~= 0.25048696019130534*/
+  t20 += (t21*513 + 1024) >> 11;
+  /*11725/32768 ~= 0.35780572131452404*/
+  t17 += (t16*11725 + 16384) >> 15;
+  /*5197/8192 ~= 0.63439328416364549*/
+  t16 -= (t17*5197 + 4096) >> 13;
+  /*11725/32768 ~= 0.35780572131452404*/
+  t17 += (t16*11725 + 16384) >> 15;
+  /*805/16384 ~= 0.049126849769466734*/
+  t23 += (t22*805 + 8192) >> 14;
+  /*803/8192 ~= 0.09801714032956077*/
+  t22 -= (t23*803 + 4096) >> 13;
+  /*805/16384 ~= 0.049126849769466734*/
+  t23 += (t22*805 + 8192) >> 14;
+  /*17515/16384 ~= 1.0690222719015832*/
+  t30 += (t25*17515 + 8192) >> 14;
+  /*13623/32768 ~= 0.41573480615127262*/
+  t25 -= (t30*13623 + 16384) >> 15;
+  /*17515/16384 ~= 1.0690222719015832*/
+  t30 += (t25*17515 + 8192) >> 14;
+  /*2485/4096 ~= 0.6066933672146847*/
+  t29 += (t26*2485 + 2048) >> 12;
+  /*4551/16384 ~= 0.27778511650980114*/
+  t26 -= (t29*4551 + 8192) >> 14;
+  /*2485/4096 ~= 0.6066933672146847*/
+  t29 += (t26*2485 + 2048) >> 12;
+  /*6455/32768 ~= 0.19698280671432863*/
+  t10 += (t13*6455 + 16384) >> 15;
+  /*799/8192 ~= 0.097545161008064166*/
+  t13 -= (t10*799 + 4096) >> 13;
+  /*6455/32768 ~= 0.19698280671432863*/
+  t10 += (t13*6455 + 16384) >> 15;
+  /*6723/4096 ~= 1.6413575816573207*/
+  t14 -= (t9*6723 + 2048) >> 12;
+  /*16069/32768 ~= 0.49039264020161522*/
+  t9 += (t14*16069 + 16384) >> 15;
+  /*6723/4096 ~= 1.6413575816573207*/
+  t14 -= (t9*6723 + 2048) >> 12;
+  t22 -= t16;
+  t16 += OD_DCT_RSHIFT(t22, 1);
+  t19 -= t21;
+  t21 += OD_DCT_RSHIFT(t19, 1);
+  t18 -= t20;
+  t20 += OD_DCT_RSHIFT(t18, 1);
+  t23 -= t17;
+  t17 += OD_DCT_RSHIFT(t23, 1);
+  /*2485/8192 ~= 0.30334668360734235*/
+  t6 += (t7*2485 + 4096) >> 13;
+  /*18205/32768 ~= 0.55557023301960229*/
+  t7 -= (t6*18205 + 16384) >> 15;
+  /*2485/8192 ~= 0.30334668360734235*/
+  t6 += (t7*2485 + 4096) >> 13;
+  /*3227/32768 ~= 0.098491403357164317*/
+  t3 += (t2*3227 + 16384) >> 15;
+  /*6393/32768 ~= 0.19509032201612833*/
+  t2 -= (t3*6393 + 16384) >> 15;
+  /*3227/32768 ~= 0.098491403357164317*/
+  t3 += (t2*3227 + 16384) >> 15;
+  t9 -= OD_DCT_RSHIFT(t10, 1);
+  t10 += t9;
+  t8 -= OD_DCT_RSHIFT(t11, 1);
+  t11 += t8;
+  t26 += OD_DCT_RSHIFT(t30, 1);
+  t30 -= t26;
+  t27 += OD_DCT_RSHIFT(t31, 1);
+  t31 -= t27;
+  t25 -= OD_DCT_RSHIFT(t29, 1);
+  t29 += t25;
+  t24 -= OD_DCT_RSHIFT(t28, 1);
+  t28 += t24;
+  t13 -= OD_DCT_RSHIFT(t14, 1);
+  t14 += t13;
+  t12 -= OD_DCT_RSHIFT(t15, 1);
+  t15 += t12;
+  /*3259/8192 ~= 0.39782473475931601*/
+  t18 += (t21*3259 + 4096) >> 13;
+  /*3135/16384 ~= 0.19134171618254492*/
+  t21 -= (t18*3135 + 8192) >> 14;
+  /*3259/8192 ~= 0.39782473475931601*/
+  t18 += (t21*3259 + 4096) >> 13;
+  /*21895/16384 ~= 1.3363572758385978*/
+  t22 -= (t17*21895 + 8192) >> 14;
+  /*15137/32768 ~= 0.46193976625564337*/
+  t17 += (t22*15137 + 16384) >> 15;
+  /*21895/16384 ~= 1.3363572758385978*/
+  t22 -= (t17*21895 + 8192) >> 14;
+  t2 += t7;
+  t7 -= OD_DCT_RSHIFT(t2, 1);
+  t3 += t6;
+  t6 -= OD_DCT_RSHIFT(t3, 1);
+  /*3259/16384 ~= 0.19891236737965801*/
+  t5 += (t4*3259 + 8192) >> 14;
+  /*3135/8192 ~= 0.38268343236508984*/
+  t4 -= (t5*3135 + 4096) >> 13;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t5 += (t4*3259 + 8192) >> 14;
+  /*13573/32768 ~= 0.41421356237309498*/
+  t0 -= (t1*13573 + 16384) >> 15;
+  /*11585/16384 ~= 0.70710678118654757*/
+  t1 += (t0*11585 + 8192) >> 14;
+  /*13573/32768 ~= 0.41421356237309498*/
+  t0 -= (t1*13573 + 16384) >> 15;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t26 -= (t29*3259 + 8192) >> 14;
+  /*3135/8192 ~= 0.38268343236508984*/
+  t29 += (t26*3135 + 4096) >> 13;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t26 -= (t29*3259 + 8192) >> 14;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t27 -= (t28*3259 + 8192) >> 14;
+  /*3135/8192 ~= 0.38268343236508984*/
+  t28 += (t27*3135 + 4096) >> 13;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t27 -= (t28*3259 + 8192) >> 14;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t12 += (t11*3259 + 8192) >> 14;
+  /*3135/8192 ~= 0.38268343236508984*/
+  t11 -= (t12*3135 + 4096) >> 13;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t12 += (t11*3259 + 8192) >> 14;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t13 += (t10*3259 + 8192) >> 14;
+  /*3135/8192 ~= 0.38268343236508984*/
+  t10 -= (t13*3135 + 4096) >> 13;
+  /*3259/16384 ~= 0.19891236737965801*/
+  t13 += (t10*3259 + 8192) >> 14;
+  t17 -= OD_DCT_RSHIFT(t18, 1);
+  t18 += t17;
+  t16 -= OD_DCT_RSHIFT(t19, 1);
+  t19 += t16;
+  t21 -= OD_DCT_RSHIFT(t22, 1);
+  t22 += t21;
+  t20 -= OD_DCT_RSHIFT(t23, 1);
+  t23 += t20;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t2 += (t6*13573 + 8192) >> 14;
+  /*11585/32768 ~= 0.35355339059327384*/
+  t6 -= (t2*11585 + 16384) >> 15;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t2 += (t6*13573 + 8192) >> 14;
+  t1 -= t5;
+  t5 += OD_DCT_RSHIFT(t1, 1);
+  t0 -= t4;
+  t4 += OD_DCT_RSHIFT(t0, 1);
+  t11 += t28;
+  t28 -= OD_DCT_RSHIFT(t11, 1);
+  t10 += t29;
+  t29 -= OD_DCT_RSHIFT(t10, 1);
+  t9 += t30;
+  t30 -= OD_DCT_RSHIFT(t9, 1);
+  t8 += t31;
+  t31 -= OD_DCT_RSHIFT(t8, 1);
+  t12 += t27;
+  t27 -= OD_DCT_RSHIFT(t12, 1);
+  t13 += t26;
+  t26 -= OD_DCT_RSHIFT(t13, 1);
+  t14 += t25;
+  t25 -= OD_DCT_RSHIFT(t14, 1);
+  t15 += t24;
+  t24 -= OD_DCT_RSHIFT(t15, 1);
+  /*13573/32768 ~= 0.41421356237309498*/
+  t20 += (t19*13573 + 16384) >> 15;
+  /*11585/16384 ~= 0.70710678118654757*/
+  t19 -= (t20*11585 + 8192) >> 14;
+  /*13573/32768 ~= 0.41421356237309498*/
+  t20 += (t19*13573 + 16384) >> 15;
+  /*13573/32768 ~= 0.41421356237309498*/
+  t21 += (t18*13573 + 16384) >> 15;
+  /*11585/16384 ~= 0.70710678118654757*/
+  t18 -= (t21*11585 + 8192) >> 14;
+  /*13573/32768 ~= 0.41421356237309498*/
+  t21 += (t18*13573 + 16384) >> 15;
+  t4 -= OD_DCT_RSHIFT(t3, 1);
+  t3 += t4;
+  t5 -= OD_DCT_RSHIFT(t2, 1);
+  t2 += t5;
+  t6 += OD_DCT_RSHIFT(t1, 1);
+  t1 -= t6;
+  t7 += OD_DCT_RSHIFT(t0, 1);
+  t0 -= t7;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t8 += (t24*13573 + 8192) >> 14;
+  /*11585/32768 ~= 0.35355339059327384*/
+  t24 -= (t8*11585 + 16384) >> 15;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t8 += (t24*13573 + 8192) >> 14;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t9 += (t25*13573 + 8192) >> 14;
+  /*11585/32768 ~= 0.35355339059327384*/
+  t25 -= (t9*11585 + 16384) >> 15;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t9 += (t25*13573 + 8192) >> 14;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t10 += (t26*13573 + 8192) >> 14;
+  /*11585/32768 ~= 0.35355339059327384*/
+  t26 -= (t10*11585 + 16384) >> 15;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t10 += (t26*13573 + 8192) >> 14;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t11 += (t27*13573 + 8192) >> 14;
+  /*11585/32768 ~= 0.35355339059327384*/
+  t27 -= (t11*11585 + 16384) >> 15;
+  /*13573/16384 ~= 0.82842712474618951*/
+  t11 += (t27*13573 + 8192) >> 14;
+  t7 -= t23;
+  t23 += OD_DCT_RSHIFT(t7, 1);
+  t6 -= t22;
+  t22 += OD_DCT_RSHIFT(t6, 1);
+  t5 -= t21;
+  t21 += OD_DCT_RSHIFT(t5, 1);
+  t4 -= t20;
+  t20 += OD_DCT_RSHIFT(t4, 1);
+  t3 -= t19;
+  t19 += OD_DCT_RSHIFT(t3, 1);
+  t2 -= t18;
+  t18 += OD_DCT_RSHIFT(t2, 1);
+  t1 -= t17;
+  t17 += OD_DCT_RSHIFT(t1, 1);
+  t0 -= t16;
+  t16 += OD_DCT_RSHIFT(t0, 1);
+  t16 -= OD_DCT_RSHIFT(t15, 1);
+  t15 += t16;
+  t17 -= OD_DCT_RSHIFT(t14, 1);
+  t14 += t17;
+  t18 -= OD_DCT_RSHIFT(t13, 1);
+  t13 += t18;
+  t19 -= OD_DCT_RSHIFT(t12, 1);
+  t12 += t19;
+  t20 -= OD_DCT_RSHIFT(t11, 1);
+  t11 += t20;
+  t21 -= OD_DCT_RSHIFT(t10, 1);
+  t10 += t21;
+  t22 -= OD_DCT_RSHIFT(t9, 1);
+  t9 += t22;
+  t23 -= OD_DCT_RSHIFT(t8, 1);
+  t8 += t23;
+  t24 += OD_DCT_RSHIFT(t7, 1);
+  t7 -= t24;
+  t25 += OD_DCT_RSHIFT(t6, 1);
+  t6 -= t25;
+  t26 += OD_DCT_RSHIFT(t5, 1);
+  t5 -= t26;
+  t27 += OD_DCT_RSHIFT(t4, 1);
+  t4 -= t27;
+  t28 += OD_DCT_RSHIFT(t3, 1);
+  t3 -= t28;
+  t29 += OD_DCT_RSHIFT(t2, 1);
+  t2 -= t29;
+  t30 += OD_DCT_RSHIFT(t1, 1);
+  t1 -= t30;
+  t31 += OD_DCT_RSHIFT(t0, 1);
+  t0 -= t31;
+  output[0] = (tran_low_t)t0;
+  output[1] = (tran_low_t)t1;
+  output[2] = (tran_low_t)t2;
+  output[3] = (tran_low_t)t3;
+  output[4] = (tran_low_t)t4;
+  output[5] = (tran_low_t)t5;
+  output[6] = (tran_low_t)t6;
+  output[7] = (tran_low_t)t7;
+  output[8] = (tran_low_t)t8;
+  output[9] = (tran_low_t)t9;
+  output[10] = (tran_low_t)t10;
+  output[11] = (tran_low_t)t11;
+  output[12] = (tran_low_t)t12;
+  output[13] = (tran_low_t)t13;
+  output[14] = (tran_low_t)t14;
+  output[15] = (tran_low_t)t15;
+  output[16] = (tran_low_t)t16;
+  output[17] = (tran_low_t)t17;
+  output[18] = (tran_low_t)t18;
+  output[19] = (tran_low_t)t19;
+  output[20] = (tran_low_t)t20;
+  output[21] = (tran_low_t)t21;
+  output[22] = (tran_low_t)t22;
+  output[23] = (tran_low_t)t23;
+  output[24] = (tran_low_t)t24;
+  output[25] = (tran_low_t)t25;
+  output[26] = (tran_low_t)t26;
+  output[27] = (tran_low_t)t27;
+  output[28] = (tran_low_t)t28;
+  output[29] = (tran_low_t)t29;
+  output[30] = (tran_low_t)t30;
+  output[31] = (tran_low_t)t31;
+}
+
+typedef void (*lift_dct_func)(const tran_low_t *input, tran_low_t *output);
+
+/* Columns then rows. */
+static void lift_fdct_2d(const int16_t *input, tran_low_t *output,
+                         int stride, int n, lift_dct_func fdct) {
+  tran_low_t tmp[32 * 32];
+  tran_low_t in[32];
+  tran_low_t out[32];
+  int i;
+  int j;
+  for (i = 0; i < n; i++) {
+    for (j = 0; j < n; j++) in[j] = input[j * stride + i];
+    fdct(in, out);
+    for (j = 0; j < n; j++) tmp[j * n + i] = out[j];
+  }
+  for (j = 0; j < n; j++) fdct(tmp + j * n, output + j * n);
+}
+
+/* Rows then columns. */
+static void lift_idct_2d(const tran_low_t *input, int16_t *output,
+                         int stride, int n, lift_dct_func idct) {
+  tran_low_t tmp[32 * 32];
+  tran_low_t in[32];
+  tran_low_t out[32];
+  int i;
+  int j;
+  for (j = 0; j < n; j++) idct(input + j * n, tmp + j * n);
+  for (i = 0; i < n; i++) {
+    for (j = 0; j < n; j++) in[j] = tmp[j * n + i];
+    idct(in, out);
+    for (j = 0; j < n; j++) output[j * stride + i] = (int16_t)out[j];
+  }
+}
+
+void lift_fdct4x4_c(const int16_t *input, tran_low_t *output, int stride) {
+  lift_fdct_2d(input, output, stride, 4, daala_fdct4);
+}
+
+void lift_idct4x4_c(const tran_low_t *input, int16_t *output, int stride) {
+  lift_idct_2d(input, output, stride, 4, daala_idct4);
+}
+
+void lift_fdct8x8_c(const int16_t *input, tran_low_t *output, int stride) {
+  lift_fdct_2d(input, output, stride, 8, lift_fdct8);
+}
+
+void lift_idct8x8_c(const tran_low_t *input, int16_t *output, int stride) {
+  lift_idct_2d(input, output, stride, 8, lift_idct8);
+}
+
+void lift_fdct16x16_c(const int16_t *input, tran_low_t *output, int stride) {
+  lift_fdct_2d(input, output, stride, 16, lift_fdct16);
+}
+
+void lift_idct16x16_c(const tran_low_t *input, int16_t *output, int stride) {
+  lift_idct_2d(input, output, stride, 16, lift_idct16);
+}
+
+void lift_fdct32x32_c(const int16_t *input, tran_low_t *output, int stride) {
+  lift_fdct_2d(input, output, stride, 32, lift_fdct32);
+}
+
+void lift_idct32x32_c(const tran_low_t *input, int16_t *output, int stride) {
+  lift_idct_2d(input, output, stride, 32, lift_idct32);
+}
@@ -0,0 +1,67 @@
+#ifndef LIFT_DCT_H_
+#define LIFT_DCT_H_
+
+#include "aom/aom_integer.h"
+#include "aom_dsp/aom_dsp_common.h"
+
+/*This is the strength reduced version of ((_a)/(1 << (_b))).
+  This will not work for _b == 0, however currently this is only used for
+  b == 1 anyway.*/
+# define OD_UNBIASED_RSHIFT32(_a, _b) \
+  (((int32_t)(((uint32_t)(_a) >> (32 - (_b))) + (_a))) >> (_b))
+
+# define OD_DCT_RSHIFT(_a, _b) OD_UNBIASED_RSHIFT32(_a, _b)
+
+/* Reversible lifting based type-II DCTs with orthonormal scaling (the DC of a
+ * flat N point input x is x*sqrt(N)). The inverse reconstructs the input
+ * exactly. Intermediate values are 32 bits.
+ *
+ * The 4 point DCT is Daala's (od_bin_fdct4). The 8, 16 and 32 point DCTs are
+ * not Daala's od_bin_fdctN: they are generated by gen_lift_dct.py from the
+ * butterfly graph of AV1's DCTs, with Daala's lifting butterflies. */
+
+void daala_fdct4(const tran_low_t *input, tran_low_t *output);
+void daala_idct4(const tran_low_t *input, tran_low_t *output);
+
+void lift_fdct8(const tran_low_t *input, tran_low_t *output);
+void lift_idct8(const tran_low_t *input, tran_low_t *output);
+
+void lift_fdct16(const tran_low_t *input, tran_low_t *output);
+void lift_idct16(const tran_low_t *input, tran_low_t *output);
+
+void lift_fdct32(const tran_low_t *input, tran_low_t *output);
+void lift_idct32(const tran_low_t *input, tran_low_t *output);
+
+/* 2-D NxN transforms (columns then rows for the forward, rows then columns
+ * for the inverse). The residual has a stride, the coefficients do not. The
+ * SSE4.1 and AVX2 versions are bit-exact with the C. */
+
+void lift_fdct4x4_c(const int16_t *input, tran_low_t *output, int stride);
+void lift_idct4x4_c(const tran_low_t *input, int16_t *output, int stride);
+void lift_fdct8x8_c(const int16_t *input, tran_low_t *output, int stride);
+void lift_idct8x8_c(const tran_low_t *input, int16_t *output, int stride);
+void lift_fdct16x16_c(const int16_t *input, tran_low_t *output, int stride);
+void lift_idct16x16_c(const tran_low_t *input, int16_t *output, int stride);
+void lift_fdct32x32_c(const int16_t *input, tran_low_t *output, int stride);
+void lift_idct32x32_c(const tran_low_t *input, int16_t *output, int stride);
+
+void lift_fdct4x4_sse4_1(const int16_t *input, tran_low_t *output, int stride);
+void lift_idct4x4_sse4_1(const tran_low_t *input, int16_t *output, int stride);
+void lift_fdct8x8_sse4_1(const int16_t *input, tran_low_t *output, int stride);
+void lift_idct8x8_sse4_1(const tran_low_t *input, int16_t *output, int stride);
+void lift_fdct16x16_sse4_1(const int16_t *input, tran_low_t *output,
+                           int stride);
+void lift_idct16x16_sse4_1(const tran_low_t *input, int16_t *output,
+                           int stride);
+void lift_fdct32x32_sse4_1(const int16_t *input, tran_low_t *output,
+                           int stride);
+void lift_idct32x32_sse4_1(const tran_low_t *input, int16_t *output,
+                           int stride);
+
+void lift_fdct8x8_avx2(const int16_t *input, tran_low_t *output, int stride);
+void lift_idct8x8_avx2(const tran_low_t *input, int16_t *output, int stride);
+void lift_fdct16x16_avx2(const int16_t *input, tran_low_t *output, int stride);
+void lift_idct16x16_avx2(const tran_low_t *input, int16_t *output, int stride);
+void lift_fdct32x32_avx2(const int16_t *input, tran_low_t *output, int stride);
+void lift_idct32x32_avx2(const tran_low_t *input, int16_t *output, int stride);
+#endif  // LIFT_DCT_H_
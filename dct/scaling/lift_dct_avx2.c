@@ -0,0 +1,81 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#include <immintrin.h>
+
+#include "lift_dct.h"
+
+typedef __m256i od_simd;
+
+#define OD_SIMD_LANES (8)
+#define OD_SIMD_NAME(name) name##_avx2
+
+#define OD_ADD(a, b) _mm256_add_epi32(a, b)
+#define OD_SUB(a, b) _mm256_sub_epi32(a, b)
+#define OD_NEG(a) _mm256_sub_epi32(_mm256_setzero_si256(), a)
+#define OD_SHL(a, b) _mm256_slli_epi32(a, b)
+#define OD_RSHIFT(a, b) \
+  _mm256_srai_epi32(_mm256_add_epi32(_mm256_srli_epi32(a, 32 - (b)), a), b)
+#define OD_MUL(a, p, b)                                                    \
+  _mm256_srai_epi32(                                                       \
+      _mm256_add_epi32(_mm256_mullo_epi32(a, _mm256_set1_epi32(p)),        \
+                       _mm256_set1_epi32(1 << ((b) - 1))),                 \
+      b)
+
+static INLINE od_simd od_load_pixels(const int16_t *p) {
+  return _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)p));
+}
+
+static INLINE void od_store_pixels(int16_t *p, od_simd v) {
+  const __m128i lo = _mm256_castsi256_si128(v);
+  const __m128i hi = _mm256_extracti128_si256(v, 1);
+  _mm_storeu_si128((__m128i *)p, _mm_packs_epi32(lo, hi));
+}
+
+#if CONFIG_AOM_HIGHBITDEPTH
+static INLINE od_simd od_load_coeffs(const tran_low_t *p) {
+  return _mm256_loadu_si256((const __m256i *)p);
+}
+
+static INLINE void od_store_coeffs(tran_low_t *p, od_simd v) {
+  _mm256_storeu_si256((__m256i *)p, v);
+}
+#else
+#define od_load_coeffs od_load_pixels
+#define od_store_coeffs od_store_pixels
+#endif
+
+static INLINE void od_transpose(od_simd *t) {
+  // 4x4 transposes in each 128 bit lane, then swap the off diagonal blocks.
+  const __m256i a0 = _mm256_unpacklo_epi32(t[0], t[1]);
+  const __m256i a1 = _mm256_unpackhi_epi32(t[0], t[1]);
+  const __m256i a2 = _mm256_unpacklo_epi32(t[2], t[3]);
+  const __m256i a3 = _mm256_unpackhi_epi32(t[2], t[3]);
+  const __m256i a4 = _mm256_unpacklo_epi32(t[4], t[5]);
+  const __m256i a5 = _mm256_unpackhi_epi32(t[4], t[5]);
+  const __m256i a6 = _mm256_unpacklo_epi32(t[6], t[7]);
+  const __m256i a7 = _mm256_unpackhi_epi32(t[6], t[7]);
+  const __m256i b0 = _mm256_unpacklo_epi64(a0, a2);
+  const __m256i b1 = _mm256_unpackhi_epi64(a0, a2);
+  const __m256i b2 = _mm256_unpacklo_epi64(a1, a3);
+  const __m256i b3 = _mm256_unpackhi_epi64(a1, a3);
+  const __m256i b4 = _mm256_unpacklo_epi64(a4, a6);
+  const __m256i b5 = _mm256_unpackhi_epi64(a4, a6);
+  const __m256i b6 = _mm256_unpacklo_epi64(a5, a7);
+  const __m256i b7 = _mm256_unpackhi_epi64(a5, a7);
+  t[0] = _mm256_permute2x128_si256(b0, b4, 0x20);
+  t[1] = _mm256_permute2x128_si256(b1, b5, 0x20);
+  t[2] = _mm256_permute2x128_si256(b2, b6, 0x20);
+  t[3] = _mm256_permute2x128_si256(b3, b7, 0x20);
+  t[4] = _mm256_permute2x128_si256(b0, b4, 0x31);
+  t[5] = _mm256_permute2x128_si256(b1, b5, 0x31);
+  t[6] = _mm256_permute2x128_si256(b2, b6, 0x31);
+  t[7] = _mm256_permute2x128_si256(b3, b7, 0x31);
+}
+
+#include "lift_dct_simd.h"
+
+OD_SIMD_DCT_2D(8)
+OD_SIMD_DCT_2D(16)
+OD_SIMD_DCT_2D(32)
@@ -0,0 +1,1129 @@
+/* Generated by gen_lift_dct.py --simd, do not edit. */
+#ifndef LIFT_DCT_KERNELS_H_
+#define LIFT_DCT_KERNELS_H_
+
+static INLINE void od_fdct8_simd(od_simd *out, od_simd *t) {
+  /*31 adds, 8 shifts, 15 "muls".*/
+  t[0] = OD_ADD(t[0], t[7]);
+  t[7] = OD_SUB(t[7], OD_RSHIFT(t[0], 1));
+  t[1] = OD_ADD(t[1], t[6]);
+  t[6] = OD_SUB(t[6], OD_RSHIFT(t[1], 1));
+  t[2] = OD_SUB(t[2], t[5]);
+  t[5] = OD_ADD(t[5], OD_RSHIFT(t[2], 1));
+  t[3] = OD_SUB(t[3], t[4]);
+  t[4] = OD_ADD(t[4], OD_RSHIFT(t[3], 1));
+  t[4] = OD_SUB(t[4], OD_RSHIFT(t[0], 1));
+  t[0] = OD_ADD(t[0], t[4]);
+  t[5] = OD_SUB(t[5], OD_RSHIFT(t[1], 1));
+  t[1] = OD_ADD(t[1], t[5]);
+  /*13573/16384 ~= 0.82842712474618951*/
+  t[2] = OD_SUB(t[2], OD_MUL(t[6], 13573, 14));
+  /*11585/32768 ~= 0.35355339059327384*/
+  t[6] = OD_ADD(t[6], OD_MUL(t[2], 11585, 15));
+  /*13573/16384 ~= 0.82842712474618951*/
+  t[2] = OD_SUB(t[2], OD_MUL(t[6], 13573, 14));
+  /*13573/32768 ~= 0.41421356237309498*/
+  t[0] = OD_ADD(t[0], OD_MUL(t[1], 13573, 15));
+  /*11585/16384 ~= 0.70710678118654757*/
+  t[1] = OD_SUB(t[1], OD_MUL(t[0], 11585, 14));
+  /*13573/32768 ~= 0.41421356237309498*/
+  t[0] = OD_ADD(t[0], OD_MUL(t[1], 13573, 15));
+  /*3259/16384 ~= 0.19891236737965801*/
+  t[5] = OD_SUB(t[5], OD_MUL(t[4], 3259, 14));
+  /*3135/8192 ~= 0.38268343236508984*/
+  t[4] = OD_ADD(t[4], OD_MUL(t[5], 3135, 13));
+  /*3259/16384 ~= 0.19891236737965801*/
+  t[5] = OD_SUB(t[5], OD_MUL(t[4], 3259, 14));
+  t[6] = OD_ADD(t[6], OD_RSHIFT(t[3], 1));
+  t[3] = OD_SUB(t[3], t[6]);
+  t[7] = OD_ADD(t[7], OD_RSHIFT(t[2], 1));
+  t[2] = OD_SUB(t[2], t[7]);
+  /*3227/32768 ~= 0.098491403357164317*/
+  t[3] = OD_SUB(t[3], OD_MUL(t[2], 3227, 15));
+  /*6393/32768 ~= 0.19509032201612833*/
+  t[2] = OD_ADD(t[2], OD_MUL(t[3], 6393, 15));
+  /*3227/32768 ~= 0.098491403357164317*/
+  t[3] = OD_SUB(t[3], OD_MUL(t[2], 3227, 15));
+  /*2485/8192 ~= 0.30334668360734235*/
+  t[6] = OD_SUB(t[6], OD_MUL(t[7], 2485, 13));
+  /*18205/32768 ~= 0.55557023301960229*/
+  t[7] = OD_ADD(t[7], OD_MUL(t[6], 18205, 15));
+  /*2485/8192 ~= 0.30334668360734235*/
+  t[6] = OD_SUB(t[6], OD_MUL(t[7], 2485, 13));
+  out[0] = t[0];
+  out[1] = t[2];
+  out[2] = OD_NEG(t[4]);
+  out[3] = OD_NEG(t[7]);
+  out[4] = OD_NEG(t[1]);
+  out[5] = t[6];
+  out[6] = t[5];
+  out[7] = OD_NEG(t[3]);
+}
+
+static INLINE void od_idct8_simd(od_simd *out, od_simd *t) {
+  /*31 adds, 8 shifts, 15 "muls".*/
+  out[0] = t[0];
+  out[2] = t[1];
+  out[4] = OD_NEG(t[2]);
+  out[7] = OD_NEG(t[3]);
+  out[1] = OD_NEG(t[4]);
+  out[6] = t[5];
+  out[5] = t[6];
+  out[3] = OD_NEG(t[7]);
+  /*2485/8192 ~= 0.30334668360734235*/
+  out[6] = OD_ADD(out[6], OD_MUL(out[7], 2485, 13));
+  /*18205/32768 ~= 0.55557023301960229*/
+  out[7] = OD_SUB(out[7], OD_MUL(out[6], 18205, 15));
+  /*2485/8192 ~= 0.30334668360734235*/
+  out[6] = OD_ADD(out[6], OD_MUL(out[7], 2485, 13));
+  /*3227/32768 ~= 0.098491403357164317*/
+  out[3] = OD_ADD(out[3], OD_MUL(out[2], 3227, 15));
+  /*6393/32768 ~= 0.19509032201612833*/
+  out[2] = OD_SUB(out[2], OD_MUL(out[3], 6393, 15));
+  /*3227/32768 ~= 0.098491403357164317*/
+  out[3] = OD_ADD(out[3], OD_MUL(out[2], 3227, 15));
+  out[2] = OD_ADD(out[2], out[7]);
+  out[7] = OD_SUB(out[7], OD_RSHIFT(out[2], 1));
+  out[3] = OD_ADD(out[3], out[6]);
+  out[6] = OD_SUB(out[6], OD_RSHIFT(out[3], 1));
+  /*3259/16384 ~= 0.19891236737965801*/
+  out[5] = OD_ADD(out[5], OD_MUL(out[4], 3259, 14));
+  /*3135/8192 ~= 0.38268343236508984*/
+  out[4] = OD_SUB(out[4], OD_MUL(out[5], 3135, 13));
+  /*3259/16384 ~= 0.19891236737965801*/
+  out[5] = OD_ADD(out[5], OD_MUL(out[4], 3259, 14));
+  /*13573/32768 ~= 0.41421356237309498*/
+  out[0] = OD_SUB(out[0], OD_MUL(out[1], 13573, 15));
+  /*11585/16384 ~= 0.70710678118654757*/
+  out[1] = OD_ADD(out[1], OD_MUL(out[0], 11585, 14));
+  /*13573/32768 ~= 0.41421356237309498*/
+  out[0] = OD_SUB(out[0], OD_MUL(out[1], 13573, 15));
+  /*13573/16384 ~= 0.82842712474618951*/
+  out[2] = OD_ADD(out[2], OD_MUL(out[6], 13573, 14));
+  /*11585/32768 ~= 0.35355339059327384*/
+  out[6] = OD_SUB(out[6], OD_MUL(out[2], 11585, 15));
+  /*13573/16384 ~= 0.82842712474618951*/
+  out[2] = OD_ADD(out[2], OD_MUL(out[6], 13573, 14));
+  out[1] = OD_SUB(out[1], out[5]);
+  out[5] = OD_ADD(out[5], OD_RSHIFT(out[1], 1));
+  out[0] = OD_SUB(out[0], out[4]);
+  out[4] = OD_ADD(out[4], OD_RSHIFT(out[0], 1));
+  out[4] = OD_SUB(out[4], OD_RSHIFT(out[3], 1));
+  out[3] = OD_ADD(out[3], out[4]);
+  out[5] = OD_SUB(out[5], OD_RSHIFT(out[2], 1));
+  out[2] = OD_ADD(out[2], out[5]);
+  out[6] = OD_ADD(out[6], OD_RSHIFT(out[1], 1));
+  out[1] = OD_SUB(out[1], out[6]);
+  out[7] = OD_ADD(out[7], OD_RSHIFT(out[0], 1));
+  out[0] = OD_SUB(out[0], out[7]);
+}
+
+static INLINE void od_fdct16_simd(od_simd *out, od_simd *t) {
+  /*86 adds, 25 shifts, 36 "muls".*/
+  t[0] = OD_ADD(t[0], t[15]);
+  t[15] = OD_SUB(t[15], OD_RSHIFT(t[0], 1));
+  t[1] = OD_ADD(t[1], t[14]);
+  t[14] = OD_SUB(t[14], OD_RSHIFT(t[1], 1));
+  t[2] = OD_ADD(t[2], t[13]);
+  t[13] = OD_SUB(t[13], OD_RSHIFT(t[2], 1));
+  t[3] = OD_ADD(t[3], t[12]);
+  t[12] = OD_SUB(t[12], OD_RSHIFT(t[3], 1));
+  t[4] = OD_SUB(t[4], t[11]);
+  t[11] = OD_ADD(t[11], OD_RSHIFT(t[4], 1));
+  t[5] = OD_SUB(t[5], t[10]);
+  t[10] = OD_ADD(t[10], OD_RSHIFT(t[5], 1));
+  t[6] = OD_SUB(t[6], t[9]);
+  t[9] = OD_ADD(t[9], OD_RSHIFT(t[6], 1));
+  t[7] = OD_SUB(t[7], t[8]);
+  t[8] = OD_ADD(t[8], OD_RSHIFT(t[7], 1));
+  t[8] = OD_SUB(t[8], OD_RSHIFT(t[0], 1));
+  t[0] = OD_ADD(t[0], t[8]);
+  t[9] = OD_SUB(t[9], OD_RSHIFT(t[1], 1));
+  t[1] = OD_ADD(t[1], t[9]);
+  t[10] = OD_SUB(t[10], OD_RSHIFT(t[2], 1));
+  t[2] = OD_ADD(t[2], t[10]);
+  t[11] = OD_SUB(t[11], OD_RSHIFT(t[3], 1));
+  t[3] = OD_ADD(t[3], t[11]);
+  /*13573/16384 ~= 0.82842712474618951*/
+  t[5] = OD_SUB(t[5], OD_MUL(t[13], 13573, 14));
+  /*11585/32768 ~= 0.35355339059327384*/
+  t[13] = OD_ADD(t[13], OD_MUL(t[5], 11585, 15));
+  /*13573/16384 ~= 0.82842712474618951*/
+  t[5] = OD_SUB(t[5], OD_MUL(t[13], 13573, 14));
+  /*13573/16384 ~= 0.82842712474618951*/
+  t[4] = OD_SUB(t[4], OD_MUL(t[12], 13573, 14));
+  /*11585/32768 ~= 0.35355339059327384*/
+  t[12] = OD_ADD(t[12], OD_MUL(t[4], 11585, 15));
+  /*13573/16384 ~= 0.82842712474618951*/
+  t[4] = OD_SUB(t[4], OD_MUL(t[12], 13573, 14));
+  t[0] = OD_ADD(t[0], t[3]);
+  t[3] = OD_SUB(t[3], OD_RSHIFT(t[0], 1));
+  t[1] = OD_SUB(t[1], t[2]);
+  t[2] = OD_ADD(t[2], OD_RSHIFT(t[1], 1));
+  /*13573/32768 ~= 0.41421356237309498*/
+  t[10] = OD_SUB(t[10], OD_MUL(t[9], 13573, 15));
+  /*11585/16384 ~= 0.70710678118654757*/
+  t[9] = OD_ADD(t[9], OD_MUL(t[10], 11585, 14));
+  /*13573/32768 ~= 0.41421356237309498*/
+  t[10] = OD_SUB(t[10], OD_MUL(t[9], 13573, 15));
+  t[12] = OD_ADD(t[12], OD_RSHIFT(t[7], 1));
+  t[7] = OD_SUB(t[7], t[12]);
+  t[13] = OD_ADD(t[13], OD_RSHIFT(t[6], 1));
+  t[6] = OD_SUB(t[6], t[13]);
+  t[15] = OD_ADD(t[15], OD_RSHIFT(t[4], 1));
+  t[4] = OD_SUB(t[4], t[15]);
+  t[14] = OD_ADD(t[14], OD_RSHIFT(t[5], 1));
+  t[5] = OD_SUB(t[5], t[14]);
+  t[2] = OD_SUB(t[2], OD_RSHIFT(t[0], 1));
+  t[0] = OD_ADD(t[0], t[2]);
+  /*20993/32768 ~= 0.64065228383602613*/
+  t[3] = OD_SUB(t[3], OD_MUL(t[1], 20993, 15));
+  /*8867/16384 ~= 0.54119610014619701*/
+  t[1] = OD_ADD(t[1], OD_MUL(t[3], 8867, 14));
+  /*9281/16384 ~= 0.56645449735052122*/
+  t[3] = OD_ADD(t[3], OD_MUL(t[1], 9281, 14));
+  t[11] = OD_SUB(t[11], t[10]);
+  t[10] = OD_ADD(t[10], OD_RSHIFT(t[11], 1));
+  t[9] = OD_SUB(t[9], t[8]);
+  t[8] = OD_ADD(t[8], OD_RSHIFT(t[9], 1));
+  /*3259/16384 ~= 0.19891236737965801*/
+  t[6] = OD_SUB(t[6], OD_MUL(t[5], 3259, 14));
+  /*3135/8192 ~= 0.38268343236508984*/
+  t[5] = OD_ADD(t[5], OD_MUL(t[6], 3135, 13));
+  /*3259/16384 ~= 0.19891236737965801*/
+  t[6] = OD_SUB(t[6], OD_MUL(t[5], 3259, 14));
+  /*3259/16384 ~= 0.19891236737965801*/
+  t[13] = OD_ADD(t[13], OD_MUL(t[14], 3259, 14));
+  /*3135/8192 ~= 0.38268343236508984*/
+  t[14] = OD_SUB(t[14], OD_MUL(t[13], 3135, 13));
+  /*3259/16384 ~= 0.19891236737965801*/
+  t[13] = OD_ADD(t[13], OD_MUL(t[14], 3259, 14));
+  /*8553/8192 ~= 1.0440949092545799*/
+  t[11] = OD_ADD(t[11], OD_MUL(t[8], 8553, 13));
+  /*22725/32768 ~= 0.69351992266107365*/
+  t[8] = OD_SUB(t[8], OD_MUL(t[11], 22725, 15));
+  /*20365/16384 ~= 1.2430072766342379*/
+  t[11] = OD_ADD(t[11], OD_MUL(t[8], 20365, 14));
+  /*17185/32768 ~= 0.5244556992400895*/
+  t[10] = OD_SUB(t[10], OD_MUL(t[9], 17185, 15));
+  /*12873/16384 ~= 0.78569495838710224*/
+  t[9] = OD_ADD(t[9], OD_MUL(t[10], 12873, 14));
+  /*7335/32768 ~= 0.22384718209265494*/
+  t[10] = OD_ADD(t[10], OD_MUL(t[9], 7335, 15));
+  t[7] = OD_SUB(t[7], t[6]);
+  t[6] = OD_ADD(t[6], OD_RSHIFT(t[7], 1));
+  t[14] = OD_SUB(t[14], t[12]);
+  t[12] = OD_ADD(t[12], OD_RSHIFT(t[14], 1));
+  t[15] = OD_ADD(t[15], t[13]);
+  t[13] = OD_SUB(t[13], OD_RSHIFT(t[15], 1));
+  t[5] = OD_SUB(t[5], t[4]);
+  t[4] = OD_ADD(t[4], OD_RSHIFT(t[5], 1));
+  /*20055/16384 ~= 1.2240735303358696*/
+  t[7] = OD_ADD(t[7], OD_MUL(t[4], 20055, 14));
+  /*23059/32768 ~= 0.70370186876319119*/
+  t[4] = OD_SUB(t[4], OD_MUL(t[7], 23059, 15));
+  /*21669/16384 ~= 1.3225649336930341*/
+  t[7] = OD_ADD(t[7], OD_MUL(t[4], 21669, 14));
+  /*1035/2048 ~= 0.50536719493782989*/
+  t[6] = OD_SUB(t[6], OD_MUL(t[5], 1035, 11));
+  /*14699/16384 ~= 0.89716758634263616*/
+  t[5] = OD_ADD(t[5], OD_MUL(t[6], 14699, 14));
+  /*851/8192 ~= 0.10388456785615832*/
+  t[6] = OD_ADD(t[6], OD_MUL(t[5], 851, 13));
+  /*18501/32768 ~= 0.5645905629393656*/
+  t[13] = OD_SUB(t[13], OD_MUL(t[14], 18501, 15));
+  /*21845/32768 ~= 0.66665565847774666*/
+  t[14] = OD_ADD(t[14], OD_MUL(t[13], 21845, 15));
+  /*1519/4096 ~= 0.37084364295532879*/
+  t[13] = OD_ADD(t[13], OD_MUL(t[14], 1519, 12));
+  /*25809/32768 ~= 0.78762894232967462*/
+  t[12] = OD_SUB(t[12], OD_MUL(t[15], 25809, 15));
+  /*3363/8192 ~= 0.4105245275223573*/
+  t[15] = OD_ADD(t[15], OD_MUL(t[12], 3363, 13));
+  /*14101/16384 ~= 0.86065016213948586*/
+  t[12] = OD_ADD(t[12], OD_MUL(t[15], 14101, 14));
+  out[0] = t[0];
+  out[1] = t[7];
+  out[2] = OD_NEG(t[11]);
+  out[3] = OD_NEG(t[15]);
+  out[4] = OD_NEG(t[3]);
+  out[5] = t[13];
+  out[6] = t[9];
+  out[7] = OD_NEG(t[5]);
+  out[8] = OD_NEG(t[2]);
+  out[9] = t[6];
+  out[10] = OD_NEG(t[10]);
+  out[11] = t[14];
+  out[12] = OD_NEG(t[1]);
+  out[13] = t[12];
+  out[14] = OD_NEG(t[8]);
+  out[15] = t[4];
+}
+
+static INLINE void od_idct16_simd(od_simd *out, od_simd *t) {
+  /*86 adds, 25 shifts, 36 "muls".*/
+  out[0] = t[0];
+  out[7] = t[1];
+  out[11] = OD_NEG(t[2]);
+  out[15] = OD_NEG(t[3]);
+  out[3] = OD_NEG(t[4]);
+  out[13] = t[5];
+  out[9] = t[6];
+  out[5] = OD_NEG(t[7]);
+  out[2] = OD_NEG(t[8]);
+  out[6] = t[9];
+  out[10] = OD_NEG(t[10]);
+  out[14] = t[11];
+  out[1] = OD_NEG(t[12]);
+  out[12] = t[13];
+  out[8] = OD_NEG(t[14]);
+  out[4] = t[15];
+  /*14101/16384 ~= 0.86065016213948586*/
+  out[12] = OD_SUB(out[12], OD_MUL(out[15], 14101, 14));
+  /*3363/8192 ~= 0.4105245275223573*/
+  out[15] = OD_SUB(out[15], OD_MUL(out[12], 3363, 13));
+  /*25809/32768 ~= 0.78762894232967462*/
+  out[12] = OD_ADD(out[12], OD_MUL(out[15], 25809, 15));
+  /*1519/4096 ~= 0.37084364295532879*/
+  out[13] = OD_SUB(out[13], OD_MUL(out[14], 1519, 12));
+  /*21845/32768 ~= 0.66665565847774666*/
+  out[14] = OD_SUB(out[14], OD_MUL(out[13], 21845, 15));
+  /*18501/32768 ~= 0.5645905629393656*/
+  out[13] = OD_ADD(out[13], OD_MUL(out[14], 18501, 15));
+  /*851/8192 ~= 0.10388456785615832*/
+  out[6] = OD_SUB(out[6], OD_MUL(out[5], 851, 13));
+  /*14699/16384 ~= 0.89716758634263616*/
+  out[5] = OD_SUB(out[5], OD_MUL(out[6], 14699, 14));
+  /*1035/2048 ~= 0.50536719493782989*/
+  out[6] = OD_ADD(out[6], OD_MUL(out[5], 1035, 11));
+  /*21669/16384 ~= 1.3225649336930341*/
+  out[7] = OD_SUB(out[7], OD_MUL(out[4], 21669, 14));
+  /*23059/32768 ~= 0.70370186876319119*/
+  out[4] = OD_ADD(out[4], OD_MUL(out[7], 23059, 15));
+  /*20055/16384 ~= 1.2240735303358696*/
+  out[7] = OD_SUB(out[7], OD_MUL(out[4], 20055, 14));
+  out[4] = OD_SUB(out[4], OD_RSHIFT(out[5], 1));
+  out[5] = OD_ADD(out[5], out[4]);
+  out[13] = OD_ADD(out[13], OD_RSHIFT(out[15], 1));
+  out[15] = OD_SUB(out[15], out[13]);
+  out[12] = OD_SUB(out[12], OD_RSHIFT(out[14], 1));
+  out[14] = OD_ADD(out[14], out[12]);
+  out[6] = OD_SUB(out[6], OD_RSHIFT(out[7], 1));
+  out[7] = OD_ADD(out[7], out[6]);
+  /*7335/32768 ~= 0.22384718209265494*/
+  out[10] = OD_SUB(out[10], OD_MUL(out[9], 7335, 15));
+  /*12873/16384 ~= 0.78569495838710224*/
+  out[9] = OD_SUB(out[9], OD_MUL(out[10], 12873, 14));
+  /*17185/32768 ~= 0.5244556992400895*/
+  out[10] = OD_ADD(out[10], OD_MUL(out[9], 17185, 15));
+  /*20365/16384 ~= 1.2430072766342379*/
+  out[11] = OD_SUB(out[11], OD_MUL(out[8], 20365, 14));
+  /*22725/32768 ~= 0.69351992266107365*/
+  out[8] = OD_ADD(out[8], OD_MUL(out[11], 22725, 15));
+  /*8553/8192 ~= 1.0440949092545799*/
+  out[11] = OD_SUB(out[11], OD_MUL(out[8], 8553, 13));
+  /*3259/16384 ~= 0.19891236737965801*/
+  out[13] = OD_SUB(out[13], OD_MUL(out[14], 3259, 14));
+  /*3135/8192 ~= 0.38268343236508984*/
+  out[14] = OD_ADD(out[14], OD_MUL(out[13], 3135, 13));
+  /*3259/16384 ~= 0.19891236737965801*/
+  out[13] = OD_SUB(out[13], OD_MUL(out[14], 3259, 14));
+  /*3259/16384 ~= 0.19891236737965801*/
+  out[6] = OD_ADD(out[6], OD_MUL(out[5], 3259, 14));
+  /*3135/8192 ~= 0.38268343236508984*/
+  out[5] = OD_SUB(out[5], OD_MUL(out[6], 3135, 13));
+  /*3259/16384 ~= 0.19891236737965801*/
+  out[6] = OD_ADD(out[6], OD_MUL(out[5], 3259, 14));
+  out[8] = OD_SUB(out[8], OD_RSHIFT(out[9], 1));
+  out[9] = OD_ADD(out[9], out[8]);
+  out[10] = OD_SUB(out[10], OD_RSHIFT(out[11], 1));
+  out[11] = OD_ADD(out[11], out[10]);
+  /*9281/16384 ~= 0.56645449735052122*/
+  out[3] = OD_SUB(out[3], OD_MUL(out[1], 9281, 14));
+  /*8867/16384 ~= 0.54119610014619701*/
+  out[1] = OD_SUB(out[1], OD_MUL(out[3], 8867, 14));
+  /*20993/32768 ~= 0.64065228383602613*/
+  out[3] = OD_ADD(out[3], OD_MUL(out[1], 20993, 15));
+  out[0] = OD_SUB(out[0], out[2]);
+  out[2] = OD_ADD(out[2], OD_RSHIFT(out[0], 1));
+  out[5] = OD_ADD(out[5], out[14]);
+  out[14] = OD_SUB(out[14], OD_RSHIFT(out[5], 1));
+  out[4] = OD_ADD(out[4], out[15]);
+  out[15] = OD_SUB(out[15], OD_RSHIFT(out[4], 1));
+  out[6] = OD_ADD(out[6], out[13]);
+  out[13] = OD_SUB(out[13], OD_RSHIFT(out[6], 1));
+  out[7] = OD_ADD(out[7], out[12]);
+  out[12] = OD_SUB(out[12], OD_RSHIFT(out[7], 1));
+  /*13573/32768 ~= 0.41421356237309498*/
+  out[10] = OD_ADD(out[10], OD_MUL(out[9], 13573, 15));
+  /*11585/16384 ~= 0.70710678118654757*/
+  out[9] = OD_SUB(out[9], OD_MUL(out[10], 11585, 14));
+  /*13573/32768 ~= 0.41421356237309498*/
+  out[10] = OD_ADD(out[10], OD_MUL(out[9], 13573, 15));
+  out[2] = OD_SUB(out[2], OD_RSHIFT(out[1], 1));
+  out[1] = OD_ADD(out[1], out[2]);
+  out[3] = OD_ADD(out[3], OD_RSHIFT(out[0], 1));
+  out[0] = OD_SUB(out[0], out[3]);
+  /*13573/16384 ~= 0.82842712474618951*/
+  out[4] = OD_ADD(out[4], OD_MUL(out[12], 13573, 14));
+  /*11585/32768 ~= 0.35355339059327384*/
+  out[12] = OD_SUB(out[12], OD_MUL(out[4], 11585, 15));
+  /*13573/16384 ~= 0.82842712474618951*/
+  out[4] = OD_ADD(out[4], OD_MUL(out[12], 13573, 14));
+  /*13573/16384 ~= 0.82842712474618951*/
+  out[5] = OD_ADD(out[5], OD_MUL(out[13], 13573, 14));
+  /*11585/32768 ~= 0.35355339059327384*/
+  out[13] = OD_SUB(out[13], OD_MUL(out[5], 11585, 15));
+  /*13573/16384 ~= 0.82842712474618951*/
+  out[5] = OD_ADD(out[5], OD_MUL(out[13], 13573, 14));
+  out[3] = OD_SUB(out[3], out[11]);
+  out[11] = OD_ADD(out[11], OD_RSHIFT(out[3], 1));
+  out[2] = OD_SUB(out[2], out[10]);
+  out[10] = OD_ADD(out[10], OD_RSHIFT(out[2], 1));
+  out[1] = OD_SUB(out[1], out[9]);
+  out[9] = OD_ADD(out[9], OD_RSHIFT(out[1], 1));
+  out[0] = OD_SUB(out[0], out[8]);
+  out[8] = OD_ADD(out[8], OD_RSHIFT(out[0], 1));
+  out[8] = OD_SUB(out[8], OD_RSHIFT(out[7], 1));
+  out[7] = OD_ADD(out[7], out[8]);
+  out[9] = OD_SUB(out[9], OD_RSHIFT(out[6], 1));
+  out[6] = OD_ADD(out[6], out[9]);
+  out[10] = OD_SUB(out[10], OD_RSHIFT(out[5], 1));
+  out[5] = OD_ADD(out[5], out[10]);
+  out[11] = OD_SUB(out[11], OD_RSHIFT(out[4], 1));
+  out[4] = OD_ADD(out[4], out[11]);
+  out[12] = OD_ADD(out[12], OD_RSHIFT(out[3], 1));
+  out[3] = OD_SUB(out[3], out[12]);
+  out[13] = OD_ADD(out[13], OD_RSHIFT(out[2], 1));
+  out[2] = OD_SUB(out[2], out[13]);
+  out[14] = OD_ADD(out[14], OD_RSHIFT(out[1], 1));
+  out[1] = OD_SUB(out[1], out[14]);
+  out[15] = OD_ADD(out[15], OD_RSHIFT(out[0], 1));
+  out[0] = OD_SUB(out[0], out[15]);
+}
+
+static INLINE void od_fdct32_simd(od_simd *out, od_simd *t) {
+  /*227 adds, 64 shifts, 99 "muls".*/
+  t[0] = OD_ADD(t[0], t[31]);
+  t[31] = OD_SUB(t[31], OD_RSHIFT(t[0], 1));
+  t[1] = OD_ADD(t[1], t[30]);
+  t[30] = OD_SUB(t[30], OD_RSHIFT(t[1], 1));
+  t[2] = OD_ADD(t[2], t[29]);
+  t[29] = OD_SUB(t[29], OD_RSHIFT(t[2], 1));
+  t[3] = OD_ADD(t[3], t[28]);
+  t[28] = OD_SUB(t[28], OD_RSHIFT(t[3], 1));
+  t[4] = OD_ADD(t[4], t[27]);
+  t[27] = OD_SUB(t[27], OD_RSHIFT(t[4], 1));
+  t[5] = OD_ADD(t[5], t[26]);
+  t[26] = OD_SUB(t[26], OD_RSHIFT(t[5], 1));
+  t[6] = OD_ADD(t[6], t[25]);
+  t[25] = OD_SUB(t[25], OD_RSHIFT(t[6], 1));
+  t[7] = OD_ADD(t[7], t[24]);
+  t[24] = OD_SUB(t[24], OD_RSHIFT(t[7], 1));
+  t[8] = OD_SUB(t[8], t[23]);
+  t[23] = OD_ADD(t[23], OD_RSHIFT(t[8], 1));
+  t[9] = OD_SUB(t[9], t[22]);
+  t[22] = OD_ADD(t[22], OD_RSHIFT(t[9], 1));
+  t[10] = OD_SUB(t[10], t[21]);
+  t[21] = OD_ADD(t[21], OD_RSHIFT(t[10], 1));
+  t[11] = OD_SUB(t[11], t[20]);
+  t[20] = OD_ADD(t[20], OD_RSHIFT(t[11], 1));
+  t[12] = OD_SUB(t[12], t[19]);
+  t[19] = OD_ADD(t[19], OD_RSHIFT(t[12], 1));
+  t[13] = OD_SUB(t[13], t[18]);
+  t[18] = OD_ADD(t[18], OD_RSHIFT(t[13], 1));
+  t[14] = OD_SUB(t[14], t[17]);
+  t[17] = OD_ADD(t[17], OD_RSHIFT(t[14], 1));
+  t[15] = OD_SUB(t[15], t[16]);
+  t[16] = OD_ADD(t[16], OD_RSHIFT(t[15], 1));
+  t[16] = OD_SUB(t[16], OD_RSHIFT(t[0], 1));
+  t[0] = OD_ADD(t[0], t[16]);
+  t[17] = OD_SUB(t[17], OD_RSHIFT(t[1], 1));
+  t[1] = OD_ADD(t[1], t[17]);
+  t[18] = OD_SUB(t[18], OD_RSHIFT(t[2], 1));
+  t[2] = OD_ADD(t[2], t[18]);
+  t[19] = OD_SUB(t[19], OD_RSHIFT(t[3], 1));
+  t[3] = OD_ADD(t[3], t[19]);
+  t[20] = OD_SUB(t[20], OD_RSHIFT(t[4], 1));
+  t[4] = OD_ADD(t[4], t[20]);
+  t[21] = OD_SUB(t[21], OD_RSHIFT(t[5], 1));
+  t[5] = OD_ADD(t[5], t[21]);
+  t[22] = OD_SUB(t[22], OD_RSHIFT(t[6], 1));
+  t[6] = OD_ADD(t[6], t[22]);
+  t[23] = OD_SUB(t[23], OD_RSHIFT(t[7], 1));
+  t[7] = OD_ADD(t[7], t[23]);
+  /*13573/16384 ~= 0.82842712474618951*/
+  t[11] = OD_SUB(t[11], OD_MUL(t[27], 13573, 14));
+  /*11585/32768 ~= 0.35355339059327384*/
+  t[27] = OD_ADD(t[27], OD_MUL(t[11], 11585, 15));
+  /*13573/16384 ~= 0.82842712474618951*/
+  t[11] = OD_SUB(t[11], OD_MUL(t[27], 13573, 14));
+  /*13573/16384 ~= 0.82842712474618951*/
+  t[10] = OD_SUB(t[10], OD_MUL(t[26], 13573, 14));
+  /*11585/32768 ~= 0.35355339059327384*/
+  t[26] = OD_ADD(t[26], OD_MUL(t[10], 11585, 15));
+  /*13573/16384 ~= 0.82842712474618951*/
+  t[10] = OD_SUB(t[10], OD_MUL(t[26], 13573, 14));
+  /*13573/16384 ~= 0.82842712474618951*/
+  t[9] = OD_SUB(t[9], OD_MUL(t[25], 13573, 14));
+  /*11585/32768 ~= 0.35355339059327384*/
+  t[25] = OD_ADD(t[25], OD_MUL(t[9], 11585, 15));
+  /*13573/16384 ~= 0.82842712474618951*/
+  t[9] = OD_SUB(t[9], OD_MUL(t[25], 13573, 14));
+  /*13573/16384 ~= 0.82842712474618951*/
+  t[8] = OD_SUB(t[8], OD_MUL(t[24], 13573, 14));
+  /*11585/32768 ~= 0.35355339059327384*/
+  t[24] = OD_ADD(t[24], OD_MUL(t[8], 11585, 15));
+  /*13573/16384 ~= 0.82842712474618951*/
+  t[8] = OD_SUB(t[8], OD_MUL(t[24], 13573, 14));
+  t[0] = OD_ADD(t[0], t[7]);
+  t[7] = OD_SUB(t[7], OD_RSHIFT(t[0], 1));
+  t[1] = OD_ADD(t[1], t[6]);
+  t[6] = OD_SUB(t[6], OD_RSHIFT(t[1], 1));
+  t[2] = OD_SUB(t[2], t[5]);
+  t[5] = OD_ADD(t[5], OD_RSHIFT(t[2], 1));
+  t[3] = OD_SUB(t[3], t[4]);
+  t[4] = OD_ADD(t[4], OD_RSHIFT(t[3], 1));
+  /*13573/32768 ~= 0.41421356237309498*/
+  t[21] = OD_SUB(t[21], OD_MUL(t[18], 13573, 15));
+  /*11585/16384 ~= 0.70710678118654757*/
+  t[18] = OD_ADD(t[18], OD_MUL(t[21], 11585, 14));
+  /*13573/32768 ~= 0.41421356237309498*/
+  t[21] = OD_SUB(t[21], OD_MUL(t[18], 13573, 15));
+  /*13573/32768 ~= 0.41421356237309498*/
+  t[20] = OD_SUB(t[20], OD_MUL(t[19], 13573, 15));
+  /*11585/16384 ~= 0.70710678118654757*/
+  t[19] = OD_ADD(t[19], OD_MUL(t[20], 11585, 14));
+  /*13573/32768 ~= 0.41421356237309498*/
+  t[20] = OD_SUB(t[20], OD_MUL(t[19], 13573, 15));
+  t[24] = OD_ADD(t[24], OD_RSHIFT(t[15], 1));
+  t[15] = OD_SUB(t[15], t[24]);
+  t[25] = OD_ADD(t[25], OD_RSHIFT(t[14], 1));
+  t[14] = OD_SUB(t[14], t[25]);
+  t[26] = OD_ADD(t[26], OD_RSHIFT(t[13], 1));
+  t[13] = OD_SUB(t[13], t[26]);
+  t[27] = OD_ADD(t[27], OD_RSHIFT(t[12], 1));
+  t[12] = OD_SUB(t[12], t[27]);
+  t[31] = OD_ADD(t[31], OD_RSHIFT(t[8], 1));
+  t[8] = OD_SUB(t[8], t[31]);
+  t[30] = OD_ADD(t[30], OD_RSHIFT(t[9], 1));
+  t[9] = OD_SUB(t[9], t[30]);
+  t[29] = OD_ADD(t[29], OD_RSHIFT(t[10], 1));
+  t[10] = OD_SUB(t[10], t[29]);
+  t[28] = OD_ADD(t[28], OD_RSHIFT(t[11], 1));
+  t[11] = OD_SUB(t[11], t[28]);
+  t[4] = OD_SUB(t[4], OD_RSHIFT(t[0], 1));
+  t[0] = OD_ADD(t[0], t[4]);
+  t[5] = OD_SUB(t[5], OD_RSHIFT(t[1], 1));
+  t[1] = OD_ADD(t[1], t[5]);
+  /*13573/16384 ~= 0.82842712474618951*/
+  t[2] = OD_SUB(t[2], OD_MUL(t[6], 13573, 14));
+  /*11585/32768 ~= 0.35355339059327384*/
+  t[6] = OD_ADD(t[6], OD_MUL(t[2], 11585, 15));
+  /*13573/16384 ~= 0.82842712474618951*/
+  t[2] = OD_SUB(t[2], OD_MUL(t[6], 13573, 14));
+  t[23] = OD_SUB(t[23], t[20]);
+  t[20] = OD_ADD(t[20], OD_RSHIFT(t[23], 1));
+  t[22] = OD_SUB(t[22], t[21]);
+  t[21] = OD_ADD(t[21], OD_RSHIFT(t[22], 1));
+  t[19] = OD_SUB(t[19], t[16]);
+  t[16] = OD_ADD(t[16], OD_RSHIFT(t[19], 1));
+  t[18] = OD_SUB(t[18], t[17]);
+  t[17] = OD_ADD(t[17], OD_RSHIFT(t[18], 1));
+  /*3259/16384 ~= 0.19891236737965801*/
+  t[13] = OD_SUB(t[13], OD_MUL(t[10], 3259, 14));
+  /*3135/8192 ~= 0.38268343236508984*/
+  t[10] = OD_ADD(t[10], OD_MUL(t[13], 3135, 13));
+  /*3259/16384 ~= 0.19891236737965801*/
+  t[13] = OD_SUB(t[13], OD_MUL(t[10], 3259, 14));
+  /*3259/16384 ~= 0.19891236737965801*/
+  t[12] = OD_SUB(t[12], OD_MUL(t[11], 3259, 14));
+  /*3135/8192 ~= 0.38268343236508984*/
+  t[11] = OD_ADD(t[11], OD_MUL(t[12], 3135, 13));
+  /*3259/16384 ~= 0.19891236737965801*/
+  t[12] = OD_SUB(t[12], OD_MUL(t[11], 3259, 14));
+  /*3259/16384 ~= 0.19891236737965801*/
+  t[27] = OD_ADD(t[27], OD_MUL(t[28], 3259, 14));
+  /*3135/8192 ~= 0.38268343236508984*/
+  t[28] = OD_SUB(t[28], OD_MUL(t[27], 3135, 13));
+  /*3259/16384 ~= 0.19891236737965801*/
+  t[27] = OD_ADD(t[27], OD_MUL(t[28], 3259, 14));
+  /*3259/16384 ~= 0.19891236737965801*/
+  t[26] = OD_ADD(t[26], OD_MUL(t[29], 3259, 14));
+  /*3135/8192 ~= 0.38268343236508984*/
+  t[29] = OD_SUB(t[29], OD_MUL(t[26], 3135, 13));
+  /*3259/16384 ~= 0.19891236737965801*/
+  t[26] = OD_ADD(t[26], OD_MUL(t[29], 3259, 14));
+  /*13573/32768 ~= 0.41421356237309498*/
+  t[0] = OD_ADD(t[0], OD_MUL(t[1], 13573, 15));
+  /*11585/16384 ~= 0.70710678118654757*/
+  t[1] = OD_SUB(t[1], OD_MUL(t[0], 11585, 14));
+  /*13573/32768 ~= 0.41421356237309498*/
+  t[0] = OD_ADD(t[0], OD_MUL(t[1], 13573, 15));
+  /*3259/16384 ~= 0.19891236737965801*/
+  t[5] = OD_SUB(t[5], OD_MUL(t[4], 3259, 14));
+  /*3135/8192 ~= 0.38268343236508984*/
+  t[4] = OD_ADD(t[4], OD_MUL(t[5], 3135, 13));
+  /*3259/16384 ~= 0.19891236737965801*/
+  t[5] = OD_SUB(t[5], OD_MUL(t[4], 3259, 14));
+  t[6] = OD_ADD(t[6], OD_RSHIFT(t[3], 1));
+  t[3] = OD_SUB(t[3], t[6]);
+  t[7] = OD_ADD(t[7], OD_RSHIFT(t[2], 1));
+  t[2] = OD_SUB(t[2], t[7]);
+  /*21895/16384 ~= 1.3363572758385978*/
+  t[22] = OD_ADD(t[22], OD_MUL(t[17], 21895, 14));
+  /*15137/32768 ~= 0.46193976625564337*/
+  t[17] = OD_SUB(t[17], OD_MUL(t[22], 15137, 15));
+  /*21895/16384 ~= 1.3363572758385978*/
+  t[22] = OD_ADD(t[22], OD_MUL(t[17], 21895, 14));
+  /*3259/8192 ~= 0.39782473475931601*/
+  t[18] = OD_SUB(t[18], OD_MUL(t[21], 3259, 13));
+  /*3135/16384 ~= 0.19134171618254492*/
+  t[21] = OD_ADD(t[21], OD_MUL(t[18], 3135, 14));
+  /*3259/8192 ~= 0.39782473475931601*/
+  t[18] = OD_SUB(t[18], OD_MUL(t[21], 3259, 13));
+  t[15] = OD_SUB(t[15], t[12]);
+  t[12] = OD_ADD(t[12], OD_RSHIFT(t[15], 1));
+  t[14] = OD_SUB(t[14], t[13]);
+  t[13] = OD_ADD(t[13], OD_RSHIFT(t[14], 1));
+  t[28] = OD_SUB(t[28], t[24]);
+  t[24] = OD_ADD(t[24], OD_RSHIFT(t[28], 1));
+  t[29] = OD_SUB(t[29], t[25]);
+  t[25] = OD_ADD(t[25], OD_RSHIFT(t[29], 1));
+  t[31] = OD_ADD(t[31], t[27]);
+  t[27] = OD_SUB(t[27], OD_RSHIFT(t[31], 1));
+  t[30] = OD_ADD(t[30], t[26]);
+  t[26] = OD_SUB(t[26], OD_RSHIFT(t[30], 1));
+  t[11] = OD_SUB(t[11], t[8]);
+  t[8] = OD_ADD(t[8], OD_RSHIFT(t[11], 1));
+  t[10] = OD_SUB(t[10], t[9]);
+  t[9] = OD_ADD(t[9], OD_RSHIFT(t[10], 1));
+  /*3227/32768 ~= 0.098491403357164317*/
+  t[3] = OD_SUB(t[3], OD_MUL(t[2], 3227, 15));
+  /*6393/32768 ~= 0.19509032201612833*/
+  t[2] = OD_ADD(t[2], OD_MUL(t[3], 6393, 15));
+  /*3227/32768 ~= 0.098491403357164317*/
+  t[3] = OD_SUB(t[3], OD_MUL(t[2], 3227, 15));
+  /*2485/8192 ~= 0.30334668360734235*/
+  t[6] = OD_SUB(t[6], OD_MUL(t[7], 2485, 13));
+  /*18205/32768 ~= 0.55557023301960229*/
+  t[7] = OD_ADD(t[7], OD_MUL(t[6], 18205, 15));
+  /*2485/8192 ~= 0.30334668360734235*/
+  t[6] = OD_SUB(t[6], OD_MUL(t[7], 2485, 13));
+  t[17] = OD_SUB(t[17], OD_RSHIFT(t[23], 1));
+  t[23] = OD_ADD(t[23], t[17]);
+  t[20] = OD_SUB(t[20], OD_RSHIFT(t[18], 1));
+  t[18] = OD_ADD(t[18], t[20]);
+  t[21] = OD_SUB(t[21], OD_RSHIFT(t[19], 1));
+  t[19] = OD_ADD(t[19], t[21]);
+  t[16] = OD_SUB(t[16], OD_RSHIFT(t[22], 1));
+  t[22] = OD_ADD(t[22], t[16]);
+  /*6723/4096 ~= 1.6413575816573207*/
+  t[14] = OD_ADD(t[14], OD_MUL(t[9], 6723, 12));
+  /*16069/32768 ~= 0.49039264020161522*/
+  t[9] = OD_SUB(t[9], OD_MUL(t[14], 16069, 15));
+  /*6723/4096 ~= 1.6413575816573207*/
+  t[14] = OD_ADD(t[14], OD_MUL(t[9], 6723, 12));
+  /*6455/32768 ~= 0.19698280671432863*/
+  t[10] = OD_SUB(t[10], OD_MUL(t[13], 6455, 15));
+  /*799/8192 ~= 0.097545161008064166*/
+  t[13] = OD_ADD(t[13], OD_MUL(t[10], 799, 13));
+  /*6455/32768 ~= 0.19698280671432863*/
+  t[10] = OD_SUB(t[10], OD_MUL(t[13], 6455, 15));
+  /*2485/4096 ~= 0.6066933672146847*/
+  t[29] = OD_SUB(t[29], OD_MUL(t[26], 2485, 12));
+  /*4551/16384 ~= 0.27778511650980114*/
+  t[26] = OD_ADD(t[26], OD_MUL(t[29], 4551, 14));
+  /*2485/4096 ~= 0.6066933672146847*/
+  t[29] = OD_SUB(t[29], OD_MUL(t[26], 2485, 12));
+  /*17515/16384 ~= 1.0690222719015832*/
+  t[30] = OD_SUB(t[30], OD_MUL(t[25], 17515, 14));
+  /*13623/32768 ~= 0.41573480615127262*/
+  t[25] = OD_ADD(t[25], OD_MUL(t[30], 13623, 15));
+  /*17515/16384 ~= 1.0690222719015832*/
+  t[30] = OD_SUB(t[30], OD_MUL(t[25], 17515, 14));
+  /*805/16384 ~= 0.049126849769466734*/
+  t[23] = OD_SUB(t[23], OD_MUL(t[22], 805, 14));
+  /*803/8192 ~= 0.09801714032956077*/
+  t[22] = OD_ADD(t[22], OD_MUL(t[23], 803, 13));
+  /*805/16384 ~= 0.049126849769466734*/
+  t[23] = OD_SUB(t[23], OD_MUL(t[22], 805, 14));
+  /*11725/32768 ~= 0.35780572131452404*/
+  t[17] = OD_SUB(t[17], OD_MUL(t[16], 11725, 15));
+  /*5197/8192 ~= 0.63439328416364549*/
+  t[16] = OD_ADD(t[16], OD_MUL(t[17], 5197, 13));
+  /*11725/32768 ~= 0.35780572131452404*/
+  t[17] = OD_SUB(t[17], OD_MUL(t[16], 11725, 15));
+  /*513/2048 ~= 0.25048696019130534*/
+  t[20] = OD_SUB(t[20], OD_MUL(t[21], 513, 11));
+  /*15447/32768 ~= 0.47139673682599781*/
+  t[21] = OD_ADD(t[21], OD_MUL(t[20], 15447, 15));
+  /*513/2048 ~= 0.25048696019130534*/
+  t[20] = OD_SUB(t[20], OD_MUL(t[21], 513, 11));
+  /*4861/32768 ~= 0.14833598753834759*/
+  t[18] = OD_SUB(t[18], OD_MUL(t[19], 4861, 15));
+  /*1189/4096 ~= 0.29028467725446233*/
+  t[19] = OD_ADD(t[19], OD_MUL(t[18], 1189, 12));
+  /*4861/32768 ~= 0.14833598753834759*/
+  t[18] = OD_SUB(t[18], OD_MUL(t[19], 4861, 15));
+  t[9] = OD_SUB(t[9], OD_RSHIFT(t[15], 1));
+  t[15] = OD_ADD(t[15], t[9]);
+  t[12] = OD_SUB(t[12], OD_RSHIFT(t[10], 1));
+  t[10] = OD_ADD(t[10], t[12]);
+  t[26] = OD_ADD(t[26], OD_RSHIFT(t[28], 1));
+  t[28] = OD_SUB(t[28], t[26]);
+  t[24] = OD_SUB(t[24], OD_RSHIFT(t[30], 1));
+  t[30] = OD_ADD(t[30], t[24]);
+  t[25] = OD_SUB(t[25], OD_RSHIFT(t[31], 1));
+  t[31] = OD_ADD(t[31], t[25]);
+  t[27] = OD_ADD(t[27], OD_RSHIFT(t[29], 1));
+  t[29] = OD_SUB(t[29], t[27]);
+  t[13] = OD_SUB(t[13], OD_RSHIFT(t[11], 1));
+  t[11] = OD_ADD(t[11], t[13]);
+  t[8] = OD_SUB(t[8], OD_RSHIFT(t[14], 1));
+  t[14] = OD_ADD(t[14], t[8]);
+  /*201/8192 ~= 0.024548622108925139*/
+  t[15] = OD_SUB(t[15], OD_MUL(t[14], 201, 13));
+  /*201/4096 ~= 0.049067674327418126*/
+  t[14] = OD_ADD(t[14], OD_MUL(t[15], 201, 12));
+  /*201/8192 ~= 0.024548622108925139*/
+  t[15] = OD_SUB(t[15], OD_MUL(t[14], 201, 13));
+  /*395/1024 ~= 0.38574256627112125*/
+  t[9] = OD_SUB(t[9], OD_MUL(t[8], 395, 10));
+  /*11003/16384 ~= 0.67155895484701833*/
+  t[8] = OD_ADD(t[8], OD_MUL(t[9], 11003, 14));
+  /*395/1024 ~= 0.38574256627112125*/
+  t[9] = OD_SUB(t[9], OD_MUL(t[8], 395, 10));
+  /*3679/16384 ~= 0.22455750931712926*/
+  t[12] = OD_SUB(t[12], OD_MUL(t[13], 3679, 14));
+  /*7005/16384 ~= 0.4275550934302822*/
+  t[13] = OD_ADD(t[13], OD_MUL(t[12], 7005, 14));
+  /*3679/16384 ~= 0.22455750931712926*/
+  t[12] = OD_SUB(t[12], OD_MUL(t[13], 3679, 14));
+  /*2843/16384 ~= 0.17351646013785568*/
+  t[10] = OD_SUB(t[10], OD_MUL(t[11], 2843, 14));
+  /*11039/32768 ~= 0.33688985339222005*/
+  t[11] = OD_ADD(t[11], OD_MUL(t[10], 11039, 15));
+  /*2843/16384 ~= 0.17351646013785568*/
+  t[10] = OD_SUB(t[10], OD_MUL(t[11], 2843, 14));
+  /*2021/16384 ~= 0.12333823613673871*/
+  t[28] = OD_SUB(t[28], OD_MUL(t[29], 2021, 14));
+  /*3981/16384 ~= 0.24298017990326398*/
+  t[29] = OD_ADD(t[29], OD_MUL(t[28], 3981, 14));
+  /*2021/16384 ~= 0.12333823613673871*/
+  t[28] = OD_SUB(t[28], OD_MUL(t[29], 2021, 14));
+  /*2267/8192 ~= 0.27673727014041427*/
+  t[26] = OD_SUB(t[26], OD_MUL(t[27], 2267, 13));
+  /*8423/16384 ~= 0.51410274419322166*/
+  t[27] = OD_ADD(t[27], OD_MUL(t[26], 8423, 14));
+  /*2267/8192 ~= 0.27673727014041427*/
+  t[26] = OD_SUB(t[26], OD_MUL(t[27], 2267, 13));
+  /*10825/32768 ~= 0.33035537734433379*/
+  t[24] = OD_SUB(t[24], OD_MUL(t[25], 10825, 15));
+  /*305/512 ~= 0.59569930449243347*/
+  t[25] = OD_ADD(t[25], OD_MUL(t[24], 305, 9));
+  /*10825/32768 ~= 0.33035537734433379*/
+  t[24] = OD_SUB(t[24], OD_MUL(t[25], 10825, 15));
+  /*2417/32768 ~= 0.073764431522449006*/
+  t[30] = OD_SUB(t[30], OD_MUL(t[31], 2417, 15));
+  /*601/4096 ~= 0.14673047445536175*/
+  t[31] = OD_ADD(t[31], OD_MUL(t[30], 601, 12));
+  /*2417/32768 ~= 0.073764431522449006*/
+  t[30] = OD_SUB(t[30], OD_MUL(t[31], 2417, 15));
+  out[0] = t[0];
+  out[1] = t[14];
+  out[2] = OD_NEG(t[22]);
+  out[3] = OD_NEG(t[31]);
+  out[4] = t[2];
+  out[5] = OD_NEG(t[29]);
+  out[6] = t[19];
+  out[7] = OD_NEG(t[11]);
+  out[8] = OD_NEG(t[4]);
+  out[9] = t[13];
+  out[10] = OD_NEG(t[21]);
+  out[11] = t[27];
+  out[12] = OD_NEG(t[7]);
+  out[13] = t[25];
+  out[14] = OD_NEG(t[16]);
+  out[15] = t[8];
+  out[16] = OD_NEG(t[1]);
+  out[17] = OD_NEG(t[9]);
+  out[18] = t[17];
+  out[19] = OD_NEG(t[24]);
+  out[20] = t[6];
+  out[21] = OD_NEG(t[26]);
+  out[22] = t[20];
+  out[23] = OD_NEG(t[12]);
+  out[24] = t[5];
+  out[25] = t[10];
+  out[26] = OD_NEG(t[18]);
+  out[27] = t[28];
+  out[28] = OD_NEG(t[3]);
+  out[29] = t[30];
+  out[30] = t[23];
+  out[31] = OD_NEG(t[15]);
+}
+
+static INLINE void od_idct32_simd(od_simd *out, od_simd *t) {
+  /*227 adds, 64 shifts, 99 "muls".*/
+  out[0] = t[0];
+  out[14] = t[1];
+  out[22] = OD_NEG(t[2]);
+  out[31] = OD_NEG(t[3]);
+  out[2] = t[4];
+  out[29] = OD_NEG(t[5]);
+  out[19] = t[6];
+  out[11] = OD_NEG(t[7]);
+  out[4] = OD_NEG(t[8]);
+  out[13] = t[9];
+  out[21] = OD_NEG(t[10]);
+  out[27] = t[11];
+  out[7] = OD_NEG(t[12]);
+  out[25] = t[13];
+  out[16] = OD_NEG(t[14]);
+  out[8] = t[15];
+  out[1] = OD_NEG(t[16]);
+  out[9] = OD_NEG(t[17]);
+  out[17] = t[18];
+  out[24] = OD_NEG(t[19]);
+  out[6] = t[20];
+  out[26] = OD_NEG(t[21]);
+  out[20] = t[22];
+  out[12] = OD_NEG(t[23]);
+  out[5] = t[24];
+  out[10] = t[25];
+  out[18] = OD_NEG(t[26]);
+  out[28] = t[27];
+  out[3] = OD_NEG(t[28]);
+  out[30] = t[29];
+  out[23] = t[30];
+  out[15] = OD_NEG(t[31]);
+  /*2417/32768 ~= 0.073764431522449006*/
+  out[30] = OD_ADD(out[30], OD_MUL(out[31], 2417, 15));
+  /*601/4096 ~= 0.14673047445536175*/
+  out[31] = OD_SUB(out[31], OD_MUL(out[30], 601, 12));
+  /*2417/32768 ~= 0.073764431522449006*/
+  out[30] = OD_ADD(out[30], OD_MUL(out[31], 2417, 15));
+  /*10825/32768 ~= 0.33035537734433379*/
+  out[24] = OD_ADD(out[24], OD_MUL(out[25], 10825, 15));
+  /*305/512 ~= 0.59569930449243347*/
+  out[25] = OD_SUB(out[25], OD_MUL(out[24], 305, 9));
+  /*10825/32768 ~= 0.33035537734433379*/
+  out[24] = OD_ADD(out[24], OD_MUL(out[25], 10825, 15));
+  /*2267/8192 ~= 0.27673727014041427*/
+  out[26] = OD_ADD(out[26], OD_MUL(out[27], 2267, 13));
+  /*8423/16384 ~= 0.51410274419322166*/
+  out[27] = OD_SUB(out[27], OD_MUL(out[26], 8423, 14));
+  /*2267/8192 ~= 0.27673727014041427*/
+  out[26] = OD_ADD(out[26], OD_MUL(out[27], 2267, 13));
+  /*2021/16384 ~= 0.12333823613673871*/
+  out[28] = OD_ADD(out[28], OD_MUL(out[29], 2021, 14));
+  /*3981/16384 ~= 0.24298017990326398*/
+  out[29] = OD_SUB(out[29], OD_MUL(out[28], 3981, 14));
+  /*2021/16384 ~= 0.12333823613673871*/
+  out[28] = OD_ADD(out[28], OD_MUL(out[29], 2021, 14));
+  /*2843/16384 ~= 0.17351646013785568*/
+  out[10] = OD_ADD(out[10], OD_MUL(out[11], 2843, 14));
+  /*11039/32768 ~= 0.33688985339222005*/
+  out[11] = OD_SUB(out[11], OD_MUL(out[10], 11039, 15));
+  /*2843/16384 ~= 0.17351646013785568*/
+  out[10] = OD_ADD(out[10], OD_MUL(out[11], 2843, 14));
+  /*3679/16384 ~= 0.22455750931712926*/
+  out[12] = OD_ADD(out[12], OD_MUL(out[13], 3679, 14));
+  /*7005/16384 ~= 0.4275550934302822*/
+  out[13] = OD_SUB(out[13], OD_MUL(out[12], 7005, 14));
+  /*3679/16384 ~= 0.22455750931712926*/
+  out[12] = OD_ADD(out[12], OD_MUL(out[13], 3679, 14));
+  /*395/1024 ~= 0.38574256627112125*/
+  out[9] = OD_ADD(out[9], OD_MUL(out[8], 395, 10));
+  /*11003/16384 ~= 0.67155895484701833*/
+  out[8] = OD_SUB(out[8], OD_MUL(out[9], 11003, 14));
+  /*395/1024 ~= 0.38574256627112125*/
+  out[9] = OD_ADD(out[9], OD_MUL(out[8], 395, 10));
+  /*201/8192 ~= 0.024548622108925139*/
+  out[15] = OD_ADD(out[15], OD_MUL(out[14], 201, 13));
+  /*201/4096 ~= 0.049067674327418126*/
+  out[14] = OD_SUB(out[14], OD_MUL(out[15], 201, 12));
+  /*201/8192 ~= 0.024548622108925139*/
+  out[15] = OD_ADD(out[15], OD_MUL(out[14], 201, 13));
+  out[14] = OD_SUB(out[14], out[8]);
+  out[8] = OD_ADD(out[8], OD_RSHIFT(out[14], 1));
+  out[11] = OD_SUB(out[11], out[13]);
+  out[13] = OD_ADD(out[13], OD_RSHIFT(out[11], 1));
+  out[29] = OD_ADD(out[29], out[27]);
+  out[27] = OD_SUB(out[27], OD_RSHIFT(out[29], 1));
+  out[31] = OD_SUB(out[31], out[25]);
+  out[25] = OD_ADD(out[25], OD_RSHIFT(out[31], 1));
+  out[30] = OD_SUB(out[30], out[24]);
+  out[24] = OD_ADD(out[24], OD_RSHIFT(out[30], 1));
+  out[28] = OD_ADD(out[28], out[26]);
+  out[26] = OD_SUB(out[26], OD_RSHIFT(out[28], 1));
+  out[10] = OD_SUB(out[10], out[12]);
+  out[12] = OD_ADD(out[12], OD_RSHIFT(out[10], 1));
+  out[15] = OD_SUB(out[15], out[9]);
+  out[9] = OD_ADD(out[9], OD_RSHIFT(out[15], 1));
+  /*4861/32768 ~= 0.14833598753834759*/
+  out[18] = OD_ADD(out[18], OD_MUL(out[19], 4861, 15));
+  /*1189/4096 ~= 0.29028467725446233*/
+  out[19] = OD_SUB(out[19], OD_MUL(out[18], 1189, 12));
+  /*4861/32768 ~= 0.14833598753834759*/
+  out[18] = OD_ADD(out[18], OD_MUL(out[19], 4861, 15));
+  /*513/2048 ~= 0.25048696019130534*/
+  out[20] = OD_ADD(out[20], OD_MUL(out[21], 513, 11));
+  /*15447/32768 ~= 0.47139673682599781*/
+  out[21] = OD_SUB(out[21], OD_MUL(out[20], 15447, 15));
+  /*513/2048 ~= 0.25048696019130534*/
+  out[20] = OD_ADD(out[20], OD_MUL(out[21], 513, 11));
+  /*11725/32768 ~= 0.35780572131452404*/
+  out[17] = OD_ADD(out[17], OD_MUL(out[16], 11725, 15));
+  /*5197/8192 ~= 0.63439328416364549*/
+  out[16] = OD_SUB(out[16], OD_MUL(out[17], 5197, 13));
+  /*11725/32768 ~= 0.35780572131452404*/
+  out[17] = OD_ADD(out[17], OD_MUL(out[16], 11725, 15));
+  /*805/16384 ~= 0.049126849769466734*/
+  out[23] = OD_ADD(out[23], OD_MUL(out[22], 805, 14));
+  /*803/8192 ~= 0.09801714032956077*/
+  out[22] = OD_SUB(out[22], OD_MUL(out[23], 803, 13));
+  /*805/16384 ~= 0.049126849769466734*/
+  out[23] = OD_ADD(out[23], OD_MUL(out[22], 805, 14));
+  /*17515/16384 ~= 1.0690222719015832*/
+  out[30] = OD_ADD(out[30], OD_MUL(out[25], 17515, 14));
+  /*13623/32768 ~= 0.41573480615127262*/
+  out[25] = OD_SUB(out[25], OD_MUL(out[30], 13623, 15));
+  /*17515/16384 ~= 1.0690222719015832*/
+  out[30] = OD_ADD(out[30], OD_MUL(out[25], 17515, 14));
+  /*2485/4096 ~= 0.6066933672146847*/
+  out[29] = OD_ADD(out[29], OD_MUL(out[26], 2485, 12));
+  /*4551/16384 ~= 0.27778511650980114*/
+  out[26] = OD_SUB(out[26], OD_MUL(out[29], 4551, 14));
+  /*2485/4096 ~= 0.6066933672146847*/
+  out[29] = OD_ADD(out[29], OD_MUL(out[26], 2485, 12));
+  /*6455/32768 ~= 0.19698280671432863*/
+  out[10] = OD_ADD(out[10], OD_MUL(out[13], 6455, 15));
+  /*799/8192 ~= 0.097545161008064166*/
+  out[13] = OD_SUB(out[13], OD_MUL(out[10], 799, 13));
+  /*6455/32768 ~= 0.19698280671432863*/
+  out[10] = OD_ADD(out[10], OD_MUL(out[13], 6455, 15));
+  /*6723/4096 ~= 1.6413575816573207*/
+  out[14] = OD_SUB(out[14], OD_MUL(out[9], 6723, 12));
+  /*16069/32768 ~= 0.49039264020161522*/
+  out[9] = OD_ADD(out[9], OD_MUL(out[14], 16069, 15));
+  /*6723/4096 ~= 1.6413575816573207*/
+  out[14] = OD_SUB(out[14], OD_MUL(out[9], 6723, 12));
+  out[22] = OD_SUB(out[22], out[16]);
+  out[16] = OD_ADD(out[16], OD_RSHIFT(out[22], 1));
+  out[19] = OD_SUB(out[19], out[21]);
+  out[21] = OD_ADD(out[21], OD_RSHIFT(out[19], 1));
+  out[18] = OD_SUB(out[18], out[20]);
+  out[20] = OD_ADD(out[20], OD_RSHIFT(out[18], 1));
+  out[23] = OD_SUB(out[23], out[17]);
+  out[17] = OD_ADD(out[17], OD_RSHIFT(out[23], 1));
+  /*2485/8192 ~= 0.30334668360734235*/
+  out[6] = OD_ADD(out[6], OD_MUL(out[7], 2485, 13));
+  /*18205/32768 ~= 0.55557023301960229*/
+  out[7] = OD_SUB(out[7], OD_MUL(out[6], 18205, 15));
+  /*2485/8192 ~= 0.30334668360734235*/
+  out[6] = OD_ADD(out[6], OD_MUL(out[7], 2485, 13));
+  /*3227/32768 ~= 0.098491403357164317*/
+  out[3] = OD_ADD(out[3], OD_MUL(out[2], 3227, 15));
+  /*6393/32768 ~= 0.19509032201612833*/
+  out[2] = OD_SUB(out[2], OD_MUL(out[3], 6393, 15));
+  /*3227/32768 ~= 0.098491403357164317*/
+  out[3] = OD_ADD(out[3], OD_MUL(out[2], 3227, 15));
+  out[9] = OD_SUB(out[9], OD_RSHIFT(out[10], 1));
+  out[10] = OD_ADD(out[10], out[9]);
+  out[8] = OD_SUB(out[8], OD_RSHIFT(out[11], 1));
+  out[11] = OD_ADD(out[11], out[8]);
+  out[26] = OD_ADD(out[26], OD_RSHIFT(out[30], 1));
+  out[30] = OD_SUB(out[30], out[26]);
+  out[27] = OD_ADD(out[27], OD_RSHIFT(out[31], 1));
+  out[31] = OD_SUB(out[31], out[27]);
+  out[25] = OD_SUB(out[25], OD_RSHIFT(out[29], 1));
+  out[29] = OD_ADD(out[29], out[25]);
+  out[24] = OD_SUB(out[24], OD_RSHIFT(out[28], 1));
+  out[28] = OD_ADD(out[28], out[24]);
+  out[13] = OD_SUB(out[13], OD_RSHIFT(out[14], 1));
+  out[14] = OD_ADD(out[14], out[13]);
+  out[12] = OD_SUB(out[12], OD_RSHIFT(out[15], 1));
+  out[15] = OD_ADD(out[15], out[12]);
+  /*3259/8192 ~= 0.39782473475931601*/
+  out[18] = OD_ADD(out[18], OD_MUL(out[21], 3259, 13));
+  /*3135/16384 ~= 0.19134171618254492*/
+  out[21] = OD_SUB(out[21], OD_MUL(out[18], 3135, 14));
+  /*3259/8192 ~= 0.39782473475931601*/
+  out[18] = OD_ADD(out[18], OD_MUL(out[21], 3259, 13));
+  /*21895/16384 ~= 1.3363572758385978*/
+  out[22] = OD_SUB(out[22], OD_MUL(out[17], 21895, 14));
+  /*15137/32768 ~= 0.46193976625564337*/
+  out[17] = OD_ADD(out[17], OD_MUL(out[22], 15137, 15));
+  /*21895/16384 ~= 1.3363572758385978*/
+  out[22] = OD_SUB(out[22], OD_MUL(out[17], 21895, 14));
+  out[2] = OD_ADD(out[2], out[7]);
+  out[7] = OD_SUB(out[7], OD_RSHIFT(out[2], 1));
+  out[3] = OD_ADD(out[3], out[6]);
+  out[6] = OD_SUB(out[6], OD_RSHIFT(out[3], 1));
+  /*3259/16384 ~= 0.19891236737965801*/
+  out[5] = OD_ADD(out[5], OD_MUL(out[4], 3259, 14));
+  /*3135/8192 ~= 0.38268343236508984*/
+  out[4] = OD_SUB(out[4], OD_MUL(out[5], 3135, 13));
+  /*3259/16384 ~= 0.19891236737965801*/
+  out[5] = OD_ADD(out[5], OD_MUL(out[4], 3259, 14));
+  /*13573/32768 ~= 0.41421356237309498*/
+  out[0] = OD_SUB(out[0], OD_MUL(out[1], 13573, 15));
+  /*11585/16384 ~= 0.70710678118654757*/
+  out[1] = OD_ADD(out[1], OD_MUL(out[0], 11585, 14));
+  /*13573/32768 ~= 0.41421356237309498*/
+  out[0] = OD_SUB(out[0], OD_MUL(out[1], 13573, 15));
+  /*3259/16384 ~= 0.19891236737965801*/
+  out[26] = OD_SUB(out[26], OD_MUL(out[29], 3259, 14));
+  /*3135/8192 ~= 0.38268343236508984*/
+  out[29] = OD_ADD(out[29], OD_MUL(out[26], 3135, 13));
+  /*3259/16384 ~= 0.19891236737965801*/
+  out[26] = OD_SUB(out[26], OD_MUL(out[29], 3259, 14));
+  /*3259/16384 ~= 0.19891236737965801*/
+  out[27] = OD_SUB(out[27], OD_MUL(out[28], 3259, 14));
+  /*3135/8192 ~= 0.38268343236508984*/
+  out[28] = OD_ADD(out[28], OD_MUL(out[27], 3135, 13));
+  /*3259/16384 ~= 0.19891236737965801*/
+  out[27] = OD_SUB(out[27], OD_MUL(out[28], 3259, 14));
+  /*3259/16384 ~= 0.19891236737965801*/
+  out[12] = OD_ADD(out[12], OD_MUL(out[11], 3259, 14));
+  /*3135/8192 ~= 0.38268343236508984*/
+  out[11] = OD_SUB(out[11], OD_MUL(out[12], 3135, 13));
+  /*3259/16384 ~= 0.19891236737965801*/
+  out[12] = OD_ADD(out[12], OD_MUL(out[11], 3259, 14));
+  /*3259/16384 ~= 0.19891236737965801*/
+  out[13] = OD_ADD(out[13], OD_MUL(out[10], 3259, 14));
+  /*3135/8192 ~= 0.38268343236508984*/
+  out[10] = OD_SUB(out[10], OD_MUL(out[13], 3135, 13));
+  /*3259/16384 ~= 0.19891236737965801*/
+  out[13] = OD_ADD(out[13], OD_MUL(out[10], 3259, 14));
+  out[17] = OD_SUB(out[17], OD_RSHIFT(out[18], 1));
+  out[18] = OD_ADD(out[18], out[17]);
+  out[16] = OD_SUB(out[16], OD_RSHIFT(out[19], 1));
+  out[19] = OD_ADD(out[19], out[16]);
+  out[21] = OD_SUB(out[21], OD_RSHIFT(out[22], 1));
+  out[22] = OD_ADD(out[22], out[21]);
+  out[20] = OD_SUB(out[20], OD_RSHIFT(out[23], 1));
+  out[23] = OD_ADD(out[23], out[20]);
+  /*13573/16384 ~= 0.82842712474618951*/
+  out[2] = OD_ADD(out[2], OD_MUL(out[6], 13573, 14));
+  /*11585/32768 ~= 0.35355339059327384*/
+  out[6] = OD_SUB(out[6], OD_MUL(out[2], 11585, 15));
+  /*13573/16384 ~= 0.82842712474618951*/
+  out[2] = OD_ADD(out[2], OD_MUL(out[6], 13573, 14));
+  out[1] = OD_SUB(out[1], out[5]);
+  out[5] = OD_ADD(out[5], OD_RSHIFT(out[1], 1));
+  out[0] = OD_SUB(out[0], out[4]);
+  out[4] = OD_ADD(out[4], OD_RSHIFT(out[0], 1));
+  out[11] = OD_ADD(out[11], out[28]);
+  out[28] = OD_SUB(out[28], OD_RSHIFT(out[11], 1));
+  out[10] = OD_ADD(out[10], out[29]);
+  out[29] = OD_SUB(out[29], OD_RSHIFT(out[10], 1));
+  out[9] = OD_ADD(out[9], out[30]);
+  out[30] = OD_SUB(out[30], OD_RSHIFT(out[9], 1));
+  out[8] = OD_ADD(out[8], out[31]);
+  out[31] = OD_SUB(out[31], OD_RSHIFT(out[8], 1));
+  out[12] = OD_ADD(out[12], out[27]);
+  out[27] = OD_SUB(out[27], OD_RSHIFT(out[12], 1));
+  out[13] = OD_ADD(out[13], out[26]);
+  out[26] = OD_SUB(out[26], OD_RSHIFT(out[13], 1));
+  out[14] = OD_ADD(out[14], out[25]);
+  out[25] = OD_SUB(out[25], OD_RSHIFT(out[14], 1));
+  out[15] = OD_ADD(out[15], out[24]);
+  out[24] = OD_SUB(out[24], OD_RSHIFT(out[15], 1));
+  /*13573/32768 ~= 0.41421356237309498*/
+  out[20] = OD_ADD(out[20], OD_MUL(out[19], 13573, 15));
+  /*11585/16384 ~= 0.70710678118654757*/
+  out[19] = OD_SUB(out[19], OD_MUL(out[20], 11585, 14));
+  /*13573/32768 ~= 0.41421356237309498*/
+  out[20] = OD_ADD(out[20], OD_MUL(out[19], 13573, 15));
+  /*13573/32768 ~= 0.41421356237309498*/
+  out[21] = OD_ADD(out[21], OD_MUL(out[18], 13573, 15));
+  /*11585/16384 ~= 0.70710678118654757*/
+  out[18] = OD_SUB(out[18], OD_MUL(out[21], 11585, 14));
+  /*13573/32768 ~= 0.41421356237309498*/
+  out[21] = OD_ADD(out[21], OD_MUL(out[18], 13573, 15));
+  out[4] = OD_SUB(out[4], OD_RSHIFT(out[3], 1));
+  out[3] = OD_ADD(out[3], out[4]);
+  out[5] = OD_SUB(out[5], OD_RSHIFT(out[2], 1));
+  out[2] = OD_ADD(out[2], out[5]);
+  out[6] = OD_ADD(out[6], OD_RSHIFT(out[1], 1));
+  out[1] = OD_SUB(out[1], out[6]);
+  out[7] = OD_ADD(out[7], OD_RSHIFT(out[0], 1));
+  out[0] = OD_SUB(out[0], out[7]);
+  /*13573/16384 ~= 0.82842712474618951*/
+  out[8] = OD_ADD(out[8], OD_MUL(out[24], 13573, 14));
+  /*11585/32768 ~= 0.35355339059327384*/
+  out[24] = OD_SUB(out[24], OD_MUL(out[8], 11585, 15));
+  /*13573/16384 ~= 0.82842712474618951*/
+  out[8] = OD_ADD(out[8], OD_MUL(out[24], 13573, 14));
+  /*13573/16384 ~= 0.82842712474618951*/
+  out[9] = OD_ADD(out[9], OD_MUL(out[25], 13573, 14));
+  /*11585/32768 ~= 0.35355339059327384*/
+  out[25] = OD_SUB(out[25], OD_MUL(out[9], 11585, 15));
+  /*13573/16384 ~= 0.82842712474618951*/
+  out[9] = OD_ADD(out[9], OD_MUL(out[25], 13573, 14));
+  /*13573/16384 ~= 0.82842712474618951*/
+  out[10] = OD_ADD(out[10], OD_MUL(out[26], 13573, 14));
+  /*11585/32768 ~= 0.35355339059327384*/
+  out[26] = OD_SUB(out[26], OD_MUL(out[10], 11585, 15));
+  /*13573/16384 ~= 0.82842712474618951*/
+  out[10] = OD_ADD(out[10], OD_MUL(out[26], 13573, 14));
+  /*13573/16384 ~= 0.82842712474618951*/
+  out[11] = OD_ADD(out[11], OD_MUL(out[27], 13573, 14));
+  /*11585/32768 ~= 0.35355339059327384*/
+  out[27] = OD_SUB(out[27], OD_MUL(out[11], 11585, 15));
+  /*13573/16384 ~= 0.82842712474618951*/
+  out[11] = OD_ADD(out[11], OD_MUL(out[27], 13573, 14));
+  out[7] = OD_SUB(out[7], out[23]);
+  out[23] = OD_ADD(out[23], OD_RSHIFT(out[7], 1));
+  out[6] = OD_SUB(out[6], out[22]);
+  out[22] = OD_ADD(out[22], OD_RSHIFT(out[6], 1));
+  out[5] = OD_SUB(out[5], out[21]);
+  out[21] = OD_ADD(out[21], OD_RSHIFT(out[5], 1));
+  out[4] = OD_SUB(out[4], out[20]);
+  out[20] = OD_ADD(out[20], OD_RSHIFT(out[4], 1));
+  out[3] = OD_SUB(out[3], out[19]);
+  out[19] = OD_ADD(out[19], OD_RSHIFT(out[3], 1));
+  out[2] = OD_SUB(out[2], out[18]);
+  out[18] = OD_ADD(out[18], OD_RSHIFT(out[2], 1));
+  out[1] = OD_SUB(out[1], out[17]);
+  out[17] = OD_ADD(out[17], OD_RSHIFT(out[1], 1));
+  out[0] = OD_SUB(out[0], out[16]);
+  out[16] = OD_ADD(out[16], OD_RSHIFT(out[0], 1));
+  out[16] = OD_SUB(out[16], OD_RSHIFT(out[15], 1));
+  out[15] = OD_ADD(out[15], out[16]);
+  out[17] = OD_SUB(out[17], OD_RSHIFT(out[14], 1));
+  out[14] = OD_ADD(out[14], out[17]);
+  out[18] = OD_SUB(out[18], OD_RSHIFT(out[13], 1));
+  out[13] = OD_ADD(out[13], out[18]);
+  out[19] = OD_SUB(out[19], OD_RSHIFT(out[12], 1));
+  out[12] = OD_ADD(out[12], out[19]);
+  out[20] = OD_SUB(out[20], OD_RSHIFT(out[11], 1));
+  out[11] = OD_ADD(out[11], out[20]);
+  out[21] = OD_SUB(out[21], OD_RSHIFT(out[10], 1));
+  out[10] = OD_ADD(out[10], out[21]);
+  out[22] = OD_SUB(out[22], OD_RSHIFT(out[9], 1));
+  out[9] = OD_ADD(out[9], out[22]);
+  out[23] = OD_SUB(out[23], OD_RSHIFT(out[8], 1));
+  out[8] = OD_ADD(out[8], out[23]);
+  out[24] = OD_ADD(out[24], OD_RSHIFT(out[7], 1));
+  out[7] = OD_SUB(out[7], out[24]);
+  out[25] = OD_ADD(out[25], OD_RSHIFT(out[6], 1));
+  out[6] = OD_SUB(out[6], out[25]);
+  out[26] = OD_ADD(out[26], OD_RSHIFT(out[5], 1));
+  out[5] = OD_SUB(out[5], out[26]);
+  out[27] = OD_ADD(out[27], OD_RSHIFT(out[4], 1));
+  out[4] = OD_SUB(out[4], out[27]);
+  out[28] = OD_ADD(out[28], OD_RSHIFT(out[3], 1));
+  out[3] = OD_SUB(out[3], out[28]);
+  out[29] = OD_ADD(out[29], OD_RSHIFT(out[2], 1));
+  out[2] = OD_SUB(out[2], out[29]);
+  out[30] = OD_ADD(out[30], OD_RSHIFT(out[1], 1));
+  out[1] = OD_SUB(out[1], out[30]);
+  out[31] = OD_ADD(out[31], OD_RSHIFT(out[0], 1));
+  out[0] = OD_SUB(out[0], out[31]);
+}
+
+#endif  // LIFT_DCT_KERNELS_H_
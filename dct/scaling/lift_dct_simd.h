@@ -0,0 +1,146 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+
+/* Template for the SIMD versions of the lifting DCTs. Each vector holds one
+ * 32 bit value of OD_SIMD_LANES columns (or rows), so the lifting steps are
+ * the exact same as in lift_dct.c and the results are bit-exact with the C
+ * (as long as the C does not overflow tran_low_t between the two passes).
+ *
+ * Before including this file, define:
+ *   od_simd                 the vector type
+ *   OD_SIMD_LANES           the number of 32 bit lanes
+ *   OD_SIMD_NAME(name)      name##_<isa>
+ *   OD_ADD(a, b), OD_SUB(a, b), OD_NEG(a)
+ *   OD_SHL(a, b)            a << b
+ *   OD_RSHIFT(a, b)         OD_DCT_RSHIFT(a, b) (rounds toward zero)
+ *   OD_MUL(a, p, b)         (a*p + (1 << (b - 1))) >> b
+ * and the functions od_load_pixels(), od_load_coeffs(), od_store_pixels(),
+ * od_store_coeffs() (OD_SIMD_LANES values) and od_transpose() (a square tile
+ * of OD_SIMD_LANES vectors). */
+
+#include "lift_dct.h"
+
+#define OD_SIMD_MAX_N (32)
+
+static INLINE void od_fdct4_simd(od_simd *out, od_simd *t) {
+  od_simd t2h;
+  /*Initial permutation:*/
+  od_simd t0 = t[0];
+  od_simd t2 = t[1];
+  od_simd t1 = t[2];
+  od_simd t3 = t[3];
+  /*+1/-1 butterflies:*/
+  t3 = OD_SUB(t0, t3);
+  t2 = OD_ADD(t2, t1);
+  t2h = OD_RSHIFT(t2, 1);
+  t1 = OD_SUB(t2h, t1);
+  t0 = OD_SUB(t0, OD_RSHIFT(t3, 1));
+  /*+ Embedded 2-point type-II DCT.*/
+  t0 = OD_ADD(t0, t2h);
+  t2 = OD_SUB(t0, t2);
+  /*+ Embedded 2-point type-IV DST.*/
+  t3 = OD_SUB(t3, OD_MUL(t1, 23013, 15));
+  t1 = OD_ADD(t1, OD_MUL(t3, 21407, 15));
+  t3 = OD_SUB(t3, OD_MUL(t1, 18293, 14));
+  out[0] = t0;
+  out[1] = t1;
+  out[2] = t2;
+  out[3] = t3;
+}
+
+static INLINE void od_idct4_simd(od_simd *out, od_simd *t) {
+  od_simd t2h;
+  od_simd t0 = t[0];
+  od_simd t1 = t[1];
+  od_simd t2 = t[2];
+  od_simd t3 = t[3];
+  t3 = OD_ADD(t3, OD_MUL(t1, 18293, 14));
+  t1 = OD_SUB(t1, OD_MUL(t3, 21407, 15));
+  t3 = OD_ADD(t3, OD_MUL(t1, 23013, 15));
+  t2 = OD_SUB(t0, t2);
+  t2h = OD_RSHIFT(t2, 1);
+  t0 = OD_SUB(t0, OD_SUB(t2h, OD_RSHIFT(t3, 1)));
+  t1 = OD_SUB(t2h, t1);
+  out[0] = t0;
+  out[1] = OD_SUB(t2, t1);
+  out[2] = t1;
+  out[3] = OD_SUB(t0, t3);
+}
+
+#include "lift_dct_kernels.h"
+
+typedef void (*od_dct_simd_func)(od_simd *out, od_simd *t);
+
+/* Columns then rows, like lift_fdct_2d() in lift_dct.c. buf holds the
+ * column transforms, n vectors for each group of OD_SIMD_LANES columns. */
+static INLINE void od_fdct_2d_simd(const int16_t *input, tran_low_t *output,
+                                   int stride, int n, od_dct_simd_func fdct) {
+  od_simd buf[OD_SIMD_MAX_N * OD_SIMD_MAX_N / OD_SIMD_LANES];
+  od_simd t[OD_SIMD_MAX_N];
+  od_simd out[OD_SIMD_MAX_N];
+  int c;
+  int r;
+  int i;
+  for (c = 0; c < n; c += OD_SIMD_LANES) {
+    for (i = 0; i < n; i++) t[i] = od_load_pixels(input + i * stride + c);
+    fdct(buf + c / OD_SIMD_LANES * n, t);
+  }
+  for (r = 0; r < n; r += OD_SIMD_LANES) {
+    /* Transpose OD_SIMD_LANES rows into one vector per column. */
+    for (c = 0; c < n; c += OD_SIMD_LANES) {
+      for (i = 0; i < OD_SIMD_LANES; i++) {
+        t[c + i] = buf[c / OD_SIMD_LANES * n + r + i];
+      }
+      od_transpose(t + c);
+    }
+    fdct(out, t);
+    for (c = 0; c < n; c += OD_SIMD_LANES) {
+      od_transpose(out + c);
+      for (i = 0; i < OD_SIMD_LANES; i++) {
+        od_store_coeffs(output + (r + i) * n + c, out[c + i]);
+      }
+    }
+  }
+}
+
+/* Rows then columns, like lift_idct_2d() in lift_dct.c. */
+static INLINE void od_idct_2d_simd(const tran_low_t *input, int16_t *output,
+                                   int stride, int n, od_dct_simd_func idct) {
+  od_simd buf[OD_SIMD_MAX_N * OD_SIMD_MAX_N / OD_SIMD_LANES];
+  od_simd t[OD_SIMD_MAX_N];
+  od_simd out[OD_SIMD_MAX_N];
+  int c;
+  int r;
+  int i;
+  for (r = 0; r < n; r += OD_SIMD_LANES) {
+    for (c = 0; c < n; c += OD_SIMD_LANES) {
+      for (i = 0; i < OD_SIMD_LANES; i++) {
+        t[c + i] = od_load_coeffs(input + (r + i) * n + c);
+      }
+      od_transpose(t + c);
+    }
+    idct(out, t);
+    for (c = 0; c < n; c += OD_SIMD_LANES) {
+      od_transpose(out + c);
+      for (i = 0; i < OD_SIMD_LANES; i++) {
+        buf[c / OD_SIMD_LANES * n + r + i] = out[c + i];
+      }
+    }
+  }
+  for (c = 0; c < n; c += OD_SIMD_LANES) {
+    idct(out, buf + c / OD_SIMD_LANES * n);
+    for (i = 0; i < n; i++) od_store_pixels(output + i * stride + c, out[i]);
+  }
+}
+
+#define OD_SIMD_DCT_2D(n)                                                   \
+  void OD_SIMD_NAME(lift_fdct##n##x##n)(const int16_t *input,              \
+                                        tran_low_t *output, int stride) {  \
+    od_fdct_2d_simd(input, output, stride, n, od_fdct##n##_simd);          \
+  }                                                                        \
+  void OD_SIMD_NAME(lift_idct##n##x##n)(const tran_low_t *input,           \
+                                        int16_t *output, int stride) {     \
+    od_idct_2d_simd(input, output, stride, n, od_idct##n##_simd);          \
+  }
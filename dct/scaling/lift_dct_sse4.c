@@ -0,0 +1,62 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#include <smmintrin.h>
+
+#include "lift_dct.h"
+
+typedef __m128i od_simd;
+
+#define OD_SIMD_LANES (4)
+#define OD_SIMD_NAME(name) name##_sse4_1
+
+#define OD_ADD(a, b) _mm_add_epi32(a, b)
+#define OD_SUB(a, b) _mm_sub_epi32(a, b)
+#define OD_NEG(a) _mm_sub_epi32(_mm_setzero_si128(), a)
+#define OD_SHL(a, b) _mm_slli_epi32(a, b)
+#define OD_RSHIFT(a, b) \
+  _mm_srai_epi32(_mm_add_epi32(_mm_srli_epi32(a, 32 - (b)), a), b)
+#define OD_MUL(a, p, b)                                           \
+  _mm_srai_epi32(_mm_add_epi32(_mm_mullo_epi32(a, _mm_set1_epi32(p)), \
+                               _mm_set1_epi32(1 << ((b) - 1))),   \
+                 b)
+
+static INLINE od_simd od_load_pixels(const int16_t *p) {
+  return _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)p));
+}
+
+static INLINE void od_store_pixels(int16_t *p, od_simd v) {
+  _mm_storel_epi64((__m128i *)p, _mm_packs_epi32(v, v));
+}
+
+#if CONFIG_AOM_HIGHBITDEPTH
+static INLINE od_simd od_load_coeffs(const tran_low_t *p) {
+  return _mm_loadu_si128((const __m128i *)p);
+}
+
+static INLINE void od_store_coeffs(tran_low_t *p, od_simd v) {
+  _mm_storeu_si128((__m128i *)p, v);
+}
+#else
+#define od_load_coeffs od_load_pixels
+#define od_store_coeffs od_store_pixels
+#endif
+
+static INLINE void od_transpose(od_simd *t) {
+  const __m128i a0 = _mm_unpacklo_epi32(t[0], t[1]);
+  const __m128i a1 = _mm_unpacklo_epi32(t[2], t[3]);
+  const __m128i a2 = _mm_unpackhi_epi32(t[0], t[1]);
+  const __m128i a3 = _mm_unpackhi_epi32(t[2], t[3]);
+  t[0] = _mm_unpacklo_epi64(a0, a1);
+  t[1] = _mm_unpackhi_epi64(a0, a1);
+  t[2] = _mm_unpacklo_epi64(a2, a3);
+  t[3] = _mm_unpackhi_epi64(a2, a3);
+}
+
+#include "lift_dct_simd.h"
+
+OD_SIMD_DCT_2D(4)
+OD_SIMD_DCT_2D(8)
+OD_SIMD_DCT_2D(16)
+OD_SIMD_DCT_2D(32)
@@ -0,0 +1,108 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "aom/aom_integer.h"
+#include "aom_dsp/aom_dsp_common.h"
+
+#include "lift_dct.h"
+
+#define BLOCKS (4096)
+#define RUNS (20)
+
+typedef void (*fdct_2d)(const int16_t *input, tran_low_t *output, int stride);
+typedef void (*idct_2d)(const tran_low_t *input, int16_t *output, int stride);
+
+typedef struct {
+  const char *name;
+  fdct_2d fdct[4];
+  idct_2d idct[4];
+} impl;
+
+static const impl impls[] = {
+  { "C",
+    { lift_fdct4x4_c, lift_fdct8x8_c, lift_fdct16x16_c, lift_fdct32x32_c },
+    { lift_idct4x4_c, lift_idct8x8_c, lift_idct16x16_c,
+      lift_idct32x32_c } },
+  { "SSE4.1",
+    { lift_fdct4x4_sse4_1, lift_fdct8x8_sse4_1, lift_fdct16x16_sse4_1,
+      lift_fdct32x32_sse4_1 },
+    { lift_idct4x4_sse4_1, lift_idct8x8_sse4_1, lift_idct16x16_sse4_1,
+      lift_idct32x32_sse4_1 } },
+  { "AVX2",
+    { NULL, lift_fdct8x8_avx2, lift_fdct16x16_avx2, lift_fdct32x32_avx2 },
+    { NULL, lift_idct8x8_avx2, lift_idct16x16_avx2, lift_idct32x32_avx2 } },
+};
+
+#define NIMPLS ((int)(sizeof(impls) / sizeof(impls[0])))
+
+static int16_t residual[BLOCKS * 32 * 32];
+static tran_low_t coeffs[NIMPLS][BLOCKS * 32 * 32];
+static int16_t recon[NIMPLS][BLOCKS * 32 * 32];
+
+static double now() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int _argc, char **_argv) {
+  int s;
+  int i;
+  int k;
+  int r;
+  int errors = 0;
+  (void)_argc;
+  (void)_argv;
+  srand(0);
+  /* 8 bit residuals, with some extreme blocks. */
+  for (i = 0; i < BLOCKS * 32 * 32; i++) {
+    residual[i] = (i >> 10) % 8 == 0 ? ((rand() & 1) ? 255 : -255)
+                                     : rand() % 511 - 255;
+  }
+  printf("size,impl,fdct_ns,idct_ns,match\n");
+  for (s = 0; s < 4; s++) {
+    const int n = 4 << s;
+    const int n2 = n * n;
+    for (k = 0; k < NIMPLS; k++) {
+      double fdct_time;
+      double idct_time;
+      int match = 1;
+      if (!impls[k].fdct[s]) continue;
+      fdct_time = now();
+      for (r = 0; r < RUNS; r++) {
+        for (i = 0; i < BLOCKS; i++) {
+          impls[k].fdct[s](residual + i * 1024, coeffs[k] + i * n2, n);
+        }
+      }
+      fdct_time = now() - fdct_time;
+      idct_time = now();
+      for (r = 0; r < RUNS; r++) {
+        for (i = 0; i < BLOCKS; i++) {
+          impls[k].idct[s](coeffs[k] + i * n2, recon[k] + i * 1024, n);
+        }
+      }
+      idct_time = now() - idct_time;
+      for (i = 0; i < BLOCKS; i++) {
+        /* Reconstruction must be exact. */
+        if (memcmp(recon[k] + i * 1024, residual + i * 1024,
+                   n2 * sizeof(int16_t))) {
+          match = 0;
+        }
+      }
+      if (memcmp(coeffs[k], coeffs[0], BLOCKS * n2 * sizeof(tran_low_t))) {
+        match = 0;
+      }
+      errors += !match;
+      printf("%dx%d,%s,%.1f,%.1f,%s\n", n, n, impls[k].name,
+             fdct_time * 1e9 / (RUNS * BLOCKS),
+             idct_time * 1e9 / (RUNS * BLOCKS), match ? "yes" : "NO");
+    }
+  }
+  return errors != 0;
+}
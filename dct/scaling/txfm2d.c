@@ -0,0 +1,215 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#include "aom_dsp/fwd_txfm.h"
+#include "aom_dsp/inv_txfm.h"
+
+#include "lift_dct.h"
+#include "txfm2d.h"
+
+static const TxfmFunc1D txfm_fdct[] = {
+  aom_fdct4, daala_fdct4, lift_fdct8, lift_fdct16, lift_fdct32,
+};
+
+_Static_assert(sizeof(txfm_fdct) / sizeof(txfm_fdct[0]) == TXFM_FWDS,
+               "one txfm_fdct entry per TXFM_FWD");
+
+static const TxfmFunc1D txfm_idct[TXFM_FAMILIES][TXFM_SIZES] = {
+  { aom_idct4_c, aom_idct8_c, aom_idct16_c, aom_idct32_c },
+  { daala_idct4, lift_idct8, lift_idct16, lift_idct32 },
+};
+
+#if CONFIG_COEFFICIENT_RANGE_STATS
+/* The ranges of the range_check() calls of the original kernel, written for
+ * the columns of aom_fdct4x4_c (the rows get the 16 bit outputs of the
+ * columns). */
+static const int fdct4_range_bits[FDCT4_RANGE_STAGES] = { 14, 15, 16, 16 };
+
+static const char *const fdct4_range_pass_names[2] = { "cols", "rows" };
+
+// The largest magnitude of each stage of each pass, shared by the threads.
+static uint32_t fdct4_range_max[2][FDCT4_RANGE_STAGES];
+static uint64_t fdct4_range_count[2];
+
+// The pass the calling thread is running, -1 outside of the 2-D transforms
+// (those calls are not recorded).
+static __thread int fdct4_range_pass = -1;
+
+#define fdct4_range_begin(fwd, pass) \
+  fdct4_range_pass = (fwd) == TXFM_FWD_AOM_4X4 ? (pass) : -1
+#define fdct4_range_end() fdct4_range_pass = -1
+
+static void fdct4_range_check(int stage, const tran_low_t *buf) {
+  const int pass = fdct4_range_pass;
+  uint32_t max = 0;
+  uint32_t cur;
+  int i;
+  if (pass < 0) return;
+  for (i = 0; i < 4; i++) {
+    const uint32_t mag = buf[i] < 0 ? -(uint32_t)buf[i] : (uint32_t)buf[i];
+    if (mag > max) max = mag;
+  }
+  cur = __atomic_load_n(&fdct4_range_max[pass][stage], __ATOMIC_RELAXED);
+  while (max > cur &&
+         !__atomic_compare_exchange_n(&fdct4_range_max[pass][stage], &cur, max,
+                                      1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+  }
+  if (stage == 0) {
+    __atomic_fetch_add(&fdct4_range_count[pass], 1, __ATOMIC_RELAXED);
+  }
+}
+
+void aom_fdct4_range_stats_print(FILE *f) {
+  int pass;
+  int stage;
+  for (pass = 0; pass < 2; pass++) {
+    if (!fdct4_range_count[pass]) continue;
+    fprintf(f, "aom_fdct4 %s: %llu calls, bits per stage (range):",
+            fdct4_range_pass_names[pass],
+            (unsigned long long)fdct4_range_count[pass]);
+    for (stage = 0; stage < FDCT4_RANGE_STAGES; stage++) {
+      uint32_t max = fdct4_range_max[pass][stage];
+      // The bits of the largest magnitude, plus the sign.
+      int bits = 1;
+      while (max) {
+        bits++;
+        max >>= 1;
+      }
+      fprintf(f, " %d(%d)%s", bits, fdct4_range_bits[stage],
+              bits > fdct4_range_bits[stage] ? " over" : "");
+    }
+    fprintf(f, "\n");
+  }
+}
+#else
+#define fdct4_range_begin(fwd, pass) (void)(fwd)
+#define fdct4_range_end()
+#define fdct4_range_check(stage, buf) \
+  {                                   \
+    (void)(stage);                    \
+    (void)(buf);                      \
+  }
+#endif  // CONFIG_COEFFICIENT_RANGE_STATS
+
+void aom_fdct4(const tran_low_t *input, tran_low_t *output) {
+  tran_high_t temp;
+  tran_low_t step[4];
+
+  fdct4_range_check(0, input);
+
+  // stage 1
+  output[0] = input[0] + input[3];
+  output[1] = input[1] + input[2];
+  output[2] = input[1] - input[2];
+  output[3] = input[0] - input[3];
+  fdct4_range_check(1, output);
+
+  // stage 2
+  temp = output[0] * cospi_16_64 + output[1] * cospi_16_64;
+  step[0] = (tran_low_t)fdct_round_shift(temp);
+  temp = output[1] * -cospi_16_64 + output[0] * cospi_16_64;
+  step[1] = (tran_low_t)fdct_round_shift(temp);
+  temp = output[2] * cospi_24_64 + output[3] * cospi_8_64;
+  step[2] = (tran_low_t)fdct_round_shift(temp);
+  temp = output[3] * cospi_24_64 + output[2] * -cospi_8_64;
+  step[3] = (tran_low_t)fdct_round_shift(temp);
+  fdct4_range_check(2, step);
+
+  // stage 3
+  output[0] = step[0];
+  output[1] = step[2];
+  output[2] = step[1];
+  output[3] = step[3];
+  fdct4_range_check(3, output);
+}
+
+// Left shift for shift > 0, right shift adding round for shift < 0.
+static INLINE tran_high_t txfm_shift_round(tran_high_t value, int shift,
+                                           int round) {
+  const int left = AOMMAX(shift, 0);
+  const int right = AOMMAX(-shift, 0);
+  return (value * (1 << left) + round) >> right;
+}
+
+// Left shift for shift > 0, rounding right shift for shift < 0.
+static INLINE tran_high_t txfm_shift(tran_high_t value, int shift) {
+  return txfm_shift_round(value, shift, (1 << AOMMAX(-shift, 0)) >> 1);
+}
+
+void txfm2d_fwd_cols(TXFM_FWD fwd, const int16_t *input, int stride,
+                     tran_low_t *cols) {
+  const TXFM_FWD_SCALE *const scale = &txfm_fwd_scale[fwd];
+  const TxfmFunc1D fdct = txfm_fdct[fwd];
+  const int n = 4 << scale->size;
+  tran_low_t temp_in[32];
+  tran_low_t temp_out[32];
+  int i;
+  int j;
+  fdct4_range_begin(fwd, 0);
+  for (i = 0; i < n; i++) {
+    for (j = 0; j < n; j++) {
+      temp_in[j] = (tran_low_t)txfm_shift(input[j * stride + i],
+                                          scale->shift[0]);
+    }
+    if (i == 0) temp_in[0] += scale->dc_bias * (temp_in[0] != 0);
+    fdct(temp_in, temp_out);
+    for (j = 0; j < n; j++) {
+      cols[j * n + i] = (tran_low_t)txfm_shift(temp_out[j], scale->shift[1]);
+    }
+  }
+  fdct4_range_end();
+}
+
+void txfm2d_fwd_rows(TXFM_FWD fwd, const tran_low_t *cols,
+                     tran_low_t *output) {
+  const TXFM_FWD_SCALE *const scale = &txfm_fwd_scale[fwd];
+  const TxfmFunc1D fdct = txfm_fdct[fwd];
+  const int n = 4 << scale->size;
+  int i;
+  int j;
+  fdct4_range_begin(fwd, 1);
+  for (i = 0; i < n; i++) {
+    fdct(cols + i * n, output + i * n);
+    for (j = 0; j < n; j++) {
+      output[i * n + j] = (tran_low_t)txfm_shift_round(
+          output[i * n + j], scale->shift[2], scale->round);
+    }
+  }
+  fdct4_range_end();
+}
+
+void txfm2d_fwd(TXFM_FWD fwd, const int16_t *input, tran_low_t *output,
+                int stride) {
+  tran_low_t cols[32 * 32];
+  txfm2d_fwd_cols(fwd, input, stride, cols);
+  txfm2d_fwd_rows(fwd, cols, output);
+}
+
+void txfm2d_inv_add(TXFM_FAMILY family, TXFM_SIZE size,
+                    const tran_low_t *input, uint8_t *dest, int stride) {
+  const TXFM_SCALE *const scale = &txfm_scale[family][size];
+  const TxfmFunc1D idct = txfm_idct[family][size];
+  const int n = 4 << size;
+  tran_low_t rows[32 * 32];
+  tran_low_t temp_in[32];
+  tran_low_t temp_out[32];
+  int i;
+  int j;
+  for (i = 0; i < n; i++) {
+    idct(input + i * n, rows + i * n);
+    for (j = 0; j < n; j++) {
+      rows[i * n + j] = (tran_low_t)txfm_shift(rows[i * n + j],
+                                               scale->inv_shift[0]);
+    }
+  }
+  for (i = 0; i < n; i++) {
+    for (j = 0; j < n; j++) temp_in[j] = rows[j * n + i];
+    idct(temp_in, temp_out);
+    for (j = 0; j < n; j++) {
+      dest[j * stride + i] = clip_pixel(
+          dest[j * stride + i] + (int)txfm_shift(temp_out[j],
+                                                 scale->inv_shift[1]));
+    }
+  }
+}
@@ -0,0 +1,46 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#ifndef TXFM2D_H_
+#define TXFM2D_H_
+
+#include "aom/aom_integer.h"
+#include "aom_dsp/aom_dsp_common.h"
+
+#include "txfm_scale.h"
+
+typedef void (*TxfmFunc1D)(const tran_low_t *input, tran_low_t *output);
+
+// AOM's 1-D 4 point DCT (the columns and rows of aom_fdct4x4_c).
+void aom_fdct4(const tran_low_t *input, tran_low_t *output);
+
+#if CONFIG_COEFFICIENT_RANGE_STATS
+#include <stdio.h>
+
+// The stages of aom_fdct4 that are recorded: its input, the outputs of its
+// butterflies and of its rotations, and its output.
+#define FDCT4_RANGE_STAGES (4)
+
+// Prints the bit width (sign included) reached at each stage of aom_fdct4,
+// for the columns and the rows of txfm2d_fwd_cols/rows(TXFM_FWD_AOM_4X4),
+// next to the range the kernel was written for, and flags the stages over it.
+void aom_fdct4_range_stats_print(FILE *f);
+#endif  // CONFIG_COEFFICIENT_RANGE_STATS
+
+/* Forward 2-D DCTs, scaled with txfm_fwd_scale. The TXFM_FWD names the
+ * ones made of 1-D DCTs (the lifting DCTs, and AOM's 4x4; use aom_fdctNxN_c
+ * for the other AOM sizes). The forward is split in two passes so that the
+ * columns can be looked at. */
+void txfm2d_fwd_cols(TXFM_FWD fwd, const int16_t *input, int stride,
+                     tran_low_t *cols);
+void txfm2d_fwd_rows(TXFM_FWD fwd, const tran_low_t *cols,
+                     tran_low_t *output);
+void txfm2d_fwd(TXFM_FWD fwd, const int16_t *input, tran_low_t *output,
+                int stride);
+// Adds the inverse 2-D DCT of a family and size, scaled with txfm_scale, of
+// input to dest.
+void txfm2d_inv_add(TXFM_FAMILY family, TXFM_SIZE size,
+                    const tran_low_t *input, uint8_t *dest, int stride);
+
+#endif  // TXFM2D_H_
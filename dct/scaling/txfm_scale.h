@@ -0,0 +1,90 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#ifndef TXFM_SCALE_H_
+#define TXFM_SCALE_H_
+
+#include "aom/aom_integer.h"
+
+typedef enum TXFM_FAMILY { TXFM_AOM, TXFM_LIFT, TXFM_FAMILIES } TXFM_FAMILY;
+
+typedef enum TXFM_SIZE {
+  TXFM_4X4,
+  TXFM_8X8,
+  TXFM_16X16,
+  TXFM_32X32,
+  TXFM_SIZES
+} TXFM_SIZE;
+
+/* Scaling of a 2-D DCT made of two passes of 1-D DCTs. Like the shifts of
+ * AV1's TXFM_2D_CFG, positive shifts are left shifts and negative shifts
+ * are rounding right shifts. */
+typedef struct TXFM_SCALE {
+  // Inverse: after the rows and after the columns.
+  int8_t inv_shift[2];
+  // The coefficients are the orthonormal DCT coefficients * 2^scale_log2.
+  int8_t scale_log2;
+} TXFM_SCALE;
+
+/* AOM's 1-D DCTs have a gain of sqrt(N/2). The AOM shifts are the ones of
+ * aom_idctNxN_*_add_c.
+ *
+ * The lifting DCTs (Daala's 4 point DCT, and the 8 to 32 point DCTs of
+ * lift_dct.c) are orthonormal, so the pre-shift is scale_log2. AOM's 32x32
+ * has half the scale of the other sizes, so do the lifting DCTs, so that
+ * both families can share AV1's quantizers. */
+static const TXFM_SCALE txfm_scale[TXFM_FAMILIES][TXFM_SIZES] = {
+  {
+      { { 0, -4 }, 3 },  // AOM 4x4
+      { { 0, -5 }, 3 },  // AOM 8x8
+      { { 0, -6 }, 3 },  // AOM 16x16
+      { { 0, -6 }, 2 },  // AOM 32x32
+  },
+  {
+      { { 0, -3 }, 3 },  // Lifting 4x4
+      { { 0, -3 }, 3 },  // Lifting 8x8
+      { { 0, -3 }, 3 },  // Lifting 16x16
+      { { 0, -2 }, 2 },  // Lifting 32x32
+  },
+};
+
+/* The forward 2-D DCTs that can be made of 1-D DCTs: the lifting DCTs at all sizes,
+ * AOM's at 4x4 only. From 8x8 up, aom_fdctNxN_c does not round between (and
+ * after) the passes like a round shift would (the offsets depend on the sign
+ * of the values) and the 32x32 keeps 32 bit values between the passes, so
+ * the AOM forwards above 4x4 are aom_fdctNxN_c. */
+typedef enum TXFM_FWD {
+  TXFM_FWD_AOM_4X4,
+  TXFM_FWD_LIFT_4X4,
+  TXFM_FWD_LIFT_8X8,
+  TXFM_FWD_LIFT_16X16,
+  TXFM_FWD_LIFT_32X32,
+  TXFM_FWDS
+} TXFM_FWD;
+
+#define TXFM_FWD_LIFT(size) ((TXFM_FWD)(TXFM_FWD_LIFT_4X4 + (size)))
+
+typedef struct TXFM_FWD_SCALE {
+  TXFM_SIZE size;
+  // On the input, after the columns and after the rows.
+  int8_t shift[3];
+  // Offset added before the right shift after the rows (AOM adds 1, not 2,
+  // before its final >> 2).
+  int8_t round;
+  // Added to the DC input of the first column when it is not zero.
+  int8_t dc_bias;
+} TXFM_FWD_SCALE;
+
+static const TXFM_FWD_SCALE txfm_fwd_scale[] = {
+  { TXFM_4X4, { 4, 0, -2 }, 1, 1 },    // AOM 4x4
+  { TXFM_4X4, { 3, 0, 0 }, 0, 0 },     // Lifting 4x4
+  { TXFM_8X8, { 3, 0, 0 }, 0, 0 },     // Lifting 8x8
+  { TXFM_16X16, { 3, 0, 0 }, 0, 0 },   // Lifting 16x16
+  { TXFM_32X32, { 2, 0, 0 }, 0, 0 },   // Lifting 32x32
+};
+
+_Static_assert(sizeof(txfm_fwd_scale) / sizeof(txfm_fwd_scale[0])
+               == TXFM_FWDS, "one txfm_fwd_scale entry per TXFM_FWD");
+
+#endif  // TXFM_SCALE_H_
@@ -82,7 +82,12 @@
 #define CONFIG_TEMPORAL_DENOISING 1
 #define CONFIG_AV1_TEMPORAL_DENOISING 0
 #define CONFIG_COEFFICIENT_RANGE_CHECKING 0
+#ifndef CONFIG_COEFFICIENT_RANGE_STATS
+#define CONFIG_COEFFICIENT_RANGE_STATS 0
+#endif
+#ifndef CONFIG_AOM_HIGHBITDEPTH
 #define CONFIG_AOM_HIGHBITDEPTH 0
+#endif
 #define CONFIG_BETTER_HW_COMPATIBILITY 0
 #define CONFIG_EXPERIMENTAL 1
 #define CONFIG_SIZE_LIMIT 0
@@ -95,8 +100,12 @@
 #define CONFIG_RECT_TX 0
 #define CONFIG_REF_MV 1
 #define CONFIG_DUAL_FILTER 0
+#ifndef CONFIG_EXT_TX
 #define CONFIG_EXT_TX 0
-#define CONFIG_TX64X64 0
+#endif
+#ifndef CONFIG_TX64X64
+#define CONFIG_TX64X64 1
+#endif
 #define CONFIG_SUB8X8_MC 0
 #define CONFIG_EXT_INTRA 0
 #define CONFIG_INTRA_INTERP 0
@@ -122,9 +131,14 @@
 #define CONFIG_ALT_INTRA 0
 #define CONFIG_PALETTE 0
 #define CONFIG_DAALA_EC 1
+#ifndef CONFIG_PVQ
 #define CONFIG_PVQ 1
+#endif
 #define CONFIG_DCT_ONLY 0
 #define CONFIG_CFL 0
+#ifndef CONFIG_CFL_STATS
+#define CONFIG_CFL_STATS 0
+#endif
 #define CONFIG_CB4X4 0
 #define CONFIG_FRAME_SIZE 0
 #define CONFIG_DELTA_Q 1
@@ -0,0 +1,179 @@
+#ifndef AOM_TXFM_RTCD_H_
+#define AOM_TXFM_RTCD_H_
+
+#ifdef RTCD_C
+#define RTCD_EXTERN
+#else
+#define RTCD_EXTERN extern
+#endif
+
+/*
+ * DSP transforms
+ *
+ * The DCTs (and the 8x8 Hadamard) of aom_dsp_rtcd.h that have C and
+ * intrinsics versions, for the experiments that build their own copy of
+ * aom_dsp. Unlike in aom_dsp_rtcd.h, the SSE2 versions are selected at run
+ * time too, so that aom_txfm_rtcd() can fall back on the C versions. The
+ * SSSE3 versions are assembly and are not built.
+ */
+
+#include "aom/aom_integer.h"
+#include "aom_dsp/aom_dsp_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void aom_fdct16x16_c(const int16_t *input, tran_low_t *output, int stride);
+void aom_fdct16x16_sse2(const int16_t *input, tran_low_t *output, int stride);
+RTCD_EXTERN void (*aom_fdct16x16)(const int16_t *input, tran_low_t *output, int stride);
+
+void aom_fdct16x16_1_c(const int16_t *input, tran_low_t *output, int stride);
+void aom_fdct16x16_1_sse2(const int16_t *input, tran_low_t *output, int stride);
+RTCD_EXTERN void (*aom_fdct16x16_1)(const int16_t *input, tran_low_t *output, int stride);
+
+void aom_fdct32x32_c(const int16_t *input, tran_low_t *output, int stride);
+void aom_fdct32x32_sse2(const int16_t *input, tran_low_t *output, int stride);
+void aom_fdct32x32_avx2(const int16_t *input, tran_low_t *output, int stride);
+RTCD_EXTERN void (*aom_fdct32x32)(const int16_t *input, tran_low_t *output, int stride);
+
+void aom_fdct32x32_1_c(const int16_t *input, tran_low_t *output, int stride);
+void aom_fdct32x32_1_sse2(const int16_t *input, tran_low_t *output, int stride);
+RTCD_EXTERN void (*aom_fdct32x32_1)(const int16_t *input, tran_low_t *output, int stride);
+
+void aom_fdct32x32_rd_c(const int16_t *input, tran_low_t *output, int stride);
+void aom_fdct32x32_rd_sse2(const int16_t *input, tran_low_t *output, int stride);
+void aom_fdct32x32_rd_avx2(const int16_t *input, tran_low_t *output, int stride);
+RTCD_EXTERN void (*aom_fdct32x32_rd)(const int16_t *input, tran_low_t *output, int stride);
+
+void aom_fdct4x4_c(const int16_t *input, tran_low_t *output, int stride);
+void aom_fdct4x4_sse2(const int16_t *input, tran_low_t *output, int stride);
+RTCD_EXTERN void (*aom_fdct4x4)(const int16_t *input, tran_low_t *output, int stride);
+
+void aom_fdct4x4_1_c(const int16_t *input, tran_low_t *output, int stride);
+void aom_fdct4x4_1_sse2(const int16_t *input, tran_low_t *output, int stride);
+RTCD_EXTERN void (*aom_fdct4x4_1)(const int16_t *input, tran_low_t *output, int stride);
+
+void aom_fdct8x8_c(const int16_t *input, tran_low_t *output, int stride);
+void aom_fdct8x8_sse2(const int16_t *input, tran_low_t *output, int stride);
+RTCD_EXTERN void (*aom_fdct8x8)(const int16_t *input, tran_low_t *output, int stride);
+
+void aom_fdct8x8_1_c(const int16_t *input, tran_low_t *output, int stride);
+void aom_fdct8x8_1_sse2(const int16_t *input, tran_low_t *output, int stride);
+RTCD_EXTERN void (*aom_fdct8x8_1)(const int16_t *input, tran_low_t *output, int stride);
+
+void aom_hadamard_8x8_c(const int16_t *src_diff, int src_stride, int16_t *coeff);
+void aom_hadamard_8x8_sse2(const int16_t *src_diff, int src_stride, int16_t *coeff);
+RTCD_EXTERN void (*aom_hadamard_8x8)(const int16_t *src_diff, int src_stride, int16_t *coeff);
+
+void aom_idct16x16_10_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct16x16_10_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+RTCD_EXTERN void (*aom_idct16x16_10_add)(const tran_low_t *input, uint8_t *dest, int dest_stride);
+
+void aom_idct16x16_1_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct16x16_1_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+RTCD_EXTERN void (*aom_idct16x16_1_add)(const tran_low_t *input, uint8_t *dest, int dest_stride);
+
+void aom_idct16x16_256_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct16x16_256_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+RTCD_EXTERN void (*aom_idct16x16_256_add)(const tran_low_t *input, uint8_t *dest, int dest_stride);
+
+void aom_idct32x32_1024_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct32x32_1024_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+RTCD_EXTERN void (*aom_idct32x32_1024_add)(const tran_low_t *input, uint8_t *dest, int dest_stride);
+
+void aom_idct32x32_135_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+RTCD_EXTERN void (*aom_idct32x32_135_add)(const tran_low_t *input, uint8_t *dest, int dest_stride);
+
+void aom_idct32x32_1_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct32x32_1_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+RTCD_EXTERN void (*aom_idct32x32_1_add)(const tran_low_t *input, uint8_t *dest, int dest_stride);
+
+void aom_idct32x32_34_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct32x32_34_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+RTCD_EXTERN void (*aom_idct32x32_34_add)(const tran_low_t *input, uint8_t *dest, int dest_stride);
+
+void aom_idct4x4_16_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct4x4_16_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+RTCD_EXTERN void (*aom_idct4x4_16_add)(const tran_low_t *input, uint8_t *dest, int dest_stride);
+
+void aom_idct4x4_1_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct4x4_1_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+RTCD_EXTERN void (*aom_idct4x4_1_add)(const tran_low_t *input, uint8_t *dest, int dest_stride);
+
+void aom_idct8x8_12_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct8x8_12_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+RTCD_EXTERN void (*aom_idct8x8_12_add)(const tran_low_t *input, uint8_t *dest, int dest_stride);
+
+void aom_idct8x8_1_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct8x8_1_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+RTCD_EXTERN void (*aom_idct8x8_1_add)(const tran_low_t *input, uint8_t *dest, int dest_stride);
+
+void aom_idct8x8_64_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct8x8_64_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+RTCD_EXTERN void (*aom_idct8x8_64_add)(const tran_low_t *input, uint8_t *dest, int dest_stride);
+
+// Selects the versions of the transforms for the CPU, or the C versions
+// when force_c is set. Call it before the first transform.
+void aom_txfm_rtcd(int force_c);
+
+#ifdef RTCD_C
+#include "aom_ports/x86.h"
+static void setup_rtcd_internal(int flags)
+{
+    (void)flags;
+
+    aom_fdct16x16 = aom_fdct16x16_c;
+    if (flags & HAS_SSE2) aom_fdct16x16 = aom_fdct16x16_sse2;
+    aom_fdct16x16_1 = aom_fdct16x16_1_c;
+    if (flags & HAS_SSE2) aom_fdct16x16_1 = aom_fdct16x16_1_sse2;
+    aom_fdct32x32 = aom_fdct32x32_c;
+    if (flags & HAS_SSE2) aom_fdct32x32 = aom_fdct32x32_sse2;
+    if (flags & HAS_AVX2) aom_fdct32x32 = aom_fdct32x32_avx2;
+    aom_fdct32x32_1 = aom_fdct32x32_1_c;
+    if (flags & HAS_SSE2) aom_fdct32x32_1 = aom_fdct32x32_1_sse2;
+    aom_fdct32x32_rd = aom_fdct32x32_rd_c;
+    if (flags & HAS_SSE2) aom_fdct32x32_rd = aom_fdct32x32_rd_sse2;
+    if (flags & HAS_AVX2) aom_fdct32x32_rd = aom_fdct32x32_rd_avx2;
+    aom_fdct4x4 = aom_fdct4x4_c;
+    if (flags & HAS_SSE2) aom_fdct4x4 = aom_fdct4x4_sse2;
+    aom_fdct4x4_1 = aom_fdct4x4_1_c;
+    if (flags & HAS_SSE2) aom_fdct4x4_1 = aom_fdct4x4_1_sse2;
+    aom_fdct8x8 = aom_fdct8x8_c;
+    if (flags & HAS_SSE2) aom_fdct8x8 = aom_fdct8x8_sse2;
+    aom_fdct8x8_1 = aom_fdct8x8_1_c;
+    if (flags & HAS_SSE2) aom_fdct8x8_1 = aom_fdct8x8_1_sse2;
+    aom_hadamard_8x8 = aom_hadamard_8x8_c;
+    if (flags & HAS_SSE2) aom_hadamard_8x8 = aom_hadamard_8x8_sse2;
+    aom_idct16x16_10_add = aom_idct16x16_10_add_c;
+    if (flags & HAS_SSE2) aom_idct16x16_10_add = aom_idct16x16_10_add_sse2;
+    aom_idct16x16_1_add = aom_idct16x16_1_add_c;
+    if (flags & HAS_SSE2) aom_idct16x16_1_add = aom_idct16x16_1_add_sse2;
+    aom_idct16x16_256_add = aom_idct16x16_256_add_c;
+    if (flags & HAS_SSE2) aom_idct16x16_256_add = aom_idct16x16_256_add_sse2;
+    aom_idct32x32_1024_add = aom_idct32x32_1024_add_c;
+    if (flags & HAS_SSE2) aom_idct32x32_1024_add = aom_idct32x32_1024_add_sse2;
+    aom_idct32x32_135_add = aom_idct32x32_135_add_c;
+    if (flags & HAS_SSE2) aom_idct32x32_135_add = aom_idct32x32_1024_add_sse2;
+    aom_idct32x32_1_add = aom_idct32x32_1_add_c;
+    if (flags & HAS_SSE2) aom_idct32x32_1_add = aom_idct32x32_1_add_sse2;
+    aom_idct32x32_34_add = aom_idct32x32_34_add_c;
+    if (flags & HAS_SSE2) aom_idct32x32_34_add = aom_idct32x32_34_add_sse2;
+    aom_idct4x4_16_add = aom_idct4x4_16_add_c;
+    if (flags & HAS_SSE2) aom_idct4x4_16_add = aom_idct4x4_16_add_sse2;
+    aom_idct4x4_1_add = aom_idct4x4_1_add_c;
+    if (flags & HAS_SSE2) aom_idct4x4_1_add = aom_idct4x4_1_add_sse2;
+    aom_idct8x8_12_add = aom_idct8x8_12_add_c;
+    if (flags & HAS_SSE2) aom_idct8x8_12_add = aom_idct8x8_12_add_sse2;
+    aom_idct8x8_1_add = aom_idct8x8_1_add_c;
+    if (flags & HAS_SSE2) aom_idct8x8_1_add = aom_idct8x8_1_add_sse2;
+    aom_idct8x8_64_add = aom_idct8x8_64_add_c;
+    if (flags & HAS_SSE2) aom_idct8x8_64_add = aom_idct8x8_64_add_sse2;
+}
+#endif
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef AOM_DSP_RTCD_H_
+#define AOM_DSP_RTCD_H_
+
+#ifdef RTCD_C
+#define RTCD_EXTERN
+#else
+#define RTCD_EXTERN extern
+#endif
+
+/*
+ * DSP
+ *
+ * Only the 8 bit inverse transforms that av1/common/idct.c calls, for the
+ * harness of the hybrid inverse (hybrid_inv_check.c). The SSE2 versions are
+ * in aom_dsp/x86/inv_txfm_sse2.c, the Walsh-Hadamard ones are C only (their
+ * SSE2 versions are assembly and are not built).
+ */
+
+#include "aom/aom_integer.h"
+#include "aom_dsp/aom_dsp_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void aom_idct16x16_10_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct16x16_10_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+#define aom_idct16x16_10_add aom_idct16x16_10_add_sse2
+
+void aom_idct16x16_1_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct16x16_1_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+#define aom_idct16x16_1_add aom_idct16x16_1_add_sse2
+
+void aom_idct16x16_256_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct16x16_256_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+#define aom_idct16x16_256_add aom_idct16x16_256_add_sse2
+
+void aom_idct32x32_1024_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct32x32_1024_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+#define aom_idct32x32_1024_add aom_idct32x32_1024_add_sse2
+
+void aom_idct32x32_1_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct32x32_1_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+#define aom_idct32x32_1_add aom_idct32x32_1_add_sse2
+
+void aom_idct32x32_34_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct32x32_34_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+#define aom_idct32x32_34_add aom_idct32x32_34_add_sse2
+
+void aom_idct4x4_16_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct4x4_16_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+#define aom_idct4x4_16_add aom_idct4x4_16_add_sse2
+
+void aom_idct4x4_1_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct4x4_1_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+#define aom_idct4x4_1_add aom_idct4x4_1_add_sse2
+
+void aom_idct8x8_12_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct8x8_12_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+#define aom_idct8x8_12_add aom_idct8x8_12_add_sse2
+
+void aom_idct8x8_1_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct8x8_1_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+#define aom_idct8x8_1_add aom_idct8x8_1_add_sse2
+
+void aom_idct8x8_64_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+void aom_idct8x8_64_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride);
+#define aom_idct8x8_64_add aom_idct8x8_64_add_sse2
+
+void aom_iwht4x4_16_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+#define aom_iwht4x4_16_add aom_iwht4x4_16_add_c
+
+void aom_iwht4x4_1_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride);
+#define aom_iwht4x4_1_add aom_iwht4x4_1_add_c
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2016, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#ifndef AOM_PORTS_X86_H_
+#define AOM_PORTS_X86_H_
+#include <stdlib.h>
+
+#include "./aom_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HAS_MMX 0x01
+#define HAS_SSE 0x02
+#define HAS_SSE2 0x04
+#define HAS_SSE3 0x08
+#define HAS_SSSE3 0x10
+#define HAS_SSE4_1 0x20
+#define HAS_AVX 0x40
+#define HAS_AVX2 0x80
+
+// Only the x86_simd_caps() of libaom is kept, and the CPU is queried with the
+// __builtin_cpu_supports() of GCC and clang instead of cpuid. Like in libaom,
+// AOM_SIMD_CAPS replaces the detected flags and AOM_SIMD_CAPS_MASK masks
+// them.
+static INLINE int x86_simd_caps(void) {
+  unsigned int flags = 0;
+  unsigned int mask = ~0;
+  char *env;
+
+  // See if the CPU capabilities are being overridden by the environment.
+  env = getenv("AOM_SIMD_CAPS");
+  if (env && *env) return (int)strtol(env, NULL, 0);
+
+  env = getenv("AOM_SIMD_CAPS_MASK");
+  if (env && *env) mask = (unsigned int)strtoul(env, NULL, 0);
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  __builtin_cpu_init();
+  flags |= __builtin_cpu_supports("mmx") ? HAS_MMX : 0;
+  flags |= __builtin_cpu_supports("sse") ? HAS_SSE : 0;
+  flags |= __builtin_cpu_supports("sse2") ? HAS_SSE2 : 0;
+  flags |= __builtin_cpu_supports("sse3") ? HAS_SSE3 : 0;
+  flags |= __builtin_cpu_supports("ssse3") ? HAS_SSSE3 : 0;
+  flags |= __builtin_cpu_supports("sse4.1") ? HAS_SSE4_1 : 0;
+  flags |= __builtin_cpu_supports("avx") ? HAS_AVX : 0;
+  flags |= __builtin_cpu_supports("avx2") ? HAS_AVX2 : 0;
+#endif
+
+  return flags & mask;
+}
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // AOM_PORTS_X86_H_
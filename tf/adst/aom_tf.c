@@ -8,6 +8,7 @@
 
 #include "vidinput.h"
 
+#include "aom_dsp/aom_dsp_common.h"
 #include "av1/common/av1_fwd_txfm1d.h"
 
 #include "utils/luma2png.h"
@@ -24,6 +25,9 @@ void av1_fwd_txfm2d_8x8_c(const int16_t *input, int32_t *output, int stride,
 void av1_fwd_txfm2d_16x16_c(const int16_t *input, int32_t *output, int stride,
     int tx_type, int bd);
 
+void av1_fwd_txfm2d_32x32_c(const int16_t *input, int32_t *output, int stride,
+    int tx_type, int bd);
+
 void av1_inv_txfm2d_add_8x8_c(const int32_t *input, uint16_t *output,
     int stride, int tx_type, int bd);
 
@@ -33,6 +37,23 @@ void av1_inv_txfm2d_add_16x16_c(const int32_t *input, uint16_t *output,
 void av1_inv_txfm2d_add_32x32_c(const int32_t *input, uint16_t *output,
     int stride, int tx_type, int bd);
 
+void av1_inv_txfm2d_add_64x64_c(const int32_t *input, uint16_t *output,
+    int stride, int tx_type, int bd);
+
+// log2 of the scale of the AV1 forward 2-D transforms, relative to the
+// orthonormal DCT: the coefficients are 8 times bigger up to 16x16, 4 times
+// for 32x32 and 2 times for 64x64 (like cfl_tx_scale_log2() in cfl.c).
+static int aom_fwd_tx_scale_log2(int tx_size) {
+  return tx_size <= 16 ? 3 : (tx_size == 32 ? 2 : 1);
+}
+
+// log2 of the scale the AV1 inverse 2-D transforms expect. It is the one of
+// the forward transforms, except for 64x64 where the shifts of the inverse
+// ({ -1, -7 }) expect coefficients 8 times bigger than the orthonormal DCT.
+static int aom_inv_tx_scale_log2(int tx_size) {
+  return tx_size == 64 ? 3 : aom_fwd_tx_scale_log2(tx_size);
+}
+
 /*This is an in-place, reversible, orthonormal Haar transform in 7 adds,
   1 shift (2 operations per sample).
   It is its own inverse (but requires swapping lh and hl on one side for
@@ -82,6 +103,37 @@ void od_tf_up_hv(tran_high_t *dst, int dstride, const tran_high_t *const  src,
   }
 }
 
+/*Increase horizontal and vertical frequency resolution of a 2x2 group of
+  nxn blocks and return the LF quarter of the 2nx2n block (the nxn block of
+  its lowest frequencies).*/
+void od_tf_up_hv_lp(tran_high_t *dst, int dstride,
+    const tran_high_t *const src, int sstride, int n) {
+  int x;
+  int y;
+  for (y = 0; y < n >> 1; y++) {
+    int vswap;
+    vswap = y & 1;
+    for (x = 0; x < n >> 1; x++) {
+      tran_high_t ll;
+      tran_high_t lh;
+      tran_high_t hl;
+      tran_high_t hh;
+      int hswap;
+      ll = src[y*sstride + x];
+      lh = src[y*sstride + x + n];
+      hl = src[(y + n)*sstride + x];
+      hh = src[(y + n)*sstride + x + n];
+      /*We swap lh and hl for compatibility with od_tf_up_hv.*/
+      OD_HAAR_KERNEL(ll, hl, lh, hh);
+      hswap = x & 1;
+      dst[(2*y + vswap)*dstride + 2*x + hswap] = ll;
+      dst[(2*y + vswap)*dstride + 2*x + 1 - hswap] = lh;
+      dst[(2*y + 1 - vswap)*dstride + 2*x + hswap] = hl;
+      dst[(2*y + 1 - vswap)*dstride + 2*x + 1 - hswap] = hh;
+    }
+  }
+}
+
 int main(int _argc,char **_argv) {
   int x,y, i, j;
   int bx,by; // position inside the block
@@ -120,6 +172,11 @@ int main(int _argc,char **_argv) {
   const int big_block_square = big_block_size * big_block_size;
   const int bottom_left = block_size * big_block_size;
   const int bottom_right = bottom_left + block_size;
+  // The Haar kernels are orthonormal, the merged coefficients have the scale
+  // of the small forward transform and are brought to the scale of the big
+  // inverse transform (down for 16x16 -> 32x32, up for 32x32 -> 64x64).
+  const int tx_scale_shift =
+      aom_fwd_tx_scale_log2(block_size) - aom_inv_tx_scale_log2(big_block_size);
 
   // Original block copied from Y4M
   tran_low_t *block = (tran_low_t*) calloc(big_block_square,
@@ -160,6 +217,15 @@ int main(int _argc,char **_argv) {
       dct = &av1_fwd_txfm2d_16x16_c;
       idct = &av1_inv_txfm2d_add_32x32_c;
       break;
+    case 32:
+      // DCT_DCT only, the 64x64 transforms have no ADST.
+      if (inv_tran_type != 0) {
+        fprintf(stderr, "The 64x64 inverse transform is DCT only\n");
+        return -1;
+      }
+      dct = &av1_fwd_txfm2d_32x32_c;
+      idct = &av1_inv_txfm2d_add_64x64_c;
+      break;
     default:
       fprintf(stderr, "Invalid block size\n");
       fprintf(stderr, "Values are: 4, 8, 16, 32\n");
@@ -192,8 +258,25 @@ int main(int _argc,char **_argv) {
         }
       }
 
-      od_tf_up_hv(tf_block, big_block_size, big_dct_block, big_block_size,
-                  block_size);
+      if (big_block_size == 64) {
+        // The 64x64 inverse only reads the upper-left 32x32 coefficients (the
+        // others are zeroed out), so only the LF quarter of the merge is
+        // computed. The rest of tf_block stays zero.
+        od_tf_up_hv_lp(tf_block, big_block_size, big_dct_block,
+                       big_block_size, block_size);
+      } else {
+        od_tf_up_hv(tf_block, big_block_size, big_dct_block, big_block_size,
+                    block_size);
+      }
+      if (tx_scale_shift > 0) {
+        for (i = 0; i < big_block_square; i++) {
+          tf_block[i] = ROUND_POWER_OF_TWO_SIGNED(tf_block[i], tx_scale_shift);
+        }
+      } else if (tx_scale_shift < 0) {
+        for (i = 0; i < big_block_square; i++) {
+          tf_block[i] *= 1 << -tx_scale_shift;
+        }
+      }
 
       idct(tf_block, idct_block, big_block_size, inv_tran_type, 14);
 
@@ -203,7 +286,8 @@ int main(int _argc,char **_argv) {
           fx = x + bx;
 
           // Copy the 32 bit block coeffs to 8 bit pixels
-          out[out_width * fy + fx] = idct_block[big_block_size * by + bx];
+          out[out_width * fy + fx] =
+              clip_pixel(idct_block[big_block_size * by + bx]);
         }
       }
     }
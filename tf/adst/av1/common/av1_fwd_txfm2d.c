@@ -10,112 +10,273 @@
  */
 
 #include <assert.h>
+#include <string.h>
 
 #include "./av1_rtcd.h"
 #include "av1/common/enums.h"
 #include "av1/common/av1_fwd_txfm1d.h"
+#include "av1/common/av1_fwd_txfm1d_kernels.h"
 #include "av1/common/av1_fwd_txfm2d_cfg.h"
 #include "av1/common/av1_txfm.h"
 
-static INLINE TxfmFunc fwd_txfm_type_to_func(TXFM_TYPE txfm_type) {
+/* The 1-D transforms of the passes with the shifts of the 2-D configs folded
+ * in: shift[0] and shift[1] in the columns, shift[2] in the rows. The shifts
+ * only depend on the size. */
+#define FWD_TXFM2D_PASSES(name, n)                                             \
+  static AOM_FORCE_INLINE void name##_col(                                     \
+      const int32_t *input, int32_t *output, const int8_t *cos_bit,            \
+      const int8_t *stage_range) {                                             \
+    av1_##name##_kernel(input, output, cos_bit, stage_range,                   \
+                        fwd_shift_dct_dct_##n[0], -fwd_shift_dct_dct_##n[1]);  \
+  }                                                                            \
+  static AOM_FORCE_INLINE void name##_row(                                     \
+      const int32_t *input, int32_t *output, const int8_t *cos_bit,            \
+      const int8_t *stage_range) {                                             \
+    av1_##name##_kernel(input, output, cos_bit, stage_range, 0,                \
+                        -fwd_shift_dct_dct_##n[2]);                            \
+  }
+
+FWD_TXFM2D_PASSES(fdct4, 4)
+FWD_TXFM2D_PASSES(fdct8, 8)
+FWD_TXFM2D_PASSES(fdct16, 16)
+FWD_TXFM2D_PASSES(fdct32, 32)
+FWD_TXFM2D_PASSES(fadst4, 4)
+FWD_TXFM2D_PASSES(fadst8, 8)
+FWD_TXFM2D_PASSES(fadst16, 16)
+FWD_TXFM2D_PASSES(fadst32, 32)
+#if CONFIG_TX64X64
+FWD_TXFM2D_PASSES(fdct64, 64)
+#endif  // CONFIG_TX64X64
+
+/* The 1-D transforms of the passes, called directly (not through a TxfmFunc)
+ * so that they are inlined: with a constant config the switches fold into
+ * one transform, specialized for its constant inputs. */
+static AOM_FORCE_INLINE void fwd_txfm_col(TXFM_TYPE txfm_type,
+                                          const int32_t *input,
+                                          int32_t *output,
+                                          const int8_t *cos_bit,
+                                          const int8_t *stage_range) {
   switch (txfm_type) {
-    case TXFM_TYPE_DCT4: return av1_fdct4_new;
-    case TXFM_TYPE_DCT8: return av1_fdct8_new;
-    case TXFM_TYPE_DCT16: return av1_fdct16_new;
-    case TXFM_TYPE_DCT32: return av1_fdct32_new;
-    case TXFM_TYPE_ADST4: return av1_fadst4_new;
-    case TXFM_TYPE_ADST8: return av1_fadst8_new;
-    case TXFM_TYPE_ADST16: return av1_fadst16_new;
-    case TXFM_TYPE_ADST32: return av1_fadst32_new;
-    default: assert(0); return NULL;
+    case TXFM_TYPE_DCT4: fdct4_col(input, output, cos_bit, stage_range); break;
+    case TXFM_TYPE_DCT8: fdct8_col(input, output, cos_bit, stage_range); break;
+    case TXFM_TYPE_DCT16:
+      fdct16_col(input, output, cos_bit, stage_range);
+      break;
+    case TXFM_TYPE_DCT32:
+      fdct32_col(input, output, cos_bit, stage_range);
+      break;
+#if CONFIG_TX64X64
+    case TXFM_TYPE_DCT64:
+      fdct64_col(input, output, cos_bit, stage_range);
+      break;
+#endif  // CONFIG_TX64X64
+    case TXFM_TYPE_ADST4:
+      fadst4_col(input, output, cos_bit, stage_range);
+      break;
+    case TXFM_TYPE_ADST8:
+      fadst8_col(input, output, cos_bit, stage_range);
+      break;
+    case TXFM_TYPE_ADST16:
+      fadst16_col(input, output, cos_bit, stage_range);
+      break;
+    case TXFM_TYPE_ADST32:
+      fadst32_col(input, output, cos_bit, stage_range);
+      break;
+    default: assert(0);
+  }
+}
+
+static AOM_FORCE_INLINE void fwd_txfm_row(TXFM_TYPE txfm_type,
+                                          const int32_t *input,
+                                          int32_t *output,
+                                          const int8_t *cos_bit,
+                                          const int8_t *stage_range) {
+  switch (txfm_type) {
+    case TXFM_TYPE_DCT4: fdct4_row(input, output, cos_bit, stage_range); break;
+    case TXFM_TYPE_DCT8: fdct8_row(input, output, cos_bit, stage_range); break;
+    case TXFM_TYPE_DCT16:
+      fdct16_row(input, output, cos_bit, stage_range);
+      break;
+    case TXFM_TYPE_DCT32:
+      fdct32_row(input, output, cos_bit, stage_range);
+      break;
+#if CONFIG_TX64X64
+    case TXFM_TYPE_DCT64:
+      fdct64_row(input, output, cos_bit, stage_range);
+      break;
+#endif  // CONFIG_TX64X64
+    case TXFM_TYPE_ADST4:
+      fadst4_row(input, output, cos_bit, stage_range);
+      break;
+    case TXFM_TYPE_ADST8:
+      fadst8_row(input, output, cos_bit, stage_range);
+      break;
+    case TXFM_TYPE_ADST16:
+      fadst16_row(input, output, cos_bit, stage_range);
+      break;
+    case TXFM_TYPE_ADST32:
+      fadst32_row(input, output, cos_bit, stage_range);
+      break;
+    default: assert(0);
   }
 }
 
-void fwd_txfm2d_c(const int16_t *input, int32_t *output,
-                                const int stride, const TXFM_2D_FLIP_CFG *cfg,
-                                int32_t *buf) {
+/* The 2-D transform of a config. With a constant config (the instances of
+ * FWD_TXFM2D below), the switches of fwd_txfm_col() and fwd_txfm_row() fold,
+ * so the 1-D transforms are inlined with constant sizes, shifts and
+ * cos_bit.
+ *
+ * Like in AV1, the 64-point transforms only keep the upper-left 32x32
+ * coefficients: the high frequencies are zeroed out, so the rows below 32
+ * are not transformed. */
+static AOM_FORCE_INLINE void fwd_txfm2d(const int16_t *input, int32_t *output,
+                                        const int stride,
+                                        const TXFM_2D_CFG *cfg,
+                                        const int ud_flip, const int lr_flip,
+                                        int32_t *buf) {
   int c, r;
-  const int txfm_size = cfg->cfg->txfm_size;
-  const int8_t *shift = cfg->cfg->shift;
-  const int8_t *stage_range_col = cfg->cfg->stage_range_col;
-  const int8_t *stage_range_row = cfg->cfg->stage_range_row;
-  const int8_t *cos_bit_col = cfg->cfg->cos_bit_col;
-  const int8_t *cos_bit_row = cfg->cfg->cos_bit_row;
-  const TxfmFunc txfm_func_col = fwd_txfm_type_to_func(cfg->cfg->txfm_type_col);
-  const TxfmFunc txfm_func_row = fwd_txfm_type_to_func(cfg->cfg->txfm_type_row);
-
-  // use output buffer as temp buffer
-  int32_t *temp_in = output;
-  int32_t *temp_out = output + txfm_size;
+  const int txfm_size = cfg->txfm_size;
+  const int nz = AOMMIN(txfm_size, 32);
+  const int8_t *stage_range_col = cfg->stage_range_col;
+  const int8_t *stage_range_row = cfg->stage_range_row;
+  const int8_t *cos_bit_col = cfg->cos_bit_col;
+  const int8_t *cos_bit_row = cfg->cos_bit_row;
+  const TXFM_TYPE txfm_type_col = cfg->txfm_type_col;
+  const TXFM_TYPE txfm_type_row = cfg->txfm_type_row;
+
+  // buf holds 2 * txfm_size * txfm_size coefficients. The columns are
+  // transposed into the output (used as a temporary buffer), so that both
+  // passes work on contiguous rows.
+  int32_t *cols = buf;
+  int32_t *rows = buf + txfm_size * txfm_size;
+
+  // The flips are folded into the transposes: flipping upside down reads the
+  // rows from the bottom up (negative stride) and flipping left to right
+  // stores the columns from the last row, so the loops do not branch.
+  int32_t *col_out = lr_flip ? cols + (txfm_size - 1) * txfm_size : cols;
+  const int col_step = lr_flip ? -txfm_size : txfm_size;
+  av1_transpose_int16_to_int32(
+      ud_flip ? input + (txfm_size - 1) * stride : input,
+      ud_flip ? -stride : stride, output, txfm_size);
 
   // Columns
+#if CONFIG_COEFFICIENT_RANGE_STATS
+  av1_txfm_range_stats_begin(TXFM_RANGE_FWD_COL, txfm_type_col);
+#endif
   for (c = 0; c < txfm_size; ++c) {
-    if (cfg->ud_flip == 0) {
-      for (r = 0; r < txfm_size; ++r) temp_in[r] = input[r * stride + c];
-    } else {
-      for (r = 0; r < txfm_size; ++r)
-        // flip upside down
-        temp_in[r] = input[(txfm_size - r - 1) * stride + c];
-    }
-    round_shift_array(temp_in, txfm_size, -shift[0]);
-    txfm_func_col(temp_in, temp_out, cos_bit_col, stage_range_col);
-    round_shift_array(temp_out, txfm_size, -shift[1]);
-    if (cfg->lr_flip == 0) {
-      for (r = 0; r < txfm_size; ++r) buf[r * txfm_size + c] = temp_out[r];
-    } else {
-      for (r = 0; r < txfm_size; ++r)
-        // flip from left to right
-        buf[r * txfm_size + (txfm_size - c - 1)] = temp_out[r];
-    }
+    fwd_txfm_col(txfm_type_col, output + c * txfm_size, col_out, cos_bit_col,
+                 stage_range_col);
+    col_out += col_step;
   }
 
+  av1_transpose_int32(cols, rows, txfm_size, txfm_size);
+
   // Rows
-  for (r = 0; r < txfm_size; ++r) {
-    txfm_func_row(buf + r * txfm_size, output + r * txfm_size, cos_bit_row,
-                  stage_range_row);
-    round_shift_array(output + r * txfm_size, txfm_size, -shift[2]);
+#if CONFIG_COEFFICIENT_RANGE_STATS
+  av1_txfm_range_stats_begin(TXFM_RANGE_FWD_ROW, txfm_type_row);
+#endif
+  for (r = 0; r < nz; ++r) {
+    fwd_txfm_row(txfm_type_row, rows + r * txfm_size, output + r * txfm_size,
+                 cos_bit_row, stage_range_row);
+    for (c = nz; c < txfm_size; ++c) output[r * txfm_size + c] = 0;
   }
+  memset(output + nz * txfm_size, 0,
+         (txfm_size - nz) * txfm_size * sizeof(*output));
+}
+
+void fwd_txfm2d_c(const int16_t *input, int32_t *output, const int stride,
+                  const TXFM_2D_FLIP_CFG *cfg, int32_t *buf) {
+  fwd_txfm2d(input, output, stride, cfg->cfg, cfg->ud_flip, cfg->lr_flip, buf);
+}
+
+typedef void (*FwdTxfm2dFunc)(const int16_t *input, int32_t *output,
+                              int stride, int ud_flip, int lr_flip);
+
+// One instance of fwd_txfm2d() for each config of av1_fwd_txfm2d_cfg.h.
+#define FWD_TXFM2D(name, n)                                                    \
+  static void fwd_txfm2d_##name##_##n(const int16_t *input, int32_t *output,   \
+                                      int stride, int ud_flip, int lr_flip) {  \
+    int32_t txfm_buf[2 * n * n];                                               \
+    fwd_txfm2d(input, output, stride, &fwd_txfm_2d_cfg_##name##_##n, ud_flip,  \
+               lr_flip, txfm_buf);                                             \
+  }
+
+#define FWD_TXFM2D_SIZES(name) \
+  FWD_TXFM2D(name, 4)          \
+  FWD_TXFM2D(name, 8)          \
+  FWD_TXFM2D(name, 16)         \
+  FWD_TXFM2D(name, 32)
+
+FWD_TXFM2D_SIZES(dct_dct)
+FWD_TXFM2D_SIZES(adst_dct)
+FWD_TXFM2D_SIZES(dct_adst)
+FWD_TXFM2D_SIZES(adst_adst)
+#if CONFIG_TX64X64
+FWD_TXFM2D(dct_dct, 64)
+#endif  // CONFIG_TX64X64
+
+#define FWD_TXFM2D_LS(name)                                                    \
+  {                                                                            \
+    fwd_txfm2d_##name##_4, fwd_txfm2d_##name##_8, fwd_txfm2d_##name##_16,      \
+        fwd_txfm2d_##name##_32                                                 \
+  }
+
+// Indexed like fwd_txfm_cfg_ls, the flips are set by set_flip_cfg().
+#if CONFIG_EXT_TX
+static const FwdTxfm2dFunc fwd_txfm2d_ls[FLIPADST_ADST + 1][TX_SIZES] = {
+  FWD_TXFM2D_LS(dct_dct),   FWD_TXFM2D_LS(adst_dct),  FWD_TXFM2D_LS(dct_adst),
+  FWD_TXFM2D_LS(adst_adst), FWD_TXFM2D_LS(adst_dct),  FWD_TXFM2D_LS(dct_adst),
+  FWD_TXFM2D_LS(adst_adst), FWD_TXFM2D_LS(adst_adst), FWD_TXFM2D_LS(adst_adst),
+};
+#else
+static const FwdTxfm2dFunc fwd_txfm2d_ls[TX_TYPES][TX_SIZES] = {
+  FWD_TXFM2D_LS(dct_dct), FWD_TXFM2D_LS(adst_dct), FWD_TXFM2D_LS(dct_adst),
+  FWD_TXFM2D_LS(adst_adst),
+};
+#endif
+
+static INLINE void fwd_txfm2d_type(const int16_t *input, int32_t *output,
+                                   int stride, int tx_type, int tx_size) {
+  TXFM_2D_FLIP_CFG cfg;
+  set_flip_cfg(tx_type, &cfg);
+  fwd_txfm2d_ls[tx_type][tx_size](input, output, stride, cfg.ud_flip,
+                                  cfg.lr_flip);
 }
 
 void av1_fwd_txfm2d_4x4_c(const int16_t *input, int32_t *output, int stride,
                           int tx_type, int bd) {
-  int32_t txfm_buf[4 * 4];
-  TXFM_2D_FLIP_CFG cfg = av1_get_fwd_txfm_cfg(tx_type, TX_4X4);
   (void)bd;
-  fwd_txfm2d_c(input, output, stride, &cfg, txfm_buf);
+  fwd_txfm2d_type(input, output, stride, tx_type, TX_4X4);
 }
 
 void av1_fwd_txfm2d_8x8_c(const int16_t *input, int32_t *output, int stride,
                           int tx_type, int bd) {
-  int32_t txfm_buf[8 * 8];
-  TXFM_2D_FLIP_CFG cfg = av1_get_fwd_txfm_cfg(tx_type, TX_8X8);
   (void)bd;
-  fwd_txfm2d_c(input, output, stride, &cfg, txfm_buf);
+  fwd_txfm2d_type(input, output, stride, tx_type, TX_8X8);
 }
 
 void av1_fwd_txfm2d_16x16_c(const int16_t *input, int32_t *output, int stride,
                             int tx_type, int bd) {
-  int32_t txfm_buf[16 * 16];
-  TXFM_2D_FLIP_CFG cfg = av1_get_fwd_txfm_cfg(tx_type, TX_16X16);
   (void)bd;
-  fwd_txfm2d_c(input, output, stride, &cfg, txfm_buf);
+  fwd_txfm2d_type(input, output, stride, tx_type, TX_16X16);
 }
 
 void av1_fwd_txfm2d_32x32_c(const int16_t *input, int32_t *output, int stride,
                             int tx_type, int bd) {
-  int32_t txfm_buf[32 * 32];
-  TXFM_2D_FLIP_CFG cfg = av1_get_fwd_txfm_cfg(tx_type, TX_32X32);
   (void)bd;
-  fwd_txfm2d_c(input, output, stride, &cfg, txfm_buf);
+  fwd_txfm2d_type(input, output, stride, tx_type, TX_32X32);
 }
 
+#if CONFIG_TX64X64
+// DCT_DCT only, like av1_get_fwd_txfm_64x64_cfg().
 void av1_fwd_txfm2d_64x64_c(const int16_t *input, int32_t *output, int stride,
                             int tx_type, int bd) {
-  int32_t txfm_buf[64 * 64];
-  TXFM_2D_FLIP_CFG cfg = av1_get_fwd_txfm_64x64_cfg(tx_type);
   (void)bd;
-  fwd_txfm2d_c(input, output, stride, &cfg, txfm_buf);
+  (void)tx_type;
+  assert(tx_type == DCT_DCT);
+  fwd_txfm2d_dct_dct_64(input, output, stride, 0, 0);
 }
+#endif  // CONFIG_TX64X64
 
 #if CONFIG_EXT_TX
 static const TXFM_2D_CFG *fwd_txfm_cfg_ls[FLIPADST_ADST + 1][TX_SIZES] = {
@@ -9,23 +9,115 @@
  * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
  */
 
+#include <string.h>
+
 #include "./av1_rtcd.h"
+#include "aom_ports/bitops.h"
 #include "av1/common/enums.h"
 #include "av1/common/av1_txfm.h"
 #include "av1/common/av1_inv_txfm1d.h"
+#include "av1/common/av1_inv_txfm1d_kernels.h"
 #include "av1/common/av1_inv_txfm2d_cfg.h"
 
-static INLINE TxfmFunc inv_txfm_type_to_func(TXFM_TYPE txfm_type) {
+/* The 1-D transforms of the passes with the shifts of the 2-D configs folded
+ * in: shift[0] in the rows, shift[1] in the columns. The shifts only depend
+ * on the size. */
+#define INV_TXFM2D_PASSES(name, n)                                             \
+  static AOM_FORCE_INLINE void name##_row(                                     \
+      const int32_t *input, int32_t *output, const int8_t *cos_bit,            \
+      const int8_t *stage_range) {                                             \
+    av1_##name##_kernel(input, output, cos_bit, stage_range,                   \
+                        -inv_shift_dct_dct_##n[0]);                            \
+  }                                                                            \
+  static AOM_FORCE_INLINE void name##_col(                                     \
+      const int32_t *input, int32_t *output, const int8_t *cos_bit,            \
+      const int8_t *stage_range) {                                             \
+    av1_##name##_kernel(input, output, cos_bit, stage_range,                   \
+                        -inv_shift_dct_dct_##n[1]);                            \
+  }
+
+INV_TXFM2D_PASSES(idct4, 4)
+INV_TXFM2D_PASSES(idct8, 8)
+INV_TXFM2D_PASSES(idct16, 16)
+INV_TXFM2D_PASSES(idct32, 32)
+INV_TXFM2D_PASSES(iadst4, 4)
+INV_TXFM2D_PASSES(iadst8, 8)
+INV_TXFM2D_PASSES(iadst16, 16)
+INV_TXFM2D_PASSES(iadst32, 32)
+#if CONFIG_TX64X64
+INV_TXFM2D_PASSES(idct64, 64)
+#endif  // CONFIG_TX64X64
+
+/* The 1-D transforms of the passes, called directly (not through a TxfmFunc)
+ * so that they are inlined: with a constant config the switches fold into
+ * one transform, specialized for its constant inputs. */
+static AOM_FORCE_INLINE void inv_txfm_row(TXFM_TYPE txfm_type,
+                                          const int32_t *input,
+                                          int32_t *output,
+                                          const int8_t *cos_bit,
+                                          const int8_t *stage_range) {
   switch (txfm_type) {
-    case TXFM_TYPE_DCT4: return av1_idct4_new;
-    case TXFM_TYPE_DCT8: return av1_idct8_new;
-    case TXFM_TYPE_DCT16: return av1_idct16_new;
-    case TXFM_TYPE_DCT32: return av1_idct32_new;
-    case TXFM_TYPE_ADST4: return av1_iadst4_new;
-    case TXFM_TYPE_ADST8: return av1_iadst8_new;
-    case TXFM_TYPE_ADST16: return av1_iadst16_new;
-    case TXFM_TYPE_ADST32: return av1_iadst32_new;
-    default: assert(0); return NULL;
+    case TXFM_TYPE_DCT4: idct4_row(input, output, cos_bit, stage_range); break;
+    case TXFM_TYPE_DCT8: idct8_row(input, output, cos_bit, stage_range); break;
+    case TXFM_TYPE_DCT16:
+      idct16_row(input, output, cos_bit, stage_range);
+      break;
+    case TXFM_TYPE_DCT32:
+      idct32_row(input, output, cos_bit, stage_range);
+      break;
+#if CONFIG_TX64X64
+    case TXFM_TYPE_DCT64:
+      idct64_row(input, output, cos_bit, stage_range);
+      break;
+#endif  // CONFIG_TX64X64
+    case TXFM_TYPE_ADST4:
+      iadst4_row(input, output, cos_bit, stage_range);
+      break;
+    case TXFM_TYPE_ADST8:
+      iadst8_row(input, output, cos_bit, stage_range);
+      break;
+    case TXFM_TYPE_ADST16:
+      iadst16_row(input, output, cos_bit, stage_range);
+      break;
+    case TXFM_TYPE_ADST32:
+      iadst32_row(input, output, cos_bit, stage_range);
+      break;
+    default: assert(0);
+  }
+}
+
+static AOM_FORCE_INLINE void inv_txfm_col(TXFM_TYPE txfm_type,
+                                          const int32_t *input,
+                                          int32_t *output,
+                                          const int8_t *cos_bit,
+                                          const int8_t *stage_range) {
+  switch (txfm_type) {
+    case TXFM_TYPE_DCT4: idct4_col(input, output, cos_bit, stage_range); break;
+    case TXFM_TYPE_DCT8: idct8_col(input, output, cos_bit, stage_range); break;
+    case TXFM_TYPE_DCT16:
+      idct16_col(input, output, cos_bit, stage_range);
+      break;
+    case TXFM_TYPE_DCT32:
+      idct32_col(input, output, cos_bit, stage_range);
+      break;
+#if CONFIG_TX64X64
+    case TXFM_TYPE_DCT64:
+      idct64_col(input, output, cos_bit, stage_range);
+      break;
+#endif  // CONFIG_TX64X64
+    case TXFM_TYPE_ADST4:
+      iadst4_col(input, output, cos_bit, stage_range);
+      break;
+    case TXFM_TYPE_ADST8:
+      iadst8_col(input, output, cos_bit, stage_range);
+      break;
+    case TXFM_TYPE_ADST16:
+      iadst16_col(input, output, cos_bit, stage_range);
+      break;
+    case TXFM_TYPE_ADST32:
+      iadst32_col(input, output, cos_bit, stage_range);
+      break;
+    default: assert(0);
   }
 }
 
@@ -82,111 +174,305 @@ TXFM_2D_FLIP_CFG av1_get_inv_txfm_64x64_cfg(int tx_type) {
   return cfg;
 }
 
-static INLINE void inv_txfm2d_add_c(const int32_t *input, int16_t *output,
-                                    int stride, TXFM_2D_FLIP_CFG *cfg,
-                                    int32_t *txfm_buf) {
-  const int txfm_size = cfg->cfg->txfm_size;
-  const int8_t *shift = cfg->cfg->shift;
-  const int8_t *stage_range_col = cfg->cfg->stage_range_col;
-  const int8_t *stage_range_row = cfg->cfg->stage_range_row;
-  const int8_t *cos_bit_col = cfg->cfg->cos_bit_col;
-  const int8_t *cos_bit_row = cfg->cfg->cos_bit_row;
-  const TxfmFunc txfm_func_col = inv_txfm_type_to_func(cfg->cfg->txfm_type_col);
-  const TxfmFunc txfm_func_row = inv_txfm_type_to_func(cfg->cfg->txfm_type_row);
-
-  // txfm_buf's length is  txfm_size * txfm_size + 2 * txfm_size
-  // it is used for intermediate data buffering
-  int32_t *temp_in = txfm_buf;
-  int32_t *temp_out = temp_in + txfm_size;
-  int32_t *buf = temp_out + txfm_size;
-  int32_t *buf_ptr = buf;
-  int c, r;
+/* The 2-D inverse transform of a config. With a constant config (the
+ * instances of INV_TXFM2D below), the switches of inv_txfm_row() and
+ * inv_txfm_col() fold, so the 1-D transforms are inlined with constant sizes,
+ * shifts and cos_bit.
+ *
+ * The nonzero coefficients are in the upper-left nz x nz of the input, and
+ * in its first nz_rows rows. The rows below nz_rows are skipped. When nz is
+ * smaller than txfm_size, the 1-D transforms of both passes read nz inputs
+ * followed by zeros from a local buffer, so with a constant nz the compiler
+ * drops the butterflies of the zero inputs. */
+static AOM_FORCE_INLINE void inv_txfm2d_add(const int32_t *input,
+                                            int16_t *output, int stride,
+                                            const TXFM_2D_CFG *cfg,
+                                            const int ud_flip,
+                                            const int lr_flip, const int nz,
+                                            const int nz_rows,
+                                            int32_t *txfm_buf) {
+  const int txfm_size = cfg->txfm_size;
+  const int8_t *stage_range_col = cfg->stage_range_col;
+  const int8_t *stage_range_row = cfg->stage_range_row;
+  const int8_t *cos_bit_col = cfg->cos_bit_col;
+  const int8_t *cos_bit_row = cfg->cos_bit_row;
+  const TXFM_TYPE txfm_type_col = cfg->txfm_type_col;
+  const TXFM_TYPE txfm_type_row = cfg->txfm_type_row;
+
+  // txfm_buf holds 2 * txfm_size * txfm_size coefficients. The rows are
+  // transposed, so that both passes work on contiguous rows.
+  int32_t *buf = txfm_buf;
+  int32_t *cols = txfm_buf + txfm_size * txfm_size;
+  int32_t in[MAX_TX_SIZE];
+  int c, r, i;
 
   // Rows
-  for (r = 0; r < txfm_size; ++r) {
-    txfm_func_row(input, buf_ptr, cos_bit_row, stage_range_row);
-    round_shift_array(buf_ptr, txfm_size, -shift[0]);
-    input += txfm_size;
-    buf_ptr += txfm_size;
+#if CONFIG_COEFFICIENT_RANGE_STATS
+  av1_txfm_range_stats_begin(TXFM_RANGE_INV_ROW, txfm_type_row);
+#endif
+  for (r = 0; r < nz_rows; ++r) {
+    if (nz == txfm_size) {
+      inv_txfm_row(txfm_type_row, input + r * txfm_size, buf + r * txfm_size,
+                   cos_bit_row, stage_range_row);
+    } else {
+      for (i = 0; i < nz; ++i) in[i] = input[r * txfm_size + i];
+      for (; i < txfm_size; ++i) in[i] = 0;
+      inv_txfm_row(txfm_type_row, in, buf + r * txfm_size, cos_bit_row,
+                   stage_range_row);
+    }
   }
 
-  // Columns
-  for (c = 0; c < txfm_size; ++c) {
-    if (cfg->lr_flip == 0) {
-      for (r = 0; r < txfm_size; ++r) temp_in[r] = buf[r * txfm_size + c];
-    } else {
-      // flip left right
-      for (r = 0; r < txfm_size; ++r)
-        temp_in[r] = buf[r * txfm_size + (txfm_size - c - 1)];
+#if CONFIG_COEFFICIENT_RANGE_STATS
+  av1_txfm_range_stats_begin(TXFM_RANGE_INV_COL, txfm_type_col);
+#endif
+  if (nz_rows == txfm_size) {
+    // The flips are folded into the transposes: flipping left to right reads
+    // the columns from the last row and flipping upside down adds the rows
+    // from the bottom up (negative stride), so the loops do not branch.
+    const int32_t *col_in =
+        lr_flip ? cols + (txfm_size - 1) * txfm_size : cols;
+    const int col_step = lr_flip ? -txfm_size : txfm_size;
+
+    av1_transpose_int32(buf, cols, txfm_size, txfm_size);
+
+    // Columns
+    for (c = 0; c < txfm_size; ++c) {
+      inv_txfm_col(txfm_type_col, col_in, buf + c * txfm_size, cos_bit_col,
+                   stage_range_col);
+      col_in += col_step;
     }
-    txfm_func_col(temp_in, temp_out, cos_bit_col, stage_range_col);
-    round_shift_array(temp_out, txfm_size, -shift[1]);
-    if (cfg->ud_flip == 0) {
-      for (r = 0; r < txfm_size; ++r) output[r * stride + c] += temp_out[r];
-    } else {
-      // flip upside down
-      for (r = 0; r < txfm_size; ++r)
-        output[r * stride + c] += temp_out[txfm_size - r - 1];
+  } else {
+    // The skipped rows are zero, so each column only has nz_rows inputs.
+    // Only the rows that hold them are transposed, rounded up to a multiple
+    // of 4 with zero rows, and the columns read their inputs contiguously.
+    const int nz_rows4 = (nz_rows + 3) & ~3;
+    const int32_t *col_in =
+        lr_flip ? cols + (txfm_size - 1) * txfm_size : cols;
+    const int col_step = lr_flip ? -txfm_size : txfm_size;
+
+    memset(buf + nz_rows * txfm_size, 0,
+           (nz_rows4 - nz_rows) * txfm_size * sizeof(*buf));
+    av1_transpose_int32(buf, cols, txfm_size, nz_rows4);
+
+    // Columns
+    for (c = 0; c < txfm_size; ++c) {
+      for (i = 0; i < nz; ++i) in[i] = i < nz_rows ? col_in[i] : 0;
+      for (; i < txfm_size; ++i) in[i] = 0;
+      inv_txfm_col(txfm_type_col, in, buf + c * txfm_size, cos_bit_col,
+                   stage_range_col);
+      col_in += col_step;
     }
   }
+
+  av1_transpose_add_int32_to_int16(
+      buf, ud_flip ? output + (txfm_size - 1) * stride : output,
+      ud_flip ? -stride : stride, txfm_size);
+}
+
+typedef void (*InvTxfm2dFunc)(const int32_t *input, int16_t *output,
+                              int stride, int ud_flip, int lr_flip,
+                              int nz_rows);
+
+// The instances of inv_txfm2d_add() for each config of av1_inv_txfm2d_cfg.h:
+// instance k has its nonzero coefficients in the upper-left
+// (n >> k) x (n >> k) of the input.
+#define INV_TXFM2D(name, n, k)                                                 \
+  static void inv_txfm2d_add_##name##_##n##_##k(                               \
+      const int32_t *input, int16_t *output, int stride, int ud_flip,          \
+      int lr_flip, int nz_rows) {                                              \
+    int32_t txfm_buf[2 * n * n];                                               \
+    inv_txfm2d_add(input, output, stride, &inv_txfm_2d_cfg_##name##_##n,       \
+                   ud_flip, lr_flip, n >> k, nz_rows, txfm_buf);               \
+  }
+
+#define INV_TXFM2D_SPARSE(name, n) \
+  INV_TXFM2D(name, n, 0)           \
+  INV_TXFM2D(name, n, 1)           \
+  INV_TXFM2D(name, n, 2)
+
+#define INV_TXFM2D_SIZES(name) \
+  INV_TXFM2D_SPARSE(name, 4)   \
+  INV_TXFM2D_SPARSE(name, 8)   \
+  INV_TXFM2D_SPARSE(name, 16)  \
+  INV_TXFM2D_SPARSE(name, 32)
+
+INV_TXFM2D_SIZES(dct_dct)
+INV_TXFM2D_SIZES(adst_dct)
+INV_TXFM2D_SIZES(dct_adst)
+INV_TXFM2D_SIZES(adst_adst)
+#if CONFIG_TX64X64
+// Only the upper-left 32x32 coefficients of a 64x64 are nonzero.
+INV_TXFM2D(dct_dct, 64, 1)
+#endif  // CONFIG_TX64X64
+
+#define INV_TXFM2D_LS_SIZE(name, n)                                            \
+  {                                                                            \
+    inv_txfm2d_add_##name##_##n##_0, inv_txfm2d_add_##name##_##n##_1,          \
+        inv_txfm2d_add_##name##_##n##_2                                        \
+  }
+
+#define INV_TXFM2D_LS(name)                                                    \
+  {                                                                            \
+    INV_TXFM2D_LS_SIZE(name, 4), INV_TXFM2D_LS_SIZE(name, 8),                  \
+        INV_TXFM2D_LS_SIZE(name, 16), INV_TXFM2D_LS_SIZE(name, 32)             \
+  }
+
+#define INV_TXFM2D_SPARSITY 3
+
+// Indexed like inv_txfm_cfg_ls, the flips are set by set_flip_cfg().
+#if CONFIG_EXT_TX
+static const InvTxfm2dFunc
+    inv_txfm2d_ls[FLIPADST_ADST + 1][TX_SIZES][INV_TXFM2D_SPARSITY] = {
+      INV_TXFM2D_LS(dct_dct),   INV_TXFM2D_LS(adst_dct),
+      INV_TXFM2D_LS(dct_adst),  INV_TXFM2D_LS(adst_adst),
+      INV_TXFM2D_LS(adst_dct),  INV_TXFM2D_LS(dct_adst),
+      INV_TXFM2D_LS(adst_adst), INV_TXFM2D_LS(adst_adst),
+      INV_TXFM2D_LS(adst_adst),
+    };
+#else
+static const InvTxfm2dFunc
+    inv_txfm2d_ls[TX_TYPES][TX_SIZES][INV_TXFM2D_SPARSITY] = {
+      INV_TXFM2D_LS(dct_dct), INV_TXFM2D_LS(adst_dct),
+      INV_TXFM2D_LS(dct_adst), INV_TXFM2D_LS(adst_adst),
+    };
+#endif
+
+/* nz_rows and nz_cols bound the nonzero coefficients: they are in the upper-
+ * left nz_rows x nz_cols of the input. */
+static INLINE void inv_txfm2d_add_type(const int32_t *input, int16_t *output,
+                                       int stride, int tx_type, int tx_size,
+                                       int nz_rows, int nz_cols) {
+  const int txfm_size = 4 << tx_size;
+  const int nz = AOMMAX(nz_rows, nz_cols);
+  int k = 0;
+  TXFM_2D_FLIP_CFG cfg;
+  while (k < INV_TXFM2D_SPARSITY - 1 && nz <= txfm_size >> (k + 1)) k++;
+  set_flip_cfg(tx_type, &cfg);
+  inv_txfm2d_ls[tx_type][tx_size][k](input, output, stride, cfg.ud_flip,
+                                     cfg.lr_flip, nz_rows);
+}
+
+/* The bounds of the nonzero coefficients of a block of txfm_size x
+ * txfm_size coefficients, from its eob. The coefficients are in the order of
+ * scan, or in raster order when scan is NULL. */
+static INLINE void get_nz_bounds(const int16_t *scan, int eob, int txfm_size,
+                                 int *nz_rows, int *nz_cols) {
+  const int log2 = get_msb(txfm_size);
+  int rows = 0;
+  int cols = 0;
+  int i;
+  if (scan == NULL) {
+    rows = (eob + txfm_size - 1) >> log2;
+    cols = eob > txfm_size ? txfm_size : eob;
+  } else {
+    for (i = 0; i < eob; ++i) {
+      const int r = scan[i] >> log2;
+      const int c = scan[i] & (txfm_size - 1);
+      if (r >= rows) rows = r + 1;
+      if (c >= cols) cols = c + 1;
+    }
+  }
+  *nz_rows = AOMMAX(rows, 1);
+  *nz_cols = AOMMAX(cols, 1);
 }
 
 void av1_inv_txfm2d_add_4x4_c(const int32_t *input, uint16_t *output,
                               int stride, int tx_type, int bd) {
-  int txfm_buf[4 * 4 + 4 + 4];
   // output contains the prediction signal which is always positive and smaller
   // than (1 << bd) - 1
   // since bd < 16-1, therefore we can treat the uint16_t* output buffer as an
   // int16_t*
-  TXFM_2D_FLIP_CFG cfg = av1_get_inv_txfm_cfg(tx_type, TX_4X4);
-  inv_txfm2d_add_c(input, (int16_t *)output, stride, &cfg, txfm_buf);
+  inv_txfm2d_add_type(input, (int16_t *)output, stride, tx_type, TX_4X4, 4,
+                      4);
   clamp_block((int16_t *)output, 4, stride, 0, (1 << bd) - 1);
 }
 
 void av1_inv_txfm2d_add_8x8_c(const int32_t *input, uint16_t *output,
                               int stride, int tx_type, int bd) {
-  int txfm_buf[8 * 8 + 8 + 8];
   // output contains the prediction signal which is always positive and smaller
   // than (1 << bd) - 1
   // since bd < 16-1, therefore we can treat the uint16_t* output buffer as an
   // int16_t*
-  TXFM_2D_FLIP_CFG cfg = av1_get_inv_txfm_cfg(tx_type, TX_8X8);
-  inv_txfm2d_add_c(input, (int16_t *)output, stride, &cfg, txfm_buf);
+  inv_txfm2d_add_type(input, (int16_t *)output, stride, tx_type, TX_8X8, 8,
+                      8);
   clamp_block((int16_t *)output, 8, stride, 0, (1 << bd) - 1);
 }
 
 void av1_inv_txfm2d_add_16x16_c(const int32_t *input, uint16_t *output,
                                 int stride, int tx_type, int bd) {
-  int txfm_buf[16 * 16 + 16 + 16];
   // output contains the prediction signal which is always positive and smaller
   // than (1 << bd) - 1
   // since bd < 16-1, therefore we can treat the uint16_t* output buffer as an
   // int16_t*
-  TXFM_2D_FLIP_CFG cfg = av1_get_inv_txfm_cfg(tx_type, TX_16X16);
-  inv_txfm2d_add_c(input, (int16_t *)output, stride, &cfg, txfm_buf);
+  inv_txfm2d_add_type(input, (int16_t *)output, stride, tx_type, TX_16X16, 16,
+                      16);
   clamp_block((int16_t *)output, 16, stride, 0, (1 << bd) - 1);
 }
 
 void av1_inv_txfm2d_add_32x32_c(const int32_t *input, uint16_t *output,
                                 int stride, int tx_type, int bd) {
-  int txfm_buf[32 * 32 + 32 + 32];
   // output contains the prediction signal which is always positive and smaller
   // than (1 << bd) - 1
   // since bd < 16-1, therefore we can treat the uint16_t* output buffer as an
   // int16_t*
-  TXFM_2D_FLIP_CFG cfg = av1_get_inv_txfm_cfg(tx_type, TX_32X32);
-  inv_txfm2d_add_c(input, (int16_t *)output, stride, &cfg, txfm_buf);
+  inv_txfm2d_add_type(input, (int16_t *)output, stride, tx_type, TX_32X32, 32,
+                      32);
   clamp_block((int16_t *)output, 32, stride, 0, (1 << bd) - 1);
 }
 
+/* The sparse versions of the above: the coefficients are in the order of scan
+ * (or in raster order when scan is NULL) and the ones from eob on are zero.
+ * The rows of zero coefficients are skipped and the 1-D transforms only read
+ * the upper-left nonzero coefficients. */
+static INLINE void inv_txfm2d_add_eob(const int32_t *input, uint16_t *output,
+                                      int stride, int tx_type, int tx_size,
+                                      int bd, int eob, const int16_t *scan) {
+  const int txfm_size = 4 << tx_size;
+  int nz_rows, nz_cols;
+  get_nz_bounds(scan, eob, txfm_size, &nz_rows, &nz_cols);
+  inv_txfm2d_add_type(input, (int16_t *)output, stride, tx_type, tx_size,
+                      nz_rows, nz_cols);
+  clamp_block((int16_t *)output, txfm_size, stride, 0, (1 << bd) - 1);
+}
+
+void av1_inv_txfm2d_add_4x4_eob_c(const int32_t *input, uint16_t *output,
+                                  int stride, int tx_type, int bd, int eob,
+                                  const int16_t *scan) {
+  inv_txfm2d_add_eob(input, output, stride, tx_type, TX_4X4, bd, eob, scan);
+}
+
+void av1_inv_txfm2d_add_8x8_eob_c(const int32_t *input, uint16_t *output,
+                                  int stride, int tx_type, int bd, int eob,
+                                  const int16_t *scan) {
+  inv_txfm2d_add_eob(input, output, stride, tx_type, TX_8X8, bd, eob, scan);
+}
+
+void av1_inv_txfm2d_add_16x16_eob_c(const int32_t *input, uint16_t *output,
+                                    int stride, int tx_type, int bd, int eob,
+                                    const int16_t *scan) {
+  inv_txfm2d_add_eob(input, output, stride, tx_type, TX_16X16, bd, eob, scan);
+}
+
+void av1_inv_txfm2d_add_32x32_eob_c(const int32_t *input, uint16_t *output,
+                                    int stride, int tx_type, int bd, int eob,
+                                    const int16_t *scan) {
+  inv_txfm2d_add_eob(input, output, stride, tx_type, TX_32X32, bd, eob, scan);
+}
+
+#if CONFIG_TX64X64
+// DCT_DCT only, like av1_get_inv_txfm_64x64_cfg(). The coefficients outside
+// of the upper-left 32x32 are ignored (they are zeroed out by the forward
+// transform), so the rows below 32 are skipped and the 1-D transforms only
+// read 32 inputs.
 void av1_inv_txfm2d_add_64x64_c(const int32_t *input, uint16_t *output,
                                 int stride, int tx_type, int bd) {
-  int txfm_buf[64 * 64 + 64 + 64];
   // output contains the prediction signal which is always positive and smaller
   // than (1 << bd) - 1
   // since bd < 16-1, therefore we can treat the uint16_t* output buffer as an
   // int16_t*
-  TXFM_2D_FLIP_CFG cfg = av1_get_inv_txfm_64x64_cfg(tx_type);
-  inv_txfm2d_add_c(input, (int16_t *)output, stride, &cfg, txfm_buf);
+  (void)tx_type;
+  assert(tx_type == DCT_DCT);
+  inv_txfm2d_add_dct_dct_64_1(input, (int16_t *)output, stride, 0, 0, 32);
   clamp_block((int16_t *)output, 64, stride, 0, (1 << bd) - 1);
 }
+#endif  // CONFIG_TX64X64
@@ -140,7 +140,7 @@ if (aom_config("CONFIG_AOM_HIGHBITDEPTH") eq "yes") {
       specialize qw/av1_iht16x16_256_add sse2 avx2/;
 
     add_proto qw/void av1_iht32x32_1024_add/, "const tran_low_t *input, uint8_t *output, int pitch, int tx_type";
-      specialize qw/av1_iht32x32_1024_add/;
+      specialize qw/av1_iht32x32_1024_add sse2/;
   }
 } else {
   # Force C versions if CONFIG_EMULATE_HARDWARE is 1
@@ -228,7 +228,7 @@ if (aom_config("CONFIG_AOM_HIGHBITDEPTH") eq "yes") {
       specialize qw/av1_iht16x16_256_add sse2 avx2 dspr2/;
 
     add_proto qw/void av1_iht32x32_1024_add/, "const tran_low_t *input, uint8_t *output, int pitch, int tx_type";
-      specialize qw/av1_iht32x32_1024_add/;
+      specialize qw/av1_iht32x32_1024_add sse2/;
 
     if (aom_config("CONFIG_EXT_TX") ne "yes") {
       specialize qw/av1_iht4x4_16_add msa/;
@@ -246,6 +246,13 @@ if (aom_config("CONFIG_TX64X64") eq "yes") {
   specialize qw/av1_iht64x64_4096_add/;
 }
 
+if (aom_config("CONFIG_EXT_TX") eq "yes") {
+  add_proto qw/void av1_inv_idtx_add/, "const tran_low_t *input, uint8_t *dest, int stride, int bs, int tx_type";
+  if (aom_config("CONFIG_EMULATE_HARDWARE") ne "yes") {
+    specialize qw/av1_inv_idtx_add sse2 avx2/;
+  }
+}
+
 if (aom_config("CONFIG_NEW_QUANT") eq "yes") {
   add_proto qw/void quantize_nuq/, "const tran_low_t *coeff_ptr, intptr_t n_coeffs, int skip_block, const int16_t *quant_ptr, const int16_t *quant_shift_ptr, const int16_t *dequant_ptr, const cuml_bins_type_nuq *cuml_bins_ptr, const dequant_val_type_nuq *dequant_val, tran_low_t *qcoeff_ptr, tran_low_t *dqcoeff_ptr, uint16_t *eob_ptr, const int16_t *scan, const uint8_t *band";
   specialize qw/quantize_nuq/;
@@ -568,6 +575,14 @@ if (aom_config("CONFIG_AOM_HIGHBITDEPTH") eq "yes") {
   specialize qw/av1_inv_txfm2d_add_32x32/;
   add_proto qw/void av1_inv_txfm2d_add_64x64/, "const int32_t *input, uint16_t *output, int stride, int tx_type, int bd";
   specialize qw/av1_inv_txfm2d_add_64x64/;
+  add_proto qw/void av1_inv_txfm2d_add_4x4_eob/, "const int32_t *input, uint16_t *output, int stride, int tx_type, int bd, int eob, const int16_t *scan";
+  specialize qw/av1_inv_txfm2d_add_4x4_eob/;
+  add_proto qw/void av1_inv_txfm2d_add_8x8_eob/, "const int32_t *input, uint16_t *output, int stride, int tx_type, int bd, int eob, const int16_t *scan";
+  specialize qw/av1_inv_txfm2d_add_8x8_eob/;
+  add_proto qw/void av1_inv_txfm2d_add_16x16_eob/, "const int32_t *input, uint16_t *output, int stride, int tx_type, int bd, int eob, const int16_t *scan";
+  specialize qw/av1_inv_txfm2d_add_16x16_eob/;
+  add_proto qw/void av1_inv_txfm2d_add_32x32_eob/, "const int32_t *input, uint16_t *output, int stride, int tx_type, int bd, int eob, const int16_t *scan";
+  specialize qw/av1_inv_txfm2d_add_32x32_eob/;
 }
 
 #
@@ -765,4 +780,21 @@ if (aom_config("CONFIG_DERING") eq "yes") {
   specialize qw/od_filter_dering_orthogonal_8x8 sse4_1/;
 }
 
+# CfL TF merge (32 bit intermediates for all bit depths)
+add_proto qw/void od_tf_up_hv/, "int32_t *dst, int dstride, const int32_t *src, int sstride, int n";
+specialize qw/od_tf_up_hv sse2/;
+
+add_proto qw/void od_tf_up_hv_lp/, "int32_t *dst, int dstride, const int32_t *src, int sstride, int dx, int dy, int n";
+specialize qw/od_tf_up_hv_lp sse2/;
+
+# Transposes between the passes of the 2-D transforms
+add_proto qw/void av1_transpose_int16_to_int32/, "const int16_t *input, int stride, int32_t *output, int n";
+specialize qw/av1_transpose_int16_to_int32 sse2/;
+
+add_proto qw/void av1_transpose_int32/, "const int32_t *input, int32_t *output, int n, int rows";
+specialize qw/av1_transpose_int32 sse2/;
+
+add_proto qw/void av1_transpose_add_int32_to_int16/, "const int32_t *input, int16_t *output, int stride, int n";
+specialize qw/av1_transpose_add_int32_to_int16 sse2/;
+
 1;
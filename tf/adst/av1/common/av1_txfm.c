@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2016, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include "./av1_rtcd.h"
+#include "av1/common/av1_txfm.h"
+
+#if CONFIG_COEFFICIENT_RANGE_STATS
+#include <inttypes.h>
+#include <string.h>
+#endif
+
+// The transposes between the passes of the 2-D transforms, so that the 1-D
+// transforms of both passes read and write contiguous rows.
+
+void av1_transpose_int16_to_int32_c(const int16_t *input, int stride,
+                                    int32_t *output, int n) {
+  int r, c;
+  for (r = 0; r < n; ++r) {
+    for (c = 0; c < n; ++c) output[c * n + r] = input[r * stride + c];
+  }
+}
+
+// Only the first rows rows of the n x n input are transposed, into the first
+// rows columns of the output.
+void av1_transpose_int32_c(const int32_t *input, int32_t *output, int n,
+                           int rows) {
+  int r, c;
+  for (r = 0; r < rows; ++r) {
+    for (c = 0; c < n; ++c) output[c * n + r] = input[r * n + c];
+  }
+}
+
+void av1_transpose_add_int32_to_int16_c(const int32_t *input, int16_t *output,
+                                        int stride, int n) {
+  int r, c;
+  for (r = 0; r < n; ++r) {
+    for (c = 0; c < n; ++c) output[r * stride + c] += input[c * n + r];
+  }
+}
+
+#if CONFIG_COEFFICIENT_RANGE_STATS
+static const char *const txfm_range_pass_names[TXFM_RANGE_PASSES] = {
+  "fwd col", "fwd row", "inv row", "inv col"
+};
+
+static const char *const txfm_range_type_names[TXFM_TYPE_ADST32 + 1] = {
+  "dct4", "dct8", "dct16", "dct32", "dct64",
+  "adst4", "adst8", "adst16", "adst32"
+};
+
+static TXFM_RANGE_STATS txfm_range_stats[TXFM_RANGE_PASSES]
+                                        [TXFM_TYPE_ADST32 + 1];
+
+// The stats of the pass the calling thread is running.
+static __thread TXFM_RANGE_STATS *txfm_range_stats_cur;
+
+void av1_txfm_range_stats_begin(TXFM_RANGE_PASS pass, TXFM_TYPE txfm_type) {
+  txfm_range_stats_cur = &txfm_range_stats[pass][txfm_type];
+}
+
+// The stats are shared by the threads: the maximums are updated with a
+// compare and swap, which rarely loops once the largest values are seen.
+static void txfm_range_stats_max(uint32_t *dst, uint32_t value) {
+  uint32_t cur = __atomic_load_n(dst, __ATOMIC_RELAXED);
+  while (value > cur &&
+         !__atomic_compare_exchange_n(dst, &cur, value, 1, __ATOMIC_RELAXED,
+                                      __ATOMIC_RELAXED)) {
+  }
+}
+
+void av1_txfm_range_stats_update(int stage, const int32_t *buf, int size,
+                                 int bit) {
+  TXFM_RANGE_STATS *const stats = txfm_range_stats_cur;
+  uint32_t max = 0;
+  int i;
+  // 1-D transforms called outside of the 2-D transforms are not recorded.
+  if (stats == NULL) return;
+  assert(stage < MAX_TXFM_STAGE_NUM);
+  for (i = 0; i < size; ++i) {
+    const uint32_t mag = buf[i] < 0 ? -(uint32_t)buf[i] : (uint32_t)buf[i];
+    if (mag > max) max = mag;
+  }
+  txfm_range_stats_max(&stats->max[stage], max);
+  if (stage == 0) __atomic_fetch_add(&stats->count, 1, __ATOMIC_RELAXED);
+  if (stage >= __atomic_load_n(&stats->stage_num, __ATOMIC_RELAXED)) {
+    __atomic_store_n(&stats->stage_num, stage + 1, __ATOMIC_RELAXED);
+  }
+  if (stats->range[stage] == 0 || bit < stats->range[stage]) {
+    __atomic_store_n(&stats->range[stage], bit, __ATOMIC_RELAXED);
+  }
+}
+
+void av1_txfm_range_stats_reset(void) {
+  memset(txfm_range_stats, 0, sizeof(txfm_range_stats));
+}
+
+const TXFM_RANGE_STATS *av1_txfm_range_stats_get(TXFM_RANGE_PASS pass,
+                                                 TXFM_TYPE txfm_type) {
+  return &txfm_range_stats[pass][txfm_type];
+}
+
+void av1_txfm_range_stats_print(FILE *f) {
+  int pass, type, stage;
+  fprintf(f, "pass     txfm    calls       bits per stage (stage_range)\n");
+  for (pass = 0; pass < TXFM_RANGE_PASSES; ++pass) {
+    for (type = 0; type <= TXFM_TYPE_ADST32; ++type) {
+      const TXFM_RANGE_STATS *const stats = &txfm_range_stats[pass][type];
+      int bits_max = 0;
+      if (stats->count == 0) continue;
+      fprintf(f, "%-8s %-7s %-11" PRIu64, txfm_range_pass_names[pass],
+              txfm_range_type_names[type], stats->count);
+      for (stage = 0; stage < stats->stage_num; ++stage) {
+        // The bits of the largest magnitude, plus the sign (like
+        // range_check()).
+        const int bits = get_max_bit(stats->max[stage]) + 2;
+        if (bits > bits_max) bits_max = bits;
+        fprintf(f, " %2d(%2d)", bits, stats->range[stage]);
+      }
+      fprintf(f, " | max %d bits%s\n", bits_max,
+              bits_max <= 16 ? ", fits int16_t" : "");
+    }
+  }
+}
+#endif  // CONFIG_COEFFICIENT_RANGE_STATS
@@ -90,6 +90,16 @@ static INLINE void round_shift_array(int32_t *arr, int size, int bit) {
   }
 }
 
+// The shifts of the 2-D transforms folded in the first (left shift) and the
+// last (rounding right shift) stages of the 1-D transforms.
+static INLINE int32_t txfm_shift_in(int32_t value, int bit) {
+  return value * (1 << bit);
+}
+
+static INLINE int32_t txfm_shift_out(int32_t value, int bit) {
+  return bit ? round_shift(value, bit) : value;
+}
+
 static INLINE int32_t half_btf(int32_t w0, int32_t in0, int32_t w1, int32_t in1,
                                int bit) {
   int32_t result_32 = w0 * in0 + w1 * in1;
@@ -204,6 +214,42 @@ extern "C" {
 #endif
 TXFM_2D_FLIP_CFG av1_get_fwd_txfm_cfg(int tx_type, int tx_size);
 TXFM_2D_FLIP_CFG av1_get_fwd_txfm_64x64_cfg(int tx_type);
+
+#if CONFIG_COEFFICIENT_RANGE_STATS
+// The passes of the 2-D transforms, in the order they are run.
+typedef enum TXFM_RANGE_PASS {
+  TXFM_RANGE_FWD_COL,
+  TXFM_RANGE_FWD_ROW,
+  TXFM_RANGE_INV_ROW,
+  TXFM_RANGE_INV_COL,
+  TXFM_RANGE_PASSES
+} TXFM_RANGE_PASS;
+
+#define MAX_TXFM_STAGE_NUM 12
+
+// The dynamic range reached by a 1-D transform in a pass of the 2-D
+// transforms: the largest magnitude of the outputs of each stage and the
+// smallest stage_range of the configs it ran with.
+typedef struct TXFM_RANGE_STATS {
+  uint64_t count;
+  int stage_num;
+  uint32_t max[MAX_TXFM_STAGE_NUM];
+  int8_t range[MAX_TXFM_STAGE_NUM];
+} TXFM_RANGE_STATS;
+
+// Records the stages of the 1-D transforms run by the calling thread in the
+// stats of pass and txfm_type, until the next call.
+void av1_txfm_range_stats_begin(TXFM_RANGE_PASS pass, TXFM_TYPE txfm_type);
+// Called by range_check() for each stage of the 1-D transforms.
+void av1_txfm_range_stats_update(int stage, const int32_t *buf, int size,
+                                 int bit);
+void av1_txfm_range_stats_reset(void);
+const TXFM_RANGE_STATS *av1_txfm_range_stats_get(TXFM_RANGE_PASS pass,
+                                                 TXFM_TYPE txfm_type);
+// Prints the bit width reached at each stage (sign included) next to the
+// stage_range of the configs, for each pass and 1-D transform that ran.
+void av1_txfm_range_stats_print(FILE *f);
+#endif  // CONFIG_COEFFICIENT_RANGE_STATS
 #ifdef __cplusplus
 }
 #endif  // __cplusplus
@@ -9,123 +9,344 @@
  * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
  */
 
+#include "./av1_rtcd.h"
 #include "av1/common/cfl.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
+#include <string.h>
+
+#if CONFIG_CFL_STATS
+#if ARCH_X86 || ARCH_X86_64
+#include <x86intrin.h>
+static INLINE uint64_t cfl_cycles(void) { return __rdtsc(); }
+#else
+#include <time.h>
+// No cycle counter, use nanoseconds instead.
+static INLINE uint64_t cfl_cycles(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+#endif
+#endif
+
+// Saturate a TF merged coefficient to the range of tran_low_t.
+static INLINE tran_low_t cfl_clip_coeff(int32_t coeff) {
+#if CONFIG_AOM_HIGHBITDEPTH
+  // tran_low_t is 32 bits, it holds the TF output of all bit depths.
+  return coeff;
+#else
+  return (tran_low_t)clamp(coeff, INT16_MIN, INT16_MAX);
+#endif
+}
+
+// log2 of the scale of the AV1 forward 2-D transforms, relative to the
+// orthonormal DCT: the coefficients are 8 times bigger up to 16x16, 4 times
+// for 32x32 and 2 times for 64x64.
+static INLINE int cfl_tx_scale_log2(int tx_size) {
+  return tx_size <= 16 ? 3 : (tx_size == 32 ? 2 : 1);
+}
+
+void cfl_init(CFL_CONTEXT *const cfl, int subsampling_x, int subsampling_y) {
+  cfl->luma_tx_blk_size = 0;
+  cfl->subsampling_x = subsampling_x;
+  cfl->subsampling_y = subsampling_y;
+  cfl->store_count = 0;
+  memset(cfl->pred_cache_keys, 0, sizeof(cfl->pred_cache_keys));
+#if CONFIG_CFL_STATS
+  cfl_stats_reset(&cfl->stats);
+#endif
+}
+
+#if CONFIG_CFL_STATS
+void cfl_stats_reset(CFL_STATS *const stats) {
+  memset(stats, 0, sizeof(*stats));
+}
+
+void cfl_stats_add(CFL_STATS *const dst, const CFL_STATS *const src) {
+  int i;
+  dst->load_part += src->load_part;
+  dst->load_part_cycles += src->load_part_cycles;
+  dst->load_merge += src->load_merge;
+  dst->load_merge_cycles += src->load_merge_cycles;
+  dst->load_cached += src->load_cached;
+  dst->load_cached_cycles += src->load_cached_cycles;
+  for (i = 0; i < CFL_STATS_STORE_PATHS; i++) {
+    dst->store[i] += src->store[i];
+    dst->store_cycles[i] += src->store_cycles[i];
+  }
+}
 
+static void cfl_stats_dump_path(FILE *f, const char *const name,
+    uint64_t count, uint64_t cycles) {
+  fprintf(f, "  %-20s %10llu calls %12llu cycles %8.1f cycles/call\n", name,
+      (unsigned long long)count, (unsigned long long)cycles,
+      count ? (double)cycles / count : 0);
+}
+
+void cfl_stats_dump(FILE *f, const CFL_STATS *const stats,
+    const char *const label) {
+  static const char *const store_names[CFL_STATS_STORE_PATHS] = {
+    "store (AC/DC skip)", "store (DC only)", "store (AC only)",
+    "store (AC and DC)", "store (invalid)"
+  };
+  int i;
+  fprintf(f, "%s CfL stats:\n", label);
+  cfl_stats_dump_path(f, "load (part)", stats->load_part,
+      stats->load_part_cycles);
+  cfl_stats_dump_path(f, "load (TF merge)", stats->load_merge,
+      stats->load_merge_cycles);
+  cfl_stats_dump_path(f, "load (cached)", stats->load_cached,
+      stats->load_cached_cycles);
+  for (i = 0; i < CFL_STATS_STORE_PATHS; i++) {
+    cfl_stats_dump_path(f, store_names[i], stats->store[i],
+        stats->store_cycles[i]);
+  }
+}
+#endif
+
+// Check if the predictor of the chroma block at blk_row, blk_col (in units of
+// 4x4 chroma blocks) is in the cache.
+static int cfl_cache_hit(const CFL_CONTEXT *const cfl, int blk_row,
+    int blk_col, int uv_tx_size) {
+  const CFL_PRED_CACHE_KEY *const key =
+    &cfl->pred_cache_keys[blk_row * CFL_TX_STRIDE + blk_col];
+  return key->store_count == cfl->store_count
+    && key->y_tx_size == cfl->luma_tx_blk_size
+    && key->uv_tx_size == uv_tx_size;
+}
+
+// Add the key of the predictor of the chroma block at blk_row, blk_col to the
+// cache. Predictors overlapping with it are invalidated, as their
+// coefficients are overwritten.
+static void cfl_cache_insert(CFL_CONTEXT *const cfl, int blk_row, int blk_col,
+    int uv_tx_size) {
+  const int n = uv_tx_size >> 2; // Size in units of 4x4 chroma blocks
+  CFL_PRED_CACHE_KEY *key;
+  int size, i, j;
+
+  // Chroma blocks are aligned to their size: two predictors overlap only if
+  // one contains the other.
+  assert((blk_row & (n - 1)) == 0 && (blk_col & (n - 1)) == 0);
+  assert((blk_row + n) <= CFL_TX_STRIDE && (blk_col + n) <= CFL_TX_STRIDE);
+
+  // Predictors inside the block
+  for (j = 0; j < n; j++) {
+    for (i = 0; i < n; i++) {
+      cfl->pred_cache_keys[(blk_row + j) * CFL_TX_STRIDE + blk_col + i]
+        .store_count = 0;
+    }
+  }
+  // Bigger predictors containing the block
+  for (size = n << 1; size <= MAX_TX_SIZE >> 2; size <<= 1) {
+    key = &cfl->pred_cache_keys[(blk_row & ~(size - 1)) * CFL_TX_STRIDE
+      + (blk_col & ~(size - 1))];
+    if (key->uv_tx_size == size << 2) key->store_count = 0;
+  }
+
+  key = &cfl->pred_cache_keys[blk_row * CFL_TX_STRIDE + blk_col];
+  key->store_count = cfl->store_count;
+  key->y_tx_size = cfl->luma_tx_blk_size;
+  key->uv_tx_size = uv_tx_size;
+}
 
 void tf_merge_and_subsample(CFL_CONTEXT *const cfl, tran_low_t *const dst,
     int dstride, const tran_low_t *const src, int sstride, int y_tx_size,
     int uv_tx_size) {
 
-  //Size of the 2x2 group of nxn blocks.
-  const int total_size = uv_tx_size << 1;
+  // Size of the luma region collocated with the chroma block (2x2 group of
+  // nxn blocks in 4:2:0, 2x1 in 4:2:2 and a single nxn block in 4:4:4).
+  const int width = uv_tx_size << cfl->subsampling_x;
+  const int height = uv_tx_size << cfl->subsampling_y;
+
+  // A 64x64 transform only keeps its upper-left 32x32 coefficients, so the
+  // last level of the merge of a 64x64 predictor (4:4:4 only) only computes
+  // that quarter, like the subsampled formats do.
+  const int lp_64 = uv_tx_size == 64 && y_tx_size < 64
+      && !cfl->subsampling_x && !cfl->subsampling_y;
+  const int merge_size = lp_64 ? uv_tx_size >> 1 : uv_tx_size;
+  const int nz = AOMMIN(uv_tx_size, 32);
+
+  // The Haar kernels are orthonormal, the merged coefficients have the scale
+  // of the luma transform.
+  const int tx_scale_shift =
+      cfl_tx_scale_log2(y_tx_size) - cfl_tx_scale_log2(uv_tx_size);
 
   // Double buffer setup
-  tran_high_t *sbuf = cfl->buf1;
-  tran_high_t *dbuf = cfl->buf2;
-  tran_high_t out;
+  int32_t *sbuf = cfl->buf1;
+  int32_t *dbuf = cfl->buf2;
+  int scale_shift;
   int i, j;
 
-  // Copy 16 bit src over to 32 bits
-  assert(total_size <= MAX_SB_SIZE);
-  for (j = 0; j < total_size; j++) {
-    for (i = 0; i < total_size; i++) {
+  // Copy src over to 32 bits
+  assert(width <= MAX_SB_SIZE && height <= MAX_SB_SIZE);
+  for (j = 0; j < height; j++) {
+    for (i = 0; i < width; i++) {
       sbuf[MAX_SB_SIZE * j + i] = src[sstride * j + i];
     }
   }
 
   // TF merge until the prediction is the required size
-  while (y_tx_size < uv_tx_size) {
+  while (y_tx_size < merge_size) {
     int next_y_tx_size = y_tx_size << 1;
-    int row = 0;
 
     // swap buffers
-    tran_high_t *tmp = sbuf;
+    int32_t *tmp = sbuf;
     sbuf = dbuf;
     dbuf = tmp;
 
-    for (j = 0; j < total_size; j += next_y_tx_size) {
-      for (i = 0; i < total_size; i += next_y_tx_size) {
-        od_tf_up_hv(sbuf + row + i, MAX_SB_SIZE, dbuf + row + i,
-            MAX_SB_SIZE, y_tx_size);
+    for (j = 0; j < height; j += next_y_tx_size) {
+      for (i = 0; i < width; i += next_y_tx_size) {
+        const int offset = MAX_SB_SIZE * j + i;
+        od_tf_up_hv(sbuf + offset, MAX_SB_SIZE, dbuf + offset, MAX_SB_SIZE,
+            y_tx_size);
       }
-      row += MAX_SB_SIZE;
     }
     y_tx_size = next_y_tx_size;
   }
-  assert(y_tx_size == uv_tx_size);
-
-  // TF merge last level and keep top left quadrant (this compensates for
-  // chroma subsampling).
-  od_tf_up_hv_lp(dbuf, MAX_SB_SIZE, sbuf, MAX_SB_SIZE, uv_tx_size, uv_tx_size,
+  assert(y_tx_size == merge_size);
+
+  if (cfl->subsampling_x && cfl->subsampling_y) {
+    // TF merge last level and keep top left quadrant (this compensates for
+    // chroma subsampling).
+    od_tf_up_hv_lp(dbuf, MAX_SB_SIZE, sbuf, MAX_SB_SIZE, uv_tx_size,
+        uv_tx_size, uv_tx_size);
+    // FIXME Still not sure why this scaling is required (TF being unit scale)
+    // I also need to figure out, if we need to increase scaling by the number
+    // of TF operations performed.
+    scale_shift = 1;
+  } else if (cfl->subsampling_x) {
+    // Horizontal only TF merge of the two side by side blocks, keep the left
+    // half. Unlike the 2D Haar kernel, the 1D kernel already halves the LF.
+    od_tf_up_h_lp(dbuf, MAX_SB_SIZE, sbuf, MAX_SB_SIZE, uv_tx_size,
+        uv_tx_size);
+    scale_shift = 0;
+  } else if (cfl->subsampling_y) {
+    od_tf_up_v_lp(dbuf, MAX_SB_SIZE, sbuf, MAX_SB_SIZE, uv_tx_size,
         uv_tx_size);
+    scale_shift = 0;
+  } else if (lp_64) {
+    // TF merge last level of the four 32x32 and keep the top left quadrant,
+    // the rest is zero.
+    od_tf_up_hv_lp(dbuf, MAX_SB_SIZE, sbuf, MAX_SB_SIZE, merge_size,
+        merge_size, merge_size);
+    scale_shift = 0;
+  } else {
+    // No subsampling, the merged block is the prediction.
+    dbuf = sbuf;
+    scale_shift = 0;
+  }
+  scale_shift += tx_scale_shift;
 
-  for (j = 0; j < uv_tx_size; j++) {
-    for (i = 0; i < uv_tx_size; i++) {
-      // FIXME Still not sure why this scaling is required (TF being unit scale)
-      // I also need to figure out, if we need to increase scaling by the number
-      // of TF operations performed.
-      out = dbuf[MAX_SB_SIZE * j + i] >>= 1;
+  for (j = 0; j < nz; j++) {
+    for (i = 0; i < nz; i++) {
       // Clip as TF on bigger transforms can overflow
-      dst[dstride * j + i] = (out < INT16_MAX) ? out : INT16_MAX;
+      dst[dstride * j + i] =
+          cfl_clip_coeff(dbuf[MAX_SB_SIZE * j + i] >> scale_shift);
     }
+    for (; i < uv_tx_size; i++) dst[dstride * j + i] = 0;
+  }
+  for (; j < uv_tx_size; j++) {
+    memset(&dst[dstride * j], 0, sizeof(tran_low_t) * uv_tx_size);
   }
 }
 
 void cfl_load_predictor(CFL_CONTEXT *const cfl, int blk_row, int blk_col,
 		tran_low_t *const ref_coeff, int uv_tx_size) {
 
-  const int scale = 4; // Needs to be adjusted to support 4:4:4
+  const int scale = 4; // blk_row and blk_col are in units of 4x4 blocks
   const int y_tx_size = cfl->luma_tx_blk_size;
   const tran_low_t *y_coeff;
   const tran_low_t dc = ref_coeff[0];
+  const int uv_blk_row = blk_row;
+  const int uv_blk_col = blk_col;
   int coeff_offset;
+#if CONFIG_CFL_STATS
+  const uint64_t start = cfl_cycles();
+  uint64_t *count;
+  uint64_t *cycles;
+#endif
 
   // Check that tx_sizes are valid.
   assert(y_tx_size > 0 && y_tx_size <= MAX_TX_SIZE);
   assert(uv_tx_size > 0 && uv_tx_size <= MAX_TX_SIZE);
 
-  // Adjusting row and cols for 4:2:0. It is important to note that the
-  // prediction is always the first AC coeffs (not the collocated coeffs).
-  blk_row = (blk_row * scale * 2) / y_tx_size * y_tx_size;
-  blk_col = (blk_col * scale * 2) / y_tx_size * y_tx_size;
+  // Adjusting row and cols for chroma subsampling. It is important to note
+  // that the prediction is always the first AC coeffs (not the collocated
+  // coeffs).
+  blk_row = ((blk_row * scale) << cfl->subsampling_y) / y_tx_size * y_tx_size;
+  blk_col = ((blk_col * scale) << cfl->subsampling_x) / y_tx_size * y_tx_size;
 
   coeff_offset = blk_row * MAX_SB_SIZE + (blk_col);
 
-  // Check that the last coeff offset is smaller than the max superblock size
-  assert(coeff_offset
-      + ((uv_tx_size-1) * MAX_SB_SIZE + (uv_tx_size-1)) < MAX_SB_SQUARE);
-
   y_coeff = &cfl->luma_coeff[coeff_offset];
 
   if (y_tx_size > uv_tx_size) {
     // When the CfL prediction is bigger than what is needed, we only take the
     // part that is needed.
-    int shift = (y_tx_size / uv_tx_size) >> 1;
+    int shift = 0;
     int i, j, k = 0;
 
-    // 1 and 2 are the only scale changes supported for now.
-    assert(shift == 1 || shift == 2);
+    // Check that the last coeff offset is smaller than the max superblock size
+    assert(coeff_offset
+        + ((uv_tx_size-1) * MAX_SB_SIZE + (uv_tx_size-1)) < MAX_SB_SQUARE);
 
-    // Don't scale the 32x32, it's already scaled.
-    if (uv_tx_size > 16) shift--;
+    // The top left part of a transform N times bigger is N times bigger than
+    // the transform of the N times subsampled block.
+    while ((uv_tx_size << shift) < y_tx_size) shift++;
+    assert(shift >= 1 && shift <= 4);
+
+    // The 32x32 and 64x64 luma transforms are already scaled down.
+    shift -= cfl_tx_scale_log2(uv_tx_size) - cfl_tx_scale_log2(y_tx_size);
+    assert(shift >= 0);
 
     for (j = 0; j < uv_tx_size; j++) {
       for (i = 0; i < uv_tx_size; i++) {
-        // Scale coefficients as the inverse transform is half the size of the
+        // Scale coefficients as the inverse transform is smaller than the
         // forward transform
         ref_coeff[k++] = y_coeff[MAX_SB_SIZE * j + i] >> shift;
       }
     }
+#if CONFIG_CFL_STATS
+    count = &cfl->stats.load_part;
+    cycles = &cfl->stats.load_part_cycles;
+#endif
   } else {
-    tf_merge_and_subsample(cfl, ref_coeff, uv_tx_size, y_coeff, MAX_SB_SIZE,
-        y_tx_size, uv_tx_size);
+    // Check that the collocated luma region is inside the superblock
+    assert(coeff_offset
+        + (((uv_tx_size << cfl->subsampling_y) - 1) * MAX_SB_SIZE
+        + ((uv_tx_size << cfl->subsampling_x) - 1)) < MAX_SB_SQUARE);
+
+    // The TF merge is performed once per luma region, the other chroma plane
+    // reuses the predictor from the cache.
+    tran_low_t *const cached = &cfl->pred_cache[
+      (uv_blk_row * scale) * MAX_SB_SIZE + (uv_blk_col * scale)];
+    int j;
+    if (!cfl_cache_hit(cfl, uv_blk_row, uv_blk_col, uv_tx_size)) {
+      tf_merge_and_subsample(cfl, cached, MAX_SB_SIZE, y_coeff, MAX_SB_SIZE,
+          y_tx_size, uv_tx_size);
+      cfl_cache_insert(cfl, uv_blk_row, uv_blk_col, uv_tx_size);
+#if CONFIG_CFL_STATS
+      count = &cfl->stats.load_merge;
+      cycles = &cfl->stats.load_merge_cycles;
+    } else {
+      count = &cfl->stats.load_cached;
+      cycles = &cfl->stats.load_cached_cycles;
+#endif
+    }
+    for (j = 0; j < uv_tx_size; j++) {
+      memcpy(&ref_coeff[j * uv_tx_size], &cached[j * MAX_SB_SIZE],
+          sizeof(tran_low_t) * uv_tx_size);
+    }
   }
   // CfL does not apply to dc (only ac)
   ref_coeff[0] = dc;
+#if CONFIG_CFL_STATS
+  (*count)++;
+  *cycles += cfl_cycles() - start;
+#endif
 }
 
 /* Store the values of the luma plane to predict the values of the chroma plane
@@ -137,11 +358,22 @@ void cfl_store_predictor(CFL_CONTEXT *const cfl, int blk_row, int blk_col,
 		int tx_blk_size, const tran_low_t *const ref_coeff,
 		const tran_low_t *const dqcoeff, int ac_dc_coded) {
 
-  const int scale = 4; // Needs to be adjusted to support 4:4:4
+  // Luma is never subsampled: blk_row and blk_col are in units of 4x4 luma
+  // blocks for all chroma formats.
+  const int scale = 4;
   const int coeff_offset = scale * blk_row * MAX_SB_SIZE + (scale * blk_col);
   const tran_low_t *src;
   tran_low_t *const luma_coeff = &cfl->luma_coeff[coeff_offset];
   int i,j,k = 0;
+#if CONFIG_CFL_STATS
+  const uint64_t start = cfl_cycles();
+#endif
+
+  // Cached predictors are stale once luma changes
+  if (++cfl->store_count == 0) {
+    memset(cfl->pred_cache_keys, 0, sizeof(cfl->pred_cache_keys));
+    cfl->store_count = 1;
+  }
 
   if (blk_row != 0 || blk_col != 0) {
     // Check that all luma parts are the same size
@@ -178,6 +410,12 @@ void cfl_store_predictor(CFL_CONTEXT *const cfl, int blk_row, int blk_col,
     default:
       fprintf(stderr, "AC_DC_CODED value %d is > 3\n", ac_dc_coded);
       assert(0);
+#if CONFIG_CFL_STATS
+      cfl->stats.store[CFL_STATS_STORE_PATHS - 1]++;
+      cfl->stats.store_cycles[CFL_STATS_STORE_PATHS - 1] +=
+        cfl_cycles() - start;
+#endif
+      return;
   }
 
   for (j = 0; j < tx_blk_size; j++) {
@@ -185,12 +423,16 @@ void cfl_store_predictor(CFL_CONTEXT *const cfl, int blk_row, int blk_col,
       luma_coeff[j * MAX_SB_SIZE + i] = src[k++];
     }
   }
+#if CONFIG_CFL_STATS
+  cfl->stats.store[ac_dc_coded]++;
+  cfl->stats.store_cycles[ac_dc_coded] += cfl_cycles() - start;
+#endif
 }
 
 /*Increase horizontal and vertical frequency resolution of an entire block and
    return the LF quarter.*/
-void od_tf_up_hv_lp(tran_high_t *const dst, int dstride,
- const tran_high_t *const src, int sstride, int dx, int dy, int n) {
+void od_tf_up_hv_lp_c(int32_t *const dst, int dstride,
+ const int32_t *const src, int sstride, int dx, int dy, int n) {
   int x;
   int y;
   for (y = 0; y < n >> 1; y++) {
@@ -217,9 +459,53 @@ void od_tf_up_hv_lp(tran_high_t *const dst, int dstride,
   }
 }
 
+/*Increase horizontal frequency resolution of an entire block and return the
+   LF half.*/
+void od_tf_up_h_lp(int32_t *const dst, int dstride,
+ const int32_t *const src, int sstride, int dx, int n) {
+  int x;
+  int y;
+  for (y = 0; y < n; y++) {
+    for (x = 0; x < n >> 1; x++) {
+      int32_t ll;
+      int32_t lh;
+      int hswap;
+      ll = src[y*sstride + x];
+      lh = src[y*sstride + x + dx];
+      lh = ll - lh;
+      ll -= OD_DCT_RSHIFT(lh, 1);
+      hswap = x & 1;
+      dst[y*dstride + 2*x + hswap] = ll;
+      dst[y*dstride + 2*x + 1 - hswap] = lh;
+    }
+  }
+}
+
+/*Increase vertical frequency resolution of an entire block and return the
+   LF half.*/
+void od_tf_up_v_lp(int32_t *const dst, int dstride,
+ const int32_t *const src, int sstride, int dy, int n) {
+  int x;
+  int y;
+  for (y = 0; y < n >> 1; y++) {
+    int vswap;
+    vswap = y & 1;
+    for (x = 0; x < n; x++) {
+      int32_t ll;
+      int32_t hl;
+      ll = src[y*sstride + x];
+      hl = src[(y + dy)*sstride + x];
+      hl = ll - hl;
+      ll -= OD_DCT_RSHIFT(hl, 1);
+      dst[(2*y + vswap)*dstride + x] = ll;
+      dst[(2*y + 1 - vswap)*dstride + x] = hl;
+    }
+  }
+}
+
 /*Increase horizontal and vertical frequency resolution of a 2x2 group of
   nxn blocks, combining them into a single 2nx2n block.*/
-void od_tf_up_hv(tran_high_t *dst, int dstride, const tran_high_t *const  src,
+void od_tf_up_hv_c(int32_t *dst, int dstride, const int32_t *const  src,
     int sstride, int n) {
   int x;
   int y;
@@ -227,10 +513,10 @@ void od_tf_up_hv(tran_high_t *dst, int dstride, const tran_high_t *const  src,
     int vswap;
     vswap = y & 1;
     for (x = 0; x < n; x++) {
-      tran_high_t ll;
-      tran_high_t lh;
-      tran_high_t hl;
-      tran_high_t hh;
+      int32_t ll;
+      int32_t lh;
+      int32_t hl;
+      int32_t hh;
       int hswap;
       ll = src[y*sstride + x];
       lh = src[y*sstride + x + n];
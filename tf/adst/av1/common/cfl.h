@@ -11,9 +11,14 @@
 #ifndef AV1_COMMON_CFL_H_
 #define AV1_COMMON_CFL_H_
 
+#include "./aom_config.h"
 #include "aom_dsp/aom_dsp_common.h"
 #include "av1/common/enums.h"
 
+#if CONFIG_CFL_STATS
+#include <stdio.h>
+#endif
+
 // The number of Min TX blocks in one row of a superblock
 #define CFL_TX_STRIDE (16)
 // The maximum number of Min TX blocks in a super block
@@ -23,6 +28,32 @@
 extern "C" {
 #endif
 
+// Key of a TF merged predictor in the CfL predictor cache.
+typedef struct cfl_pred_cache_key {
+  // Value of the store counter when the predictor was merged (the entry is
+  // stale once luma is stored again). 0 is never used.
+  unsigned int store_count;
+  int y_tx_size;
+  int uv_tx_size;
+} CFL_PRED_CACHE_KEY;
+
+#if CONFIG_CFL_STATS
+#define CFL_STATS_STORE_PATHS (5)
+
+// Number of calls and cycles spent on each path of the CfL predictor.
+typedef struct cfl_stats {
+  // cfl_load_predictor: luma bigger than chroma, part of the coefficients
+  uint64_t load_part, load_part_cycles;
+  // cfl_load_predictor: TF merge (cache miss)
+  uint64_t load_merge, load_merge_cycles;
+  // cfl_load_predictor: TF merged predictor from the cache
+  uint64_t load_cached, load_cached_cycles;
+  // cfl_store_predictor, indexed by ac_dc_coded. The last slot counts the
+  // out of range values, which store nothing.
+  uint64_t store[CFL_STATS_STORE_PATHS], store_cycles[CFL_STATS_STORE_PATHS];
+} CFL_STATS;
+#endif
+
 // CFL: This will replace cfl_ctx
 typedef struct cfl_context {
 
@@ -30,15 +61,40 @@ typedef struct cfl_context {
    * to properly perform CfL. */
   int luma_tx_blk_size;
 
+  /* Chroma subsampling (log2) of the frame: 1, 1 for 4:2:0, 1, 0 for 4:2:2
+   * and 0, 0 for 4:4:4. */
+  int subsampling_x;
+  int subsampling_y;
+
   /* Dequantized transformed coefficients of Luma used to predict Chroma.*/
   DECLARE_ALIGNED(16, tran_low_t, luma_coeff[MAX_SB_SQUARE]);
 
   // Double buffer system used by TF merge.
   // It's located in cfl_context to avoid collisions between threads.
-  tran_high_t buf1[MAX_SB_SQUARE], buf2[MAX_SB_SQUARE];
+  // The buffers are 32 bits for all bit depths: TF merging 12 bit 4x4
+  // coefficients up to 32x32 needs at most 24 bits, and unlike tran_high_t
+  // (64 bits in high bitdepth builds), 32 bits keep 4 lanes per SSE2 register.
+  DECLARE_ALIGNED(16, int32_t, buf1[MAX_SB_SQUARE]);
+  DECLARE_ALIGNED(16, int32_t, buf2[MAX_SB_SQUARE]);
+
+  // Number of calls to cfl_store_predictor, used to invalidate the cache.
+  unsigned int store_count;
+
+  /* Cache of TF merged predictors, so that both chroma planes reuse the same
+   * TF merge. Predictors are stored at the position of their chroma block
+   * (stride MAX_SB_SIZE) and the keys are indexed by the 4x4 chroma block at
+   * their top left corner. */
+  DECLARE_ALIGNED(16, tran_low_t, pred_cache[MAX_SB_SQUARE]);
+  CFL_PRED_CACHE_KEY pred_cache_keys[CFL_MAX_TX_BLOCKS];
+
+#if CONFIG_CFL_STATS
+  CFL_STATS stats;
+#endif
 } CFL_CONTEXT;
 
 
+void cfl_init(CFL_CONTEXT *const cfl, int subsampling_x, int subsampling_y);
+
 void cfl_load_predictor(CFL_CONTEXT *const cfl, int blk_row, int blk_col,
 		tran_low_t *const ref_coeff, int tx_blk_size);
 
@@ -46,6 +102,16 @@ void cfl_store_predictor(CFL_CONTEXT *const cfl, int blk_row, int blk_col,
 		int tx_blk_size, const tran_low_t *const ref_coeff,
 		const tran_low_t *const dqcoeff, int ac_dc_coded);
 
+#if CONFIG_CFL_STATS
+void cfl_stats_reset(CFL_STATS *const stats);
+
+void cfl_stats_add(CFL_STATS *const dst, const CFL_STATS *const src);
+
+// Print the counters and the average cycles of each path.
+void cfl_stats_dump(FILE *f, const CFL_STATS *const stats,
+		const char *const label);
+#endif
+
 
 /*This is an in-place, reversible, orthonormal Haar transform in 7 adds,
    1 shift (2 operations per sample).
@@ -65,12 +131,21 @@ void cfl_store_predictor(CFL_CONTEXT *const cfl, int blk_row, int blk_col,
   } \
   while(0)
 
+/*This is the strength reduced version of ((_a)/(1 << (_b))).
+  This will not work for _b == 0, however currently this is only used for
+  b == 1 anyway.*/
+#define OD_UNBIASED_RSHIFT32(_a, _b) \
+  (((int32_t)(((uint32_t)(_a) >> (32 - (_b))) + (_a))) >> (_b))
+
+#define OD_DCT_RSHIFT(_a, _b) OD_UNBIASED_RSHIFT32(_a, _b)
+
+// od_tf_up_hv and od_tf_up_hv_lp have SIMD versions, see av1_rtcd.h
 
-void od_tf_up_hv_lp(tran_high_t *dst, int dstride, const tran_high_t *const src,
-		int sstride, int dx, int dy, int n);
+void od_tf_up_h_lp(int32_t *dst, int dstride, const int32_t *const src,
+		int sstride, int dx, int n);
 
-void od_tf_up_hv(tran_high_t *dst, int dstride, const tran_high_t *src,
-    int sstride, int n);
+void od_tf_up_v_lp(int32_t *dst, int dstride, const int32_t *const src,
+		int sstride, int dy, int n);
 
 void tf_merge_and_subsample(CFL_CONTEXT *const cfl, tran_low_t *const dst,
     int dstride, const tran_low_t *const src, int sstride, int y_tx_size,
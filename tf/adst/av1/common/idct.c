@@ -221,8 +221,8 @@ static void highbd_idct64_row_c(const tran_low_t *input, tran_low_t *output,
 
 // Inverse identity transform and add.
 #if CONFIG_EXT_TX
-static void inv_idtx_add_c(const tran_low_t *input, uint8_t *dest, int stride,
-                           int bs, int tx_type) {
+void av1_inv_idtx_add_c(const tran_low_t *input, uint8_t *dest, int stride,
+                        int bs, int tx_type) {
   int r, c;
   const int shift = bs < 32 ? 3 : (bs < 64 ? 2 : 1);
   if (tx_type == IDTX) {
@@ -1332,17 +1332,14 @@ void av1_inv_txfm_add_4x4(const tran_low_t *input, uint8_t *dest, int stride,
     case DCT_FLIPADST:
     case FLIPADST_FLIPADST:
     case ADST_FLIPADST:
-    case FLIPADST_ADST: av1_iht4x4_16_add(input, dest, stride, tx_type); break;
+    case FLIPADST_ADST:
     case V_DCT:
     case H_DCT:
     case V_ADST:
     case H_ADST:
     case V_FLIPADST:
-    case H_FLIPADST:
-      // Use C version since DST only exists in C code
-      av1_iht4x4_16_add_c(input, dest, stride, tx_type);
-      break;
-    case IDTX: inv_idtx_add_c(input, dest, stride, 4, tx_type); break;
+    case H_FLIPADST: av1_iht4x4_16_add(input, dest, stride, tx_type); break;
+    case IDTX: av1_inv_idtx_add(input, dest, stride, 4, tx_type); break;
 #endif  // CONFIG_EXT_TX
     default: assert(0); break;
   }
@@ -1420,17 +1417,14 @@ void av1_inv_txfm_add_8x8(const tran_low_t *input, uint8_t *dest, int stride,
     case DCT_FLIPADST:
     case FLIPADST_FLIPADST:
     case ADST_FLIPADST:
-    case FLIPADST_ADST: av1_iht8x8_64_add(input, dest, stride, tx_type); break;
+    case FLIPADST_ADST:
     case V_DCT:
     case H_DCT:
     case V_ADST:
     case H_ADST:
     case V_FLIPADST:
-    case H_FLIPADST:
-      // Use C version since DST only exists in C code
-      av1_iht8x8_64_add_c(input, dest, stride, tx_type);
-      break;
-    case IDTX: inv_idtx_add_c(input, dest, stride, 8, tx_type); break;
+    case H_FLIPADST: av1_iht8x8_64_add(input, dest, stride, tx_type); break;
+    case IDTX: av1_inv_idtx_add(input, dest, stride, 8, tx_type); break;
 #endif  // CONFIG_EXT_TX
     default: assert(0); break;
   }
@@ -1455,7 +1449,7 @@ void av1_inv_txfm_add_16x16(const tran_low_t *input, uint8_t *dest, int stride,
     case H_ADST:
     case V_FLIPADST:
     case H_FLIPADST: av1_iht16x16_256_add(input, dest, stride, tx_type); break;
-    case IDTX: inv_idtx_add_c(input, dest, stride, 16, tx_type); break;
+    case IDTX: av1_inv_idtx_add(input, dest, stride, 16, tx_type); break;
 #endif  // CONFIG_EXT_TX
     default: assert(0); break;
   }
@@ -1480,9 +1474,9 @@ void av1_inv_txfm_add_32x32(const tran_low_t *input, uint8_t *dest, int stride,
     case H_ADST:
     case V_FLIPADST:
     case H_FLIPADST:
-      av1_iht32x32_1024_add_c(input, dest, stride, tx_type);
+      av1_iht32x32_1024_add(input, dest, stride, tx_type);
       break;
-    case IDTX: inv_idtx_add_c(input, dest, stride, 32, tx_type); break;
+    case IDTX: av1_inv_idtx_add(input, dest, stride, 32, tx_type); break;
 #endif  // CONFIG_EXT_TX
     default: assert(0); break;
   }
@@ -1510,7 +1504,7 @@ void av1_inv_txfm_add_64x64(const tran_low_t *input, uint8_t *dest, int stride,
     case H_FLIPADST:
       av1_iht64x64_4096_add_c(input, dest, stride, tx_type);
       break;
-    case IDTX: inv_idtx_add_c(input, dest, stride, 64, tx_type); break;
+    case IDTX: av1_inv_idtx_add(input, dest, stride, 64, tx_type); break;
 #endif  // CONFIG_EXT_TX
     default: assert(0); break;
   }
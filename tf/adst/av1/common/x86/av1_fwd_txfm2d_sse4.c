@@ -14,12 +14,41 @@
 #include "av1/common/av1_txfm.h"
 #include "av1/common/x86/av1_txfm1d_sse4.h"
 
-static INLINE void int16_array_with_stride_to_int32_array_without_stride(
-    const int16_t *input, int stride, int32_t *output, int txfm1d_size) {
+/* Converts the block to 32 bits. The flips are folded into the loads:
+ * flipping upside down reads the rows from the bottom up (negative stride)
+ * and flipping left to right reverses groups of 8 pixels read from the
+ * right. */
+static INLINE void load_buffer_32(const int16_t *input, int stride,
+                                  __m128i *output, int txfm1d_size,
+                                  int ud_flip, int lr_flip) {
+  const __m128i rev =
+      _mm_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
   int r, c;
-  for (r = 0; r < txfm1d_size; r++) {
-    for (c = 0; c < txfm1d_size; c++) {
-      output[r * txfm1d_size + c] = (int32_t)input[r * stride + c];
+  if (ud_flip) {
+    input += (txfm1d_size - 1) * stride;
+    stride = -stride;
+  }
+  if (lr_flip) {
+    for (r = 0; r < txfm1d_size; r++) {
+      for (c = 0; c < txfm1d_size; c += 8) {
+        const __m128i x = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i *)(input + txfm1d_size - 8 - c)),
+            rev);
+        output[0] = _mm_cvtepi16_epi32(x);
+        output[1] = _mm_cvtepi16_epi32(_mm_srli_si128(x, 8));
+        output += 2;
+      }
+      input += stride;
+    }
+  } else {
+    for (r = 0; r < txfm1d_size; r++) {
+      for (c = 0; c < txfm1d_size; c += 8) {
+        const __m128i x = _mm_loadu_si128((const __m128i *)(input + c));
+        output[0] = _mm_cvtepi16_epi32(x);
+        output[1] = _mm_cvtepi16_epi32(_mm_srli_si128(x, 8));
+        output += 2;
+      }
+      input += stride;
     }
   }
 }
@@ -37,8 +66,10 @@ static INLINE TxfmFuncSSE2 fwd_txfm_type_to_func(TXFM_TYPE txfm_type) {
 }
 
 static INLINE void fwd_txfm2d_sse4_1(const int16_t *input, int32_t *output,
-                                     const int stride, const TXFM_2D_CFG *cfg,
+                                     const int stride,
+                                     const TXFM_2D_FLIP_CFG *flip_cfg,
                                      int32_t *txfm_buf) {
+  const TXFM_2D_CFG *cfg = flip_cfg->cfg;
   const int txfm_size = cfg->txfm_size;
   const int8_t *shift = cfg->shift;
   const int8_t *stage_range_col = cfg->stage_range_col;
@@ -53,8 +84,8 @@ static INLINE void fwd_txfm2d_sse4_1(const int16_t *input, int32_t *output,
   int num_per_128 = 4;
   int txfm2d_size_128 = txfm_size * txfm_size / num_per_128;
 
-  int16_array_with_stride_to_int32_array_without_stride(input, stride, txfm_buf,
-                                                        txfm_size);
+  load_buffer_32(input, stride, buf_128, txfm_size, flip_cfg->ud_flip,
+                 flip_cfg->lr_flip);
   round_shift_array_32_sse4_1(buf_128, out_128, txfm2d_size_128, -shift[0]);
   txfm_func_col(out_128, buf_128, cos_bit_col, stage_range_col);
   round_shift_array_32_sse4_1(buf_128, out_128, txfm2d_size_128, -shift[1]);
@@ -69,7 +100,7 @@ void av1_fwd_txfm2d_32x32_sse4_1(const int16_t *input, int32_t *output,
   DECLARE_ALIGNED(16, int32_t, txfm_buf[1024]);
   TXFM_2D_FLIP_CFG cfg = av1_get_fwd_txfm_cfg(tx_type, TX_32X32);
   (void)bd;
-  fwd_txfm2d_sse4_1(input, output, stride, cfg.cfg, txfm_buf);
+  fwd_txfm2d_sse4_1(input, output, stride, &cfg, txfm_buf);
 }
 
 void av1_fwd_txfm2d_64x64_sse4_1(const int16_t *input, int32_t *output,
@@ -77,5 +108,5 @@ void av1_fwd_txfm2d_64x64_sse4_1(const int16_t *input, int32_t *output,
   DECLARE_ALIGNED(16, int32_t, txfm_buf[4096]);
   TXFM_2D_FLIP_CFG cfg = av1_get_fwd_txfm_64x64_cfg(tx_type);
   (void)bd;
-  fwd_txfm2d_sse4_1(input, output, stride, cfg.cfg, txfm_buf);
+  fwd_txfm2d_sse4_1(input, output, stride, &cfg, txfm_buf);
 }
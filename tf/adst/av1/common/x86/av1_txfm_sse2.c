@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2016, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <emmintrin.h>
+
+#include "./av1_rtcd.h"
+#include "av1/common/av1_txfm.h"
+
+// The transposes are made of 4x4 tiles of 32 bit coefficients transposed in
+// registers (n, and the rows of av1_transpose_int32(), are multiples of 4).
+static INLINE void transpose_4x4_sse2(__m128i *x) {
+  const __m128i t0 = _mm_unpacklo_epi32(x[0], x[1]);
+  const __m128i t1 = _mm_unpacklo_epi32(x[2], x[3]);
+  const __m128i t2 = _mm_unpackhi_epi32(x[0], x[1]);
+  const __m128i t3 = _mm_unpackhi_epi32(x[2], x[3]);
+  x[0] = _mm_unpacklo_epi64(t0, t1);
+  x[1] = _mm_unpackhi_epi64(t0, t1);
+  x[2] = _mm_unpacklo_epi64(t2, t3);
+  x[3] = _mm_unpackhi_epi64(t2, t3);
+}
+
+// Sign extends 4 int16_t to 32 bits.
+static INLINE __m128i load_int16_to_int32_sse2(const int16_t *p) {
+  const __m128i x = _mm_loadl_epi64((const __m128i *)p);
+  return _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+}
+
+void av1_transpose_int16_to_int32_sse2(const int16_t *input, int stride,
+                                       int32_t *output, int n) {
+  int r, c, i;
+  for (r = 0; r < n; r += 4) {
+    for (c = 0; c < n; c += 4) {
+      __m128i x[4];
+      for (i = 0; i < 4; i++) {
+        x[i] = load_int16_to_int32_sse2(input + (r + i) * stride + c);
+      }
+      transpose_4x4_sse2(x);
+      for (i = 0; i < 4; i++) {
+        _mm_storeu_si128((__m128i *)(output + (c + i) * n + r), x[i]);
+      }
+    }
+  }
+}
+
+void av1_transpose_int32_sse2(const int32_t *input, int32_t *output, int n,
+                              int rows) {
+  int r, c, i;
+  for (r = 0; r < rows; r += 4) {
+    for (c = 0; c < n; c += 4) {
+      __m128i x[4];
+      for (i = 0; i < 4; i++) {
+        x[i] = _mm_loadu_si128((const __m128i *)(input + (r + i) * n + c));
+      }
+      transpose_4x4_sse2(x);
+      for (i = 0; i < 4; i++) {
+        _mm_storeu_si128((__m128i *)(output + (c + i) * n + r), x[i]);
+      }
+    }
+  }
+}
+
+// Like the C, the sums are truncated to 16 bits (the low 16 bits are sign
+// extended before packing, so _mm_packs_epi32 does not saturate).
+void av1_transpose_add_int32_to_int16_sse2(const int32_t *input,
+                                           int16_t *output, int stride,
+                                           int n) {
+  int r, c, i;
+  for (c = 0; c < n; c += 4) {
+    for (r = 0; r < n; r += 4) {
+      __m128i x[4];
+      for (i = 0; i < 4; i++) {
+        x[i] = _mm_loadu_si128((const __m128i *)(input + (c + i) * n + r));
+      }
+      transpose_4x4_sse2(x);
+      for (i = 0; i < 4; i++) {
+        int16_t *out = output + (r + i) * stride + c;
+        __m128i sum = _mm_add_epi32(load_int16_to_int32_sse2(out), x[i]);
+        sum = _mm_srai_epi32(_mm_slli_epi32(sum, 16), 16);
+        _mm_storel_epi64((__m128i *)out, _mm_packs_epi32(sum, sum));
+      }
+    }
+  }
+}
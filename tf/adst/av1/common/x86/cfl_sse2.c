@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2016, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <assert.h>
+#include <emmintrin.h>
+
+#include "./av1_rtcd.h"
+#include "av1/common/cfl.h"
+
+// OD_HAAR_KERNEL(ll, hl, lh, hh) on 4 lanes of 32 bit coefficients (lh and hl
+// are swapped like in the C version).
+static INLINE void haar_kernel_sse2(__m128i *ll, __m128i *lh, __m128i *hl,
+                                    __m128i *hh) {
+  __m128i llmhh_2;
+  *ll = _mm_add_epi32(*ll, *lh);
+  *hh = _mm_sub_epi32(*hh, *hl);
+  llmhh_2 = _mm_srai_epi32(_mm_sub_epi32(*ll, *hh), 1);
+  *hl = _mm_sub_epi32(llmhh_2, *hl);
+  *lh = _mm_sub_epi32(llmhh_2, *lh);
+  *ll = _mm_sub_epi32(*ll, *hl);
+  *hh = _mm_add_epi32(*hh, *lh);
+}
+
+// Interleave 4 low and 4 high coefficients into 8 consecutive outputs. The
+// order of each pair alternates (hswap = x & 1): l0 h0 h1 l1 l2 h2 h3 l3.
+static INLINE void store_interleaved_sse2(int32_t *dst, __m128i l, __m128i h) {
+  const __m128i lo = _mm_unpacklo_epi32(l, h);
+  const __m128i hi = _mm_unpackhi_epi32(l, h);
+  _mm_storeu_si128((__m128i *)dst,
+                   _mm_shuffle_epi32(lo, _MM_SHUFFLE(2, 3, 1, 0)));
+  _mm_storeu_si128((__m128i *)(dst + 4),
+                   _mm_shuffle_epi32(hi, _MM_SHUFFLE(2, 3, 1, 0)));
+}
+
+// Haar merge the w x h block at src with the blocks dx to the right and dy
+// below. w must be a multiple of 4.
+static INLINE void tf_up_hv_sse2(int32_t *dst, int dstride,
+                                 const int32_t *src, int sstride, int dx,
+                                 int dy, int w, int h) {
+  int x;
+  int y;
+  for (y = 0; y < h; y++) {
+    const int vswap = y & 1;
+    const int32_t *top = src + y * sstride;
+    const int32_t *bottom = top + dy * sstride;
+    int32_t *even = dst + (2 * y + vswap) * dstride;
+    int32_t *odd = dst + (2 * y + 1 - vswap) * dstride;
+    for (x = 0; x < w; x += 4) {
+      __m128i ll = _mm_loadu_si128((const __m128i *)(top + x));
+      __m128i lh = _mm_loadu_si128((const __m128i *)(top + x + dx));
+      __m128i hl = _mm_loadu_si128((const __m128i *)(bottom + x));
+      __m128i hh = _mm_loadu_si128((const __m128i *)(bottom + x + dx));
+      haar_kernel_sse2(&ll, &lh, &hl, &hh);
+      store_interleaved_sse2(even + 2 * x, ll, lh);
+      store_interleaved_sse2(odd + 2 * x, hl, hh);
+    }
+  }
+}
+
+void od_tf_up_hv_sse2(int32_t *dst, int dstride, const int32_t *src,
+                      int sstride, int n) {
+  assert((n & 3) == 0);
+  tf_up_hv_sse2(dst, dstride, src, sstride, n, n, n, n);
+}
+
+void od_tf_up_hv_lp_sse2(int32_t *dst, int dstride, const int32_t *src,
+                         int sstride, int dx, int dy, int n) {
+  // The 4x4 low pass only has 2 coefficients per row.
+  if (n < 8) {
+    od_tf_up_hv_lp_c(dst, dstride, src, sstride, dx, dy, n);
+    return;
+  }
+  tf_up_hv_sse2(dst, dstride, src, sstride, dx, dy, n >> 1, n >> 1);
+}
@@ -501,3 +501,28 @@ void av1_iht16x16_256_add_avx2(const tran_low_t *input, uint8_t *dest,
   }
   write_buffer_16x16(in, stride, dest);
 }
+
+#if CONFIG_EXT_TX
+void av1_inv_idtx_add_avx2(const tran_low_t *input, uint8_t *dest, int stride,
+                           int bs, int tx_type) {
+  const __m128i shift = _mm_cvtsi32_si128(bs < 32 ? 3 : (bs < 64 ? 2 : 1));
+  __m256i in;
+  int r, c;
+
+  if (bs < 16) {
+    av1_inv_idtx_add_sse2(input, dest, stride, bs, tx_type);
+    return;
+  }
+  if (tx_type != IDTX) return;
+
+  for (r = 0; r < bs; ++r) {
+    for (c = 0; c < bs; c += 16) {
+      load_coeff(input + c, &in);
+      in = _mm256_sra_epi16(in, shift);
+      recon_and_store(&in, dest + c);
+    }
+    dest += stride;
+    input += bs;
+  }
+}
+#endif  // CONFIG_EXT_TX
@@ -56,6 +56,36 @@ static INLINE void fliplr_16x8(__m128i in[16]) {
     (dest) = (dest) + ((size)-1) * (stride); \
     (stride) = -(stride);                    \
   } while (0)
+
+static void iidtx8_sse2(__m128i *in) {
+  in[0] = _mm_slli_epi16(in[0], 1);
+  in[1] = _mm_slli_epi16(in[1], 1);
+  in[2] = _mm_slli_epi16(in[2], 1);
+  in[3] = _mm_slli_epi16(in[3], 1);
+  in[4] = _mm_slli_epi16(in[4], 1);
+  in[5] = _mm_slli_epi16(in[5], 1);
+  in[6] = _mm_slli_epi16(in[6], 1);
+  in[7] = _mm_slli_epi16(in[7], 1);
+}
+
+static INLINE void iidtx4_sse2(__m128i *in) {
+  const __m128i v_scale_w = _mm_set1_epi16(Sqrt2);
+
+  const __m128i v_p0l_w = _mm_mullo_epi16(in[0], v_scale_w);
+  const __m128i v_p0h_w = _mm_mulhi_epi16(in[0], v_scale_w);
+  const __m128i v_p1l_w = _mm_mullo_epi16(in[1], v_scale_w);
+  const __m128i v_p1h_w = _mm_mulhi_epi16(in[1], v_scale_w);
+
+  const __m128i v_p0a_d = _mm_unpacklo_epi16(v_p0l_w, v_p0h_w);
+  const __m128i v_p0b_d = _mm_unpackhi_epi16(v_p0l_w, v_p0h_w);
+  const __m128i v_p1a_d = _mm_unpacklo_epi16(v_p1l_w, v_p1h_w);
+  const __m128i v_p1b_d = _mm_unpackhi_epi16(v_p1l_w, v_p1h_w);
+
+  in[0] = _mm_packs_epi32(xx_roundn_epi32_unsigned(v_p0a_d, DCT_CONST_BITS),
+                          xx_roundn_epi32_unsigned(v_p0b_d, DCT_CONST_BITS));
+  in[1] = _mm_packs_epi32(xx_roundn_epi32_unsigned(v_p1a_d, DCT_CONST_BITS),
+                          xx_roundn_epi32_unsigned(v_p1b_d, DCT_CONST_BITS));
+}
 #endif
 
 void av1_iht4x4_16_add_sse2(const tran_low_t *input, uint8_t *dest, int stride,
@@ -111,6 +141,38 @@ void av1_iht4x4_16_add_sse2(const tran_low_t *input, uint8_t *dest, int stride,
       aom_iadst4_sse2(in);
       FLIPUD_PTR(dest, stride, 4);
       break;
+    case V_DCT:
+      iidtx4_sse2(in);
+      array_transpose_4x4(in);
+      aom_idct4_sse2(in);
+      break;
+    case H_DCT:
+      aom_idct4_sse2(in);
+      iidtx4_sse2(in);
+      array_transpose_4x4(in);
+      break;
+    case V_ADST:
+      iidtx4_sse2(in);
+      array_transpose_4x4(in);
+      aom_iadst4_sse2(in);
+      break;
+    case H_ADST:
+      aom_iadst4_sse2(in);
+      iidtx4_sse2(in);
+      array_transpose_4x4(in);
+      break;
+    case V_FLIPADST:
+      iidtx4_sse2(in);
+      array_transpose_4x4(in);
+      aom_iadst4_sse2(in);
+      FLIPUD_PTR(dest, stride, 4);
+      break;
+    case H_FLIPADST:
+      aom_iadst4_sse2(in);
+      iidtx4_sse2(in);
+      array_transpose_4x4(in);
+      fliplr_4x4(in);
+      break;
 #endif  // CONFIG_EXT_TX
     default: assert(0); break;
   }
@@ -209,6 +271,38 @@ void av1_iht8x8_64_add_sse2(const tran_low_t *input, uint8_t *dest, int stride,
       aom_iadst8_sse2(in);
       FLIPUD_PTR(dest, stride, 8);
       break;
+    case V_DCT:
+      iidtx8_sse2(in);
+      array_transpose_8x8(in, in);
+      aom_idct8_sse2(in);
+      break;
+    case H_DCT:
+      aom_idct8_sse2(in);
+      iidtx8_sse2(in);
+      array_transpose_8x8(in, in);
+      break;
+    case V_ADST:
+      iidtx8_sse2(in);
+      array_transpose_8x8(in, in);
+      aom_iadst8_sse2(in);
+      break;
+    case H_ADST:
+      aom_iadst8_sse2(in);
+      iidtx8_sse2(in);
+      array_transpose_8x8(in, in);
+      break;
+    case V_FLIPADST:
+      iidtx8_sse2(in);
+      array_transpose_8x8(in, in);
+      aom_iadst8_sse2(in);
+      FLIPUD_PTR(dest, stride, 8);
+      break;
+    case H_FLIPADST:
+      aom_iadst8_sse2(in);
+      iidtx8_sse2(in);
+      array_transpose_8x8(in, in);
+      fliplr_8x8(in);
+      break;
 #endif  // CONFIG_EXT_TX
     default: assert(0); break;
   }
@@ -530,36 +624,6 @@ void av1_iht16x16_256_add_sse2(const tran_low_t *input, uint8_t *dest,
 }
 
 #if CONFIG_EXT_TX
-static void iidtx8_sse2(__m128i *in) {
-  in[0] = _mm_slli_epi16(in[0], 1);
-  in[1] = _mm_slli_epi16(in[1], 1);
-  in[2] = _mm_slli_epi16(in[2], 1);
-  in[3] = _mm_slli_epi16(in[3], 1);
-  in[4] = _mm_slli_epi16(in[4], 1);
-  in[5] = _mm_slli_epi16(in[5], 1);
-  in[6] = _mm_slli_epi16(in[6], 1);
-  in[7] = _mm_slli_epi16(in[7], 1);
-}
-
-static INLINE void iidtx4_sse2(__m128i *in) {
-  const __m128i v_scale_w = _mm_set1_epi16(Sqrt2);
-
-  const __m128i v_p0l_w = _mm_mullo_epi16(in[0], v_scale_w);
-  const __m128i v_p0h_w = _mm_mulhi_epi16(in[0], v_scale_w);
-  const __m128i v_p1l_w = _mm_mullo_epi16(in[1], v_scale_w);
-  const __m128i v_p1h_w = _mm_mulhi_epi16(in[1], v_scale_w);
-
-  const __m128i v_p0a_d = _mm_unpacklo_epi16(v_p0l_w, v_p0h_w);
-  const __m128i v_p0b_d = _mm_unpackhi_epi16(v_p0l_w, v_p0h_w);
-  const __m128i v_p1a_d = _mm_unpacklo_epi16(v_p1l_w, v_p1h_w);
-  const __m128i v_p1b_d = _mm_unpackhi_epi16(v_p1l_w, v_p1h_w);
-
-  in[0] = _mm_packs_epi32(xx_roundn_epi32_unsigned(v_p0a_d, DCT_CONST_BITS),
-                          xx_roundn_epi32_unsigned(v_p0b_d, DCT_CONST_BITS));
-  in[1] = _mm_packs_epi32(xx_roundn_epi32_unsigned(v_p1a_d, DCT_CONST_BITS),
-                          xx_roundn_epi32_unsigned(v_p1b_d, DCT_CONST_BITS));
-}
-
 // load 8x8 array
 static INLINE void flip_buffer_lr_8x8(__m128i *in) {
   in[0] = mm_reverse_epi16(in[0]);
@@ -1681,3 +1745,167 @@ void av1_iht32x16_512_add_sse2(const tran_low_t *input, uint8_t *dest,
   }
   write_buffer_32x16_round6(dest, in0, in1, in2, in3, stride);
 }
+
+#if CONFIG_EXT_TX
+// The 32x32 transform is made of the row transforms of two 32x16 blocks (the
+// top and bottom halves, in0-in3 and in4-in7), followed by the column
+// transforms of two 16x32 blocks (the left and right halves).
+static INLINE void flip_buffer_lr_32x16(__m128i *in0, __m128i *in1,
+                                        __m128i *in2, __m128i *in3) {
+  int i;
+  for (i = 0; i < 16; ++i) {
+    __m128i tmp1 = in0[i];
+    __m128i tmp2 = in1[i];
+    in0[i] = mm_reverse_epi16(in3[i]);
+    in1[i] = mm_reverse_epi16(in2[i]);
+    in2[i] = mm_reverse_epi16(tmp2);
+    in3[i] = mm_reverse_epi16(tmp1);
+  }
+}
+
+void av1_iht32x32_1024_add_sse2(const tran_low_t *input, uint8_t *dest,
+                                int stride, int tx_type) {
+  __m128i in0[16], in1[16], in2[16], in3[16];
+  __m128i in4[16], in5[16], in6[16], in7[16];
+  int i;
+
+  for (i = 0; i < 16; ++i) {
+    in0[i] = load_input_data(input + i * 32 + 0);
+    in1[i] = load_input_data(input + i * 32 + 8);
+    in2[i] = load_input_data(input + i * 32 + 16);
+    in3[i] = load_input_data(input + i * 32 + 24);
+    in4[i] = load_input_data(input + (i + 16) * 32 + 0);
+    in5[i] = load_input_data(input + (i + 16) * 32 + 8);
+    in6[i] = load_input_data(input + (i + 16) * 32 + 16);
+    in7[i] = load_input_data(input + (i + 16) * 32 + 24);
+  }
+
+  // Row transform
+  switch (tx_type) {
+    case DCT_DCT:
+    case ADST_DCT:
+    case FLIPADST_DCT:
+    case H_DCT:
+      idct32_16col(in0, in1, in2, in3);
+      idct32_16col(in4, in5, in6, in7);
+      break;
+    case DCT_ADST:
+    case ADST_ADST:
+    case DCT_FLIPADST:
+    case FLIPADST_FLIPADST:
+    case ADST_FLIPADST:
+    case FLIPADST_ADST:
+    case H_ADST:
+    case H_FLIPADST:
+      ihalfright32_16col(in0, in1, in2, in3);
+      ihalfright32_16col(in4, in5, in6, in7);
+      break;
+    case V_FLIPADST:
+    case V_ADST:
+    case V_DCT:
+    case IDTX:
+      iidtx32_16col(in0, in1, in2, in3);
+      iidtx32_16col(in4, in5, in6, in7);
+      break;
+    default: assert(0); break;
+  }
+
+  // Column transform
+  switch (tx_type) {
+    case DCT_DCT:
+    case DCT_ADST:
+    case DCT_FLIPADST:
+    case V_DCT:
+      idct32_16col(in0, in1, in4, in5);
+      idct32_16col(in2, in3, in6, in7);
+      break;
+    case ADST_DCT:
+    case ADST_ADST:
+    case FLIPADST_ADST:
+    case ADST_FLIPADST:
+    case FLIPADST_FLIPADST:
+    case FLIPADST_DCT:
+    case V_ADST:
+    case V_FLIPADST:
+      ihalfright32_16col(in0, in1, in4, in5);
+      ihalfright32_16col(in2, in3, in6, in7);
+      break;
+    case H_DCT:
+    case H_ADST:
+    case H_FLIPADST:
+    case IDTX:
+      iidtx32_16col(in0, in1, in4, in5);
+      iidtx32_16col(in2, in3, in6, in7);
+      break;
+    default: assert(0); break;
+  }
+
+  switch (tx_type) {
+    case DCT_DCT:
+    case ADST_DCT:
+    case DCT_ADST:
+    case ADST_ADST:
+    case H_DCT:
+    case H_ADST:
+    case V_ADST:
+    case V_DCT:
+    case IDTX: break;
+    case FLIPADST_DCT:
+    case FLIPADST_ADST:
+    case V_FLIPADST: FLIPUD_PTR(dest, stride, 32); break;
+    case DCT_FLIPADST:
+    case ADST_FLIPADST:
+    case H_FLIPADST:
+      flip_buffer_lr_32x16(in0, in1, in2, in3);
+      flip_buffer_lr_32x16(in4, in5, in6, in7);
+      break;
+    case FLIPADST_FLIPADST:
+      flip_buffer_lr_32x16(in0, in1, in2, in3);
+      flip_buffer_lr_32x16(in4, in5, in6, in7);
+      FLIPUD_PTR(dest, stride, 32);
+      break;
+    default: assert(0); break;
+  }
+  write_buffer_32x16_round6(dest, in0, in1, in2, in3, stride);
+  write_buffer_32x16_round6(dest + 16 * stride, in4, in5, in6, in7, stride);
+}
+
+void av1_inv_idtx_add_sse2(const tran_low_t *input, uint8_t *dest, int stride,
+                           int bs, int tx_type) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i shift = _mm_cvtsi32_si128(bs < 32 ? 3 : (bs < 64 ? 2 : 1));
+  int r, c;
+
+  if (tx_type != IDTX) return;
+
+  if (bs == 4) {
+    const __m128i in0 = _mm_sra_epi16(load_input_data(input), shift);
+    const __m128i in1 = _mm_sra_epi16(load_input_data(input + 8), shift);
+    __m128i d0 = _mm_cvtsi32_si128(*(const int *)(dest + stride * 0));
+    __m128i d1 = _mm_cvtsi32_si128(*(const int *)(dest + stride * 1));
+    __m128i d2 = _mm_cvtsi32_si128(*(const int *)(dest + stride * 2));
+    __m128i d3 = _mm_cvtsi32_si128(*(const int *)(dest + stride * 3));
+    d0 = _mm_unpacklo_epi32(d0, d1);
+    d2 = _mm_unpacklo_epi32(d2, d3);
+    d0 = _mm_unpacklo_epi8(d0, zero);
+    d2 = _mm_unpacklo_epi8(d2, zero);
+    d0 = _mm_add_epi16(d0, in0);
+    d2 = _mm_add_epi16(d2, in1);
+    d0 = _mm_packus_epi16(d0, d2);
+    *(int *)(dest + stride * 0) = _mm_cvtsi128_si32(d0);
+    *(int *)(dest + stride * 1) = _mm_cvtsi128_si32(_mm_srli_si128(d0, 4));
+    *(int *)(dest + stride * 2) = _mm_cvtsi128_si32(_mm_srli_si128(d0, 8));
+    *(int *)(dest + stride * 3) = _mm_cvtsi128_si32(_mm_srli_si128(d0, 12));
+    return;
+  }
+
+  for (r = 0; r < bs; ++r) {
+    for (c = 0; c < bs; c += 8) {
+      const __m128i in = _mm_sra_epi16(load_input_data(input + c), shift);
+      RECON_AND_STORE(dest + c, in);
+    }
+    dest += stride;
+    input += bs;
+  }
+}
+#endif  // CONFIG_EXT_TX
@@ -152,7 +152,8 @@ void av1_iht32x16_512_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_
 #define av1_iht32x16_512_add av1_iht32x16_512_add_sse2
 
 void av1_iht32x32_1024_add_c(const tran_low_t *input, uint8_t *output, int pitch, int tx_type);
-#define av1_iht32x32_1024_add av1_iht32x32_1024_add_c
+void av1_iht32x32_1024_add_sse2(const tran_low_t *input, uint8_t *output, int pitch, int tx_type);
+#define av1_iht32x32_1024_add av1_iht32x32_1024_add_sse2
 
 void av1_iht32x8_256_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride, int tx_type);
 #define av1_iht32x8_256_add av1_iht32x8_256_add_c
@@ -168,6 +169,11 @@ void av1_iht4x8_32_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride
 void av1_iht4x8_32_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride, int tx_type);
 #define av1_iht4x8_32_add av1_iht4x8_32_add_sse2
 
+#if CONFIG_TX64X64
+void av1_iht64x64_4096_add_c(const tran_low_t *input, uint8_t *output, int pitch, int tx_type);
+#define av1_iht64x64_4096_add av1_iht64x64_4096_add_c
+#endif  // CONFIG_TX64X64
+
 void av1_iht8x16_128_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride, int tx_type);
 void av1_iht8x16_128_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride, int tx_type);
 #define av1_iht8x16_128_add av1_iht8x16_128_add_sse2
@@ -183,6 +189,13 @@ void av1_iht8x8_64_add_c(const tran_low_t *input, uint8_t *dest, int dest_stride
 void av1_iht8x8_64_add_sse2(const tran_low_t *input, uint8_t *dest, int dest_stride, int tx_type);
 #define av1_iht8x8_64_add av1_iht8x8_64_add_sse2
 
+#if CONFIG_EXT_TX
+void av1_inv_idtx_add_c(const tran_low_t *input, uint8_t *dest, int stride, int bs, int tx_type);
+void av1_inv_idtx_add_sse2(const tran_low_t *input, uint8_t *dest, int stride, int bs, int tx_type);
+void av1_inv_idtx_add_avx2(const tran_low_t *input, uint8_t *dest, int stride, int bs, int tx_type);
+RTCD_EXTERN void (*av1_inv_idtx_add)(const tran_low_t *input, uint8_t *dest, int stride, int bs, int tx_type);
+#endif  // CONFIG_EXT_TX
+
 void av1_quantize_b_c(const tran_low_t *coeff_ptr, intptr_t n_coeffs, int skip_block, const int16_t *zbin_ptr, const int16_t *round_ptr, const int16_t *quant_ptr, const int16_t *quant_shift_ptr, tran_low_t *qcoeff_ptr, tran_low_t *dqcoeff_ptr, const int16_t *dequant_ptr, uint16_t *eob_ptr, const int16_t *scan, const int16_t *iscan, int log_scale);
 #define av1_quantize_b av1_quantize_b_c
 
@@ -199,6 +212,26 @@ void av1_temporal_filter_apply_c(uint8_t *frame1, unsigned int stride, uint8_t *
 void av1_temporal_filter_apply_sse2(uint8_t *frame1, unsigned int stride, uint8_t *frame2, unsigned int block_width, unsigned int block_height, int strength, int filter_weight, unsigned int *accumulator, uint16_t *count);
 #define av1_temporal_filter_apply av1_temporal_filter_apply_sse2
 
+void av1_transpose_add_int32_to_int16_c(const int32_t *input, int16_t *output, int stride, int n);
+void av1_transpose_add_int32_to_int16_sse2(const int32_t *input, int16_t *output, int stride, int n);
+#define av1_transpose_add_int32_to_int16 av1_transpose_add_int32_to_int16_sse2
+
+void av1_transpose_int16_to_int32_c(const int16_t *input, int stride, int32_t *output, int n);
+void av1_transpose_int16_to_int32_sse2(const int16_t *input, int stride, int32_t *output, int n);
+#define av1_transpose_int16_to_int32 av1_transpose_int16_to_int32_sse2
+
+void av1_transpose_int32_c(const int32_t *input, int32_t *output, int n, int rows);
+void av1_transpose_int32_sse2(const int32_t *input, int32_t *output, int n, int rows);
+#define av1_transpose_int32 av1_transpose_int32_sse2
+
+void od_tf_up_hv_c(int32_t *dst, int dstride, const int32_t *src, int sstride, int n);
+void od_tf_up_hv_sse2(int32_t *dst, int dstride, const int32_t *src, int sstride, int n);
+#define od_tf_up_hv od_tf_up_hv_sse2
+
+void od_tf_up_hv_lp_c(int32_t *dst, int dstride, const int32_t *src, int sstride, int dx, int dy, int n);
+void od_tf_up_hv_lp_sse2(int32_t *dst, int dstride, const int32_t *src, int sstride, int dx, int dy, int n);
+#define od_tf_up_hv_lp od_tf_up_hv_lp_sse2
+
 void av1_rtcd(void);
 
 #ifdef RTCD_C
@@ -228,6 +261,10 @@ static void setup_rtcd_internal(void)
     if (flags & HAS_SSE4_1) av1_full_search_sad = av1_full_search_sadx8;
     av1_iht16x16_256_add = av1_iht16x16_256_add_sse2;
     if (flags & HAS_AVX2) av1_iht16x16_256_add = av1_iht16x16_256_add_avx2;
+#if CONFIG_EXT_TX
+    av1_inv_idtx_add = av1_inv_idtx_add_sse2;
+    if (flags & HAS_AVX2) av1_inv_idtx_add = av1_inv_idtx_add_avx2;
+#endif  // CONFIG_EXT_TX
     av1_quantize_fp = av1_quantize_fp_sse2;
     if (flags & HAS_SSSE3) av1_quantize_fp = av1_quantize_fp_ssse3;
     av1_quantize_fp_32x32 = av1_quantize_fp_32x32_c;
@@ -4,7 +4,7 @@ set -e
 UTILS=../../utils
 VIDEOS=../../videos
 
-gcc -lasan -fsanitize=address -g aom_tf.c av1/common/av1_fwd_txfm2d.c av1/common/av1_fwd_txfm1d.c av1/common/av1_inv_txfm2d.c av1/common/av1_inv_txfm1d.c $UTILS/luma2png.c $UTILS/vidinput.c $UTILS/y4m_input.c -I$UTILS/ -I../../ -I. -lpng -o aom_tf
+gcc -lasan -fsanitize=address -g aom_tf.c av1/common/av1_fwd_txfm2d.c av1/common/av1_fwd_txfm1d.c av1/common/av1_inv_txfm2d.c av1/common/av1_inv_txfm1d.c av1/common/av1_txfm.c av1/common/x86/av1_txfm_sse2.c $UTILS/luma2png.c $UTILS/vidinput.c $UTILS/y4m_input.c -I$UTILS/ -I../../ -I. -lpng -o aom_tf
 
 ./aom_tf $VIDEOS/owl.y4m 4 0 0
 convert -comment 'DCT -> TF -> iDCT\n 4x4 -> 8x8' aom_tf_4.png  dct_4.png
@@ -27,6 +27,19 @@ convert -comment 'ADST -> TF -> iDCT\n 8x8 -> 16x16' aom_tf_8.png  adst_idct_8.p
 ./aom_tf $VIDEOS/owl.y4m 16 3 0
 convert -comment 'ADST -> TF -> iDCT\n 16x16 -> 32x32' aom_tf_16.png  adst_idct_16.png
 
+gcc -O2 -DCONFIG_COEFFICIENT_RANGE_STATS=1 txfm_range.c av1/common/av1_fwd_txfm2d.c av1/common/av1_fwd_txfm1d.c av1/common/av1_inv_txfm2d.c av1/common/av1_inv_txfm1d.c av1/common/av1_txfm.c av1/common/x86/av1_txfm_sse2.c $UTILS/vidinput.c $UTILS/y4m_input.c -I$UTILS/ -I../../ -I. -o txfm_range
+./txfm_range $VIDEOS/owl.y4m > txfm_range.txt
+
+gcc -O2 txfm_error.c txfm_ref.c av1/common/av1_fwd_txfm2d.c av1/common/av1_fwd_txfm1d.c av1/common/av1_inv_txfm2d.c av1/common/av1_inv_txfm1d.c av1/common/av1_txfm.c av1/common/x86/av1_txfm_sse2.c $UTILS/vidinput.c $UTILS/y4m_input.c -I$UTILS/ -I../../ -I. -lm -o txfm_error
+./txfm_error $VIDEOS/owl.y4m > txfm_error.txt
+
+# The hybrid inverse of idct.c, C against SSE2/AVX2. aom_dsp_rtcd.h and
+# aom_scale/yv12config.h stand in for the headers of the full aom build, and
+# CONFIG_PVQ=0 leaves out the av1/decoder headers, which are not in this copy.
+gcc -O2 -mavx2 -DCONFIG_EXT_TX=1 -DCONFIG_PVQ=0 -c av1/common/x86/hybrid_inv_txfm_avx2.c -I. -I../../ -o hybrid_inv_txfm_avx2.o
+gcc -O2 -msse2 -DCONFIG_EXT_TX=1 -DCONFIG_PVQ=0 hybrid_inv_check.c av1/common/idct.c av1/common/x86/idct_intrin_sse2.c av1/common/av1_inv_txfm1d.c aom_dsp/inv_txfm.c aom_dsp/x86/inv_txfm_sse2.c hybrid_inv_txfm_avx2.o -I. -I../../ -o hybrid_inv_check
+./hybrid_inv_check > hybrid_inv_check.txt
+
 montage -font "DejaVu-Sans-Bold" -pointsize 36 -geometry 640x480 -tile 3x3 -title "TF and ADST" -label '%c' dct_4.png adst_4.png adst_idct_4.png dct_8.png adst_8.png adst_idct_8.png dct_16.png adst_16.png adst_idct_16.png sidebyside.png
 
 eog sidebyside.png
@@ -0,0 +1,201 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+
+/* C against SIMD for the 8 bit hybrid inverse transforms of idct.c, built
+ * with -DCONFIG_EXT_TX=1:
+ *  - av1_iht4x4_16_add() and av1_iht8x8_64_add(), all the types but IDTX,
+ *  - av1_iht32x32_1024_add(), all the types,
+ *  - av1_inv_idtx_add(), all the sizes.
+ * Every version adds the inverse of the same coefficients to the same
+ * prediction, and the reconstructions must be equal. Half the blocks are
+ * dense, the other half only have their upper-left 4x4 coefficients. The
+ * coefficients are random, with amplitudes that keep the 16 bit
+ * intermediates of the SIMD versions in range. Then each version is timed
+ * on the same blocks. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "./av1_rtcd.h"
+#include "aom_ports/mem.h"
+#include "aom_ports/x86.h"
+#include "av1/common/enums.h"
+
+#define BLOCKS (256)
+#define RUNS (20)
+#define MAX_BS (64)
+
+/* The RTCD pointers of av1_rtcd.h that idct.c calls. av1_rtcd.c selects
+ * them among versions this harness does not build, so they are set here. */
+void (*av1_iht16x16_256_add)(const tran_low_t *input, uint8_t *output,
+                             int pitch, int tx_type);
+void (*av1_inv_idtx_add)(const tran_low_t *input, uint8_t *dest, int stride,
+                         int bs, int tx_type);
+
+typedef void (*iht_add)(const tran_low_t *input, uint8_t *dest, int stride,
+                        int tx_type);
+typedef void (*idtx_add)(const tran_low_t *input, uint8_t *dest, int stride,
+                         int bs, int tx_type);
+
+typedef struct {
+  const char *name;
+  int n;
+  int amplitude;
+  int skip_idtx;
+  iht_add c;
+  iht_add simd;
+} iht_test;
+
+static const iht_test iht_tests[] = {
+  { "4x4", 4, 1000, 1, av1_iht4x4_16_add_c, av1_iht4x4_16_add_sse2 },
+  { "8x8", 8, 1000, 1, av1_iht8x8_64_add_c, av1_iht8x8_64_add_sse2 },
+  { "32x32", 32, 600, 0, av1_iht32x32_1024_add_c,
+    av1_iht32x32_1024_add_sse2 },
+};
+
+#define NIHT_TESTS ((int)(sizeof(iht_tests) / sizeof(iht_tests[0])))
+
+static const char *const tx_type_names[TX_TYPES] = {
+  "DCT_DCT",   "ADST_DCT",          "DCT_ADST",      "ADST_ADST",
+  "FLIPADST_DCT", "DCT_FLIPADST",   "FLIPADST_FLIPADST", "ADST_FLIPADST",
+  "FLIPADST_ADST", "IDTX",          "V_DCT",         "H_DCT",
+  "V_ADST",    "H_ADST",            "V_FLIPADST",    "H_FLIPADST"
+};
+
+static DECLARE_ALIGNED(32, tran_low_t, coeffs[BLOCKS * MAX_BS * MAX_BS]);
+static uint8_t pred[BLOCKS * MAX_BS * MAX_BS];
+static uint8_t recon[3][BLOCKS * MAX_BS * MAX_BS];
+
+static uint32_t lcg_state;
+
+/* A fixed generator, so that the blocks do not depend on the libc. */
+static uint32_t lcg_next(void) {
+  lcg_state = lcg_state * 1664525 + 1013904223;
+  return lcg_state >> 16;
+}
+
+static double now() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void fill_blocks(int n, int amplitude) {
+  int i;
+  int j;
+  lcg_state = n;
+  for (i = 0; i < BLOCKS; i++) {
+    tran_low_t *const block = coeffs + i * n * n;
+    for (j = 0; j < n * n; j++) {
+      const int sparse = (i & 1) && (j / n >= 4 || j % n >= 4);
+      block[j] = sparse ? 0 : (int)(lcg_next() % (2 * amplitude + 1))
+                                   - amplitude;
+    }
+  }
+  for (j = 0; j < BLOCKS * n * n; j++) pred[j] = lcg_next() & 255;
+}
+
+static double time_iht(iht_add f, int n, int tx_type) {
+  double t;
+  int r;
+  int i;
+  memcpy(recon[0], pred, BLOCKS * n * n);
+  t = now();
+  for (r = 0; r < RUNS; r++) {
+    for (i = 0; i < BLOCKS; i++) {
+      f(coeffs + i * n * n, recon[0] + i * n * n, n, tx_type);
+    }
+  }
+  return (now() - t) * 1e9 / (RUNS * BLOCKS);
+}
+
+static double time_idtx(idtx_add f, int n) {
+  double t;
+  int r;
+  int i;
+  memcpy(recon[0], pred, BLOCKS * n * n);
+  t = now();
+  for (r = 0; r < RUNS; r++) {
+    for (i = 0; i < BLOCKS; i++) {
+      f(coeffs + i * n * n, recon[0] + i * n * n, n, n, IDTX);
+    }
+  }
+  return (now() - t) * 1e9 / (RUNS * BLOCKS);
+}
+
+int main(int _argc, char **_argv) {
+  const int avx2 = (x86_simd_caps() & HAS_AVX2) != 0;
+  int errors = 0;
+  int k;
+  int t;
+  int i;
+  (void)_argc;
+  (void)_argv;
+  av1_iht16x16_256_add =
+   avx2 ? av1_iht16x16_256_add_avx2 : av1_iht16x16_256_add_sse2;
+  av1_inv_idtx_add = avx2 ? av1_inv_idtx_add_avx2 : av1_inv_idtx_add_sse2;
+  printf("size,type,c_ns,simd_ns,speedup,match\n");
+  for (k = 0; k < NIHT_TESTS; k++) {
+    const iht_test *const test = &iht_tests[k];
+    const int n = test->n;
+    double c_total = 0;
+    double simd_total = 0;
+    fill_blocks(n, test->amplitude);
+    for (t = 0; t < TX_TYPES; t++) {
+      double c_ns;
+      double simd_ns;
+      int match;
+      if (t == IDTX && test->skip_idtx) continue;
+      memcpy(recon[0], pred, BLOCKS * n * n);
+      memcpy(recon[1], pred, BLOCKS * n * n);
+      for (i = 0; i < BLOCKS; i++) {
+        test->c(coeffs + i * n * n, recon[0] + i * n * n, n, t);
+        test->simd(coeffs + i * n * n, recon[1] + i * n * n, n, t);
+      }
+      match = memcmp(recon[0], recon[1], BLOCKS * n * n) == 0;
+      errors += !match;
+      c_ns = time_iht(test->c, n, t);
+      simd_ns = time_iht(test->simd, n, t);
+      c_total += c_ns;
+      simd_total += simd_ns;
+      printf("%s,%s,%.1f,%.1f,%.2f,%s\n", test->name, tx_type_names[t], c_ns,
+       simd_ns, c_ns / simd_ns, match ? "yes" : "NO");
+    }
+    printf("%s,all,%.1f,%.1f,%.2f,\n", test->name, c_total, simd_total,
+     c_total / simd_total);
+  }
+  printf("\nsize,c_ns,sse2_ns,avx2_ns,sse2_speedup,avx2_speedup,match\n");
+  for (k = 4; k <= MAX_BS; k *= 2) {
+    double c_ns;
+    double sse2_ns;
+    double avx2_ns = 0;
+    int match;
+    fill_blocks(k, 3000);
+    memcpy(recon[0], pred, BLOCKS * k * k);
+    memcpy(recon[1], pred, BLOCKS * k * k);
+    memcpy(recon[2], pred, BLOCKS * k * k);
+    for (i = 0; i < BLOCKS; i++) {
+      av1_inv_idtx_add_c(coeffs + i * k * k, recon[0] + i * k * k, k, k, IDTX);
+      av1_inv_idtx_add_sse2(coeffs + i * k * k, recon[1] + i * k * k, k, k,
+       IDTX);
+      if (avx2) {
+        av1_inv_idtx_add_avx2(coeffs + i * k * k, recon[2] + i * k * k, k, k,
+         IDTX);
+      }
+    }
+    match = memcmp(recon[0], recon[1], BLOCKS * k * k) == 0
+     && (!avx2 || memcmp(recon[0], recon[2], BLOCKS * k * k) == 0);
+    errors += !match;
+    c_ns = time_idtx(av1_inv_idtx_add_c, k);
+    sse2_ns = time_idtx(av1_inv_idtx_add_sse2, k);
+    if (avx2) avx2_ns = time_idtx(av1_inv_idtx_add_avx2, k);
+    printf("%dx%d,%.1f,%.1f,%.1f,%.2f,%.2f,%s\n", k, k, c_ns, sse2_ns, avx2_ns,
+     c_ns / sse2_ns, avx2 ? c_ns / avx2_ns : 0, match ? "yes" : "NO");
+  }
+  if (errors) fprintf(stderr, "%d mismatches\n", errors);
+  return errors != 0;
+}
@@ -0,0 +1,290 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+
+/* Distance between the AV1 2-D transforms and the real-valued transforms of
+ * txfm_ref.c. Every luma block of every frame of the clips is predicted with
+ * DC_PRED, and the residual goes through the integer and the reference
+ * transforms of each size and tx type:
+ *  - forward: the integer coefficients against the reference coefficients
+ *    scaled by the gain of the integer transform,
+ *  - inverse: the integer reconstruction of the integer coefficients against
+ *    the prediction plus the reference inverse of the same coefficients,
+ *    clamped to the pixel range.
+ * A forward transform that only rounds its output is 1/sqrt(12) (0.289) away
+ * in RMS, the "bits" column is how many bits the integer transform loses over
+ * that rounding, log2(RMS/0.289). The "exact" column is the share of the
+ * reconstructed pixels equal to the rounded reference. */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vidinput.h"
+
+#include "av1/common/av1_txfm.h"
+#include "av1/common/enums.h"
+#include "txfm_ref.h"
+
+#define LUMA_PLANE (0)
+#define MAX_TX_BLOCK (MAX_TX_SIZE)
+
+#if CONFIG_EXT_TX
+#define TX_TYPES_2D (FLIPADST_ADST + 1)
+#else
+#define TX_TYPES_2D (TX_TYPES)
+#endif
+
+#define ROUNDING_RMS (0.28867513459481287)
+
+/* Prototypes of the AV1 transform functions */
+void av1_fwd_txfm2d_4x4_c(const int16_t *input, int32_t *output, int stride,
+    int tx_type, int bd);
+void av1_fwd_txfm2d_8x8_c(const int16_t *input, int32_t *output, int stride,
+    int tx_type, int bd);
+void av1_fwd_txfm2d_16x16_c(const int16_t *input, int32_t *output, int stride,
+    int tx_type, int bd);
+void av1_fwd_txfm2d_32x32_c(const int16_t *input, int32_t *output, int stride,
+    int tx_type, int bd);
+#if CONFIG_TX64X64
+void av1_fwd_txfm2d_64x64_c(const int16_t *input, int32_t *output, int stride,
+    int tx_type, int bd);
+#endif
+void av1_inv_txfm2d_add_4x4_c(const int32_t *input, uint16_t *output,
+    int stride, int tx_type, int bd);
+void av1_inv_txfm2d_add_8x8_c(const int32_t *input, uint16_t *output,
+    int stride, int tx_type, int bd);
+void av1_inv_txfm2d_add_16x16_c(const int32_t *input, uint16_t *output,
+    int stride, int tx_type, int bd);
+void av1_inv_txfm2d_add_32x32_c(const int32_t *input, uint16_t *output,
+    int stride, int tx_type, int bd);
+#if CONFIG_TX64X64
+void av1_inv_txfm2d_add_64x64_c(const int32_t *input, uint16_t *output,
+    int stride, int tx_type, int bd);
+#endif
+TXFM_2D_FLIP_CFG av1_get_inv_txfm_cfg(int tx_type, int tx_size);
+TXFM_2D_FLIP_CFG av1_get_inv_txfm_64x64_cfg(int tx_type);
+
+typedef void (*fwd_txfm_func)(const int16_t *input, int32_t *output,
+    int stride, int tx_type, int bd);
+typedef void (*inv_txfm_func)(const int32_t *input, uint16_t *output,
+    int stride, int tx_type, int bd);
+
+static const fwd_txfm_func fwd_txfm[TX_SIZES] = {
+  av1_fwd_txfm2d_4x4_c, av1_fwd_txfm2d_8x8_c, av1_fwd_txfm2d_16x16_c,
+  av1_fwd_txfm2d_32x32_c,
+#if CONFIG_TX64X64
+  av1_fwd_txfm2d_64x64_c
+#endif
+};
+
+static const inv_txfm_func inv_txfm[TX_SIZES] = {
+  av1_inv_txfm2d_add_4x4_c, av1_inv_txfm2d_add_8x8_c,
+  av1_inv_txfm2d_add_16x16_c, av1_inv_txfm2d_add_32x32_c,
+#if CONFIG_TX64X64
+  av1_inv_txfm2d_add_64x64_c
+#endif
+};
+
+static const char *const TX_TYPE_NAMES[TX_TYPES_2D] = {
+  "DCT_DCT", "ADST_DCT", "DCT_ADST", "ADST_ADST",
+#if CONFIG_EXT_TX
+  "FLIPADST_DCT", "DCT_FLIPADST", "FLIPADST_FLIPADST", "ADST_FLIPADST",
+  "FLIPADST_ADST"
+#endif
+};
+
+typedef struct TXFM_ERROR {
+  double fwd_sse;
+  double fwd_max;
+  double inv_sse;
+  double inv_max;
+  // Coefficients and pixels measured, and pixels equal to the rounded
+  // reference.
+  int64_t fwd_count;
+  int64_t inv_count;
+  int64_t inv_exact;
+} TXFM_ERROR;
+
+static TXFM_ERROR txfm_errors[TX_SIZES][TX_TYPES_2D];
+
+static TXFM_REF_TYPE ref_type(TXFM_TYPE txfm_type) {
+  return txfm_type >= TXFM_TYPE_ADST4 ? TXFM_REF_ADST : TXFM_REF_DCT;
+}
+
+// The gain of a 2-D transform, in bits, over the orthonormal transform: each
+// 1-D transform has a gain of sqrt(n/2) and the config adds its shifts.
+static int txfm_scale_log2(const TXFM_2D_CFG *cfg, int nshifts) {
+  int i, scale = -1;
+  for (i = cfg->txfm_size; i > 1; i >>= 1) scale++;
+  for (i = 0; i < nshifts; i++) scale += cfg->shift[i];
+  return scale;
+}
+
+// DC_PRED computed over the original neighboring pixels.
+static int dc_pred(const uint16_t *const plane, int plane_w, int x, int y,
+    int tx_size, int bd) {
+  int i, count = 0, sum = 0;
+  if (y > 0) {
+    for (i = 0; i < tx_size; i++, count++)
+      sum += plane[(y - 1) * plane_w + x + i];
+  }
+  if (x > 0) {
+    for (i = 0; i < tx_size; i++, count++)
+      sum += plane[(y + i) * plane_w + x - 1];
+  }
+  if (count == 0) return 1 << (bd - 1);
+  return (sum + (count >> 1)) / count;
+}
+
+// Measures the transforms of all the sizes and tx types on the blocks of a
+// plane.
+static void measure_plane(const uint16_t *const plane, int w, int h, int bd) {
+  int16_t residual[MAX_TX_BLOCK * MAX_TX_BLOCK];
+  int32_t coeff[MAX_TX_BLOCK * MAX_TX_BLOCK];
+  uint16_t recon[MAX_TX_BLOCK * MAX_TX_BLOCK];
+  int32_t recon32[MAX_TX_BLOCK * MAX_TX_BLOCK];
+  double ref_coeff[MAX_TX_BLOCK * MAX_TX_BLOCK];
+  double dcoeff[MAX_TX_BLOCK * MAX_TX_BLOCK];
+  double ref_recon[MAX_TX_BLOCK * MAX_TX_BLOCK];
+  const double max_pixel = (1 << bd) - 1;
+  int tx_size, tx_type, x, y, i, j;
+  for (tx_size = 0; tx_size < TX_SIZES; tx_size++) {
+    const int n = 4 << tx_size;
+    // The 64x64 transforms only exist for DCT_DCT, and only keep the
+    // upper-left 32x32 coefficients.
+    const int tx_types = n == 64 ? DCT_DCT + 1 : TX_TYPES_2D;
+    const int kept = n == 64 ? 32 : n;
+    for (tx_type = 0; tx_type < tx_types; tx_type++) {
+      TXFM_ERROR *const err = &txfm_errors[tx_size][tx_type];
+#if CONFIG_TX64X64
+      const TXFM_2D_FLIP_CFG fwd_cfg = n == 64
+          ? av1_get_fwd_txfm_64x64_cfg(tx_type)
+          : av1_get_fwd_txfm_cfg(tx_type, tx_size);
+      const TXFM_2D_FLIP_CFG inv_cfg = n == 64
+          ? av1_get_inv_txfm_64x64_cfg(tx_type)
+          : av1_get_inv_txfm_cfg(tx_type, tx_size);
+#else
+      const TXFM_2D_FLIP_CFG fwd_cfg = av1_get_fwd_txfm_cfg(tx_type, tx_size);
+      const TXFM_2D_FLIP_CFG inv_cfg = av1_get_inv_txfm_cfg(tx_type, tx_size);
+#endif
+      const TXFM_REF_TYPE col = ref_type(fwd_cfg.cfg->txfm_type_col);
+      const TXFM_REF_TYPE row = ref_type(fwd_cfg.cfg->txfm_type_row);
+      const double fwd_scale = ldexp(1, txfm_scale_log2(fwd_cfg.cfg, 3));
+      const double inv_scale = ldexp(1, txfm_scale_log2(inv_cfg.cfg, 2));
+      for (y = 0; y + n <= h; y += n) {
+        for (x = 0; x + n <= w; x += n) {
+          const int dc = dc_pred(plane, w, x, y, n, bd);
+          for (j = 0; j < n; j++) {
+            for (i = 0; i < n; i++) {
+              residual[j * n + i] = plane[(y + j) * w + x + i] - dc;
+            }
+          }
+
+          fwd_txfm[tx_size](residual, coeff, n, tx_type, bd);
+          txfm_ref_fwd2d(residual, n, ref_coeff, n, col, row,
+                         fwd_cfg.ud_flip, fwd_cfg.lr_flip);
+          for (j = 0; j < kept; j++) {
+            const double max = txfm_ref_error_int32(coeff + j * n,
+                ref_coeff + j * n, fwd_scale, kept, &err->fwd_sse);
+            if (max > err->fwd_max) err->fwd_max = max;
+          }
+          err->fwd_count += kept * kept;
+
+          for (i = 0; i < n * n; i++) {
+            recon[i] = dc;
+            dcoeff[i] = coeff[i];
+          }
+          inv_txfm[tx_size](coeff, recon, n, tx_type, bd);
+          txfm_ref_inv2d(dcoeff, ref_recon, n, col, row, inv_cfg.ud_flip,
+                         inv_cfg.lr_flip);
+          for (i = 0; i < n * n; i++) {
+            double v = dc + inv_scale * ref_recon[i];
+            v = v < 0 ? 0 : v > max_pixel ? max_pixel : v;
+            ref_recon[i] = v;
+            recon32[i] = recon[i];
+            err->inv_exact += recon[i] == (int)floor(v + 0.5);
+          }
+          {
+            const double max = txfm_ref_error_int32(recon32, ref_recon, 1,
+                n * n, &err->inv_sse);
+            if (max > err->inv_max) err->inv_max = max;
+          }
+          err->inv_count += n * n;
+        }
+      }
+    }
+  }
+}
+
+static void print_errors(FILE *f) {
+  int tx_size, tx_type;
+  fprintf(f, "%-5s  %-17s  %9s %8s %6s  %9s %8s %8s\n", "size", "type",
+          "fwd rms", "max", "bits", "inv rms", "max", "exact");
+  for (tx_size = 0; tx_size < TX_SIZES; tx_size++) {
+    const int n = 4 << tx_size;
+    for (tx_type = 0; tx_type < TX_TYPES_2D; tx_type++) {
+      const TXFM_ERROR *const err = &txfm_errors[tx_size][tx_type];
+      double fwd_rms, inv_rms;
+      char size[8];
+      if (err->fwd_count == 0) continue;
+      fwd_rms = sqrt(err->fwd_sse / err->fwd_count);
+      inv_rms = sqrt(err->inv_sse / err->inv_count);
+      snprintf(size, sizeof(size), "%dx%d", n, n);
+      fprintf(f, "%-5s  %-17s  %9.4f %8.3f %6.2f  %9.4f %8.3f %7.2f%%\n",
+              size, TX_TYPE_NAMES[tx_type], fwd_rms, err->fwd_max,
+              log2(fwd_rms / ROUNDING_RMS), inv_rms, err->inv_max,
+              100.0 * err->inv_exact / err->inv_count);
+    }
+  }
+}
+
+int main(int _argc, char **_argv) {
+  int i, x, y;
+  int frames = 0;
+
+  if (_argc < 2) {
+    fprintf(stderr, "Invalid number of arguments!\n");
+    fprintf(stderr, "usage: video.y4m [video.y4m ...] > errors.txt\n");
+    return -1;
+  }
+
+  txfm_ref_init();
+  for (i = 1; i < _argc; i++) {
+    FILE *fin = fopen(_argv[i], "rb");
+    video_input vid;
+    video_input_info info;
+    video_input_ycbcr f;
+    uint16_t *plane;
+    if (fin == NULL || video_input_open(&vid, fin)) {
+      fprintf(stderr, "Could not open %s\n", _argv[i]);
+      return -1;
+    }
+    video_input_get_info(&vid, &info);
+    if (info.depth > 12) {
+      fprintf(stderr, "Only 8, 10 and 12 bit content is supported\n");
+      return -1;
+    }
+    plane = (uint16_t *)malloc(info.pic_w * info.pic_h * sizeof(*plane));
+    while (video_input_fetch_frame(&vid, f, NULL) > 0) {
+      const unsigned char *data = f[LUMA_PLANE].data;
+      for (y = 0; y < info.pic_h; y++) {
+        for (x = 0; x < info.pic_w; x++) {
+          plane[y * info.pic_w + x] = info.depth > 8
+              ? ((const uint16_t *)(data + y * f[LUMA_PLANE].stride))[x]
+              : data[y * f[LUMA_PLANE].stride + x];
+        }
+      }
+      measure_plane(plane, info.pic_w, info.pic_h, info.depth);
+      frames++;
+    }
+    free(plane);
+    video_input_close(&vid);
+  }
+
+  fprintf(stderr, "%d frames\n", frames);
+  print_errors(stdout);
+  return 0;
+}
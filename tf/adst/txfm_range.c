@@ -0,0 +1,173 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+
+/* Dynamic range of the AV1 2-D transforms on a corpus. Every luma block of
+ * every frame of the clips is predicted with DC_PRED, and the residual goes
+ * through the forward and inverse 2-D transforms of each size and tx type.
+ * The transforms are built with CONFIG_COEFFICIENT_RANGE_STATS, so that
+ * range_check() records the largest value of each stage of the 1-D
+ * transforms, and the bit widths are printed at the end. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vidinput.h"
+
+#include "av1/common/av1_txfm.h"
+#include "av1/common/enums.h"
+
+#if !CONFIG_COEFFICIENT_RANGE_STATS
+#error "txfm_range must be built with -DCONFIG_COEFFICIENT_RANGE_STATS=1"
+#endif
+
+#define LUMA_PLANE (0)
+#define MAX_TX_BLOCK (MAX_TX_SIZE)
+
+#if CONFIG_EXT_TX
+#define TX_TYPES_2D (FLIPADST_ADST + 1)
+#else
+#define TX_TYPES_2D (TX_TYPES)
+#endif
+
+/* Prototypes of the AV1 transform functions */
+void av1_fwd_txfm2d_4x4_c(const int16_t *input, int32_t *output, int stride,
+    int tx_type, int bd);
+void av1_fwd_txfm2d_8x8_c(const int16_t *input, int32_t *output, int stride,
+    int tx_type, int bd);
+void av1_fwd_txfm2d_16x16_c(const int16_t *input, int32_t *output, int stride,
+    int tx_type, int bd);
+void av1_fwd_txfm2d_32x32_c(const int16_t *input, int32_t *output, int stride,
+    int tx_type, int bd);
+#if CONFIG_TX64X64
+void av1_fwd_txfm2d_64x64_c(const int16_t *input, int32_t *output, int stride,
+    int tx_type, int bd);
+#endif
+void av1_inv_txfm2d_add_4x4_c(const int32_t *input, uint16_t *output,
+    int stride, int tx_type, int bd);
+void av1_inv_txfm2d_add_8x8_c(const int32_t *input, uint16_t *output,
+    int stride, int tx_type, int bd);
+void av1_inv_txfm2d_add_16x16_c(const int32_t *input, uint16_t *output,
+    int stride, int tx_type, int bd);
+void av1_inv_txfm2d_add_32x32_c(const int32_t *input, uint16_t *output,
+    int stride, int tx_type, int bd);
+#if CONFIG_TX64X64
+void av1_inv_txfm2d_add_64x64_c(const int32_t *input, uint16_t *output,
+    int stride, int tx_type, int bd);
+#endif
+
+typedef void (*fwd_txfm_func)(const int16_t *input, int32_t *output,
+    int stride, int tx_type, int bd);
+typedef void (*inv_txfm_func)(const int32_t *input, uint16_t *output,
+    int stride, int tx_type, int bd);
+
+static const fwd_txfm_func fwd_txfm[TX_SIZES] = {
+  av1_fwd_txfm2d_4x4_c, av1_fwd_txfm2d_8x8_c, av1_fwd_txfm2d_16x16_c,
+  av1_fwd_txfm2d_32x32_c,
+#if CONFIG_TX64X64
+  av1_fwd_txfm2d_64x64_c
+#endif
+};
+
+static const inv_txfm_func inv_txfm[TX_SIZES] = {
+  av1_inv_txfm2d_add_4x4_c, av1_inv_txfm2d_add_8x8_c,
+  av1_inv_txfm2d_add_16x16_c, av1_inv_txfm2d_add_32x32_c,
+#if CONFIG_TX64X64
+  av1_inv_txfm2d_add_64x64_c
+#endif
+};
+
+// DC_PRED computed over the original neighboring pixels.
+static int dc_pred(const uint16_t *const plane, int plane_w, int x, int y,
+    int tx_size, int bd) {
+  int i, count = 0, sum = 0;
+  if (y > 0) {
+    for (i = 0; i < tx_size; i++, count++)
+      sum += plane[(y - 1) * plane_w + x + i];
+  }
+  if (x > 0) {
+    for (i = 0; i < tx_size; i++, count++)
+      sum += plane[(y + i) * plane_w + x - 1];
+  }
+  if (count == 0) return 1 << (bd - 1);
+  return (sum + (count >> 1)) / count;
+}
+
+// Runs the transforms of all the sizes and tx types on the blocks of a plane.
+static void transform_plane(const uint16_t *const plane, int w, int h,
+    int bd) {
+  int16_t residual[MAX_TX_BLOCK * MAX_TX_BLOCK];
+  int32_t coeff[MAX_TX_BLOCK * MAX_TX_BLOCK];
+  uint16_t recon[MAX_TX_BLOCK * MAX_TX_BLOCK];
+  int tx_size, tx_type, x, y, i, j;
+  for (tx_size = 0; tx_size < TX_SIZES; tx_size++) {
+    const int n = 4 << tx_size;
+    // The 64x64 transforms only exist for DCT_DCT.
+    const int tx_types = n == 64 ? DCT_DCT + 1 : TX_TYPES_2D;
+    for (y = 0; y + n <= h; y += n) {
+      for (x = 0; x + n <= w; x += n) {
+        const int dc = dc_pred(plane, w, x, y, n, bd);
+        for (j = 0; j < n; j++) {
+          for (i = 0; i < n; i++) {
+            residual[j * n + i] = plane[(y + j) * w + x + i] - dc;
+          }
+        }
+        for (tx_type = 0; tx_type < tx_types; tx_type++) {
+          fwd_txfm[tx_size](residual, coeff, n, tx_type, bd);
+          for (i = 0; i < n * n; i++) recon[i] = dc;
+          inv_txfm[tx_size](coeff, recon, n, tx_type, bd);
+        }
+      }
+    }
+  }
+}
+
+int main(int _argc, char **_argv) {
+  int i, x, y;
+  int frames = 0;
+
+  if (_argc < 2) {
+    fprintf(stderr, "Invalid number of arguments!\n");
+    fprintf(stderr, "usage: video.y4m [video.y4m ...] > ranges.txt\n");
+    return -1;
+  }
+
+  av1_txfm_range_stats_reset();
+  for (i = 1; i < _argc; i++) {
+    FILE *fin = fopen(_argv[i], "rb");
+    video_input vid;
+    video_input_info info;
+    video_input_ycbcr f;
+    uint16_t *plane;
+    if (fin == NULL || video_input_open(&vid, fin)) {
+      fprintf(stderr, "Could not open %s\n", _argv[i]);
+      return -1;
+    }
+    video_input_get_info(&vid, &info);
+    if (info.depth > 12) {
+      fprintf(stderr, "Only 8, 10 and 12 bit content is supported\n");
+      return -1;
+    }
+    plane = (uint16_t *)malloc(info.pic_w * info.pic_h * sizeof(*plane));
+    while (video_input_fetch_frame(&vid, f, NULL) > 0) {
+      const unsigned char *data = f[LUMA_PLANE].data;
+      for (y = 0; y < info.pic_h; y++) {
+        for (x = 0; x < info.pic_w; x++) {
+          plane[y * info.pic_w + x] = info.depth > 8
+              ? ((const uint16_t *)(data + y * f[LUMA_PLANE].stride))[x]
+              : data[y * f[LUMA_PLANE].stride + x];
+        }
+      }
+      transform_plane(plane, info.pic_w, info.pic_h, info.depth);
+      frames++;
+    }
+    free(plane);
+    video_input_close(&vid);
+  }
+
+  fprintf(stderr, "%d frames\n", frames);
+  av1_txfm_range_stats_print(stdout);
+  return 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <emmintrin.h>
+
+#include "txfm_ref.h"
+
+#define TXFM_REF_SIZES (5)
+
+// The bases and their transposes, for each type and size (4 to 64).
+static double txfm_ref_bases[TXFM_REF_TYPES][TXFM_REF_SIZES]
+                            [TXFM_REF_MAX_SIZE * TXFM_REF_MAX_SIZE];
+static double txfm_ref_bases_t[TXFM_REF_TYPES][TXFM_REF_SIZES]
+                              [TXFM_REF_MAX_SIZE * TXFM_REF_MAX_SIZE];
+
+static int size_idx(int n) {
+  int i = 0;
+  while ((4 << i) < n) i++;
+  assert((4 << i) == n && i < TXFM_REF_SIZES);
+  return i;
+}
+
+void txfm_ref_init(void) {
+  int type, s, k, j;
+  for (type = 0; type < TXFM_REF_TYPES; type++) {
+    for (s = 0; s < TXFM_REF_SIZES; s++) {
+      const int n = 4 << s;
+      double *const b = txfm_ref_bases[type][s];
+      double *const bt = txfm_ref_bases_t[type][s];
+      for (k = 0; k < n; k++) {
+        for (j = 0; j < n; j++) {
+          double v;
+          if (type == TXFM_REF_DCT) {
+            v = sqrt(2.0 / n) * cos(M_PI * (2 * j + 1) * k / (2.0 * n));
+            if (k == 0) v *= sqrt(0.5);
+          } else {
+            v = sqrt(2.0 / n)
+                * sin(M_PI * (2 * j + 1) * (2 * k + 1) / (4.0 * n));
+          }
+          b[k * n + j] = v;
+          bt[j * n + k] = v;
+        }
+      }
+    }
+  }
+}
+
+const double *txfm_ref_basis(TXFM_REF_TYPE type, int n) {
+  return txfm_ref_bases[type][size_idx(n)];
+}
+
+/* c = a*b for n x n matrices. Each row of c is a sum of rows of b, so the
+ * products run on 2 columns at a time. */
+static void matmul_sse2(const double *a, const double *b, double *c, int n) {
+  int k, i, j;
+  for (k = 0; k < n; k++) {
+    double *const ck = c + k * n;
+    for (j = 0; j < n; j += 2) _mm_storeu_pd(ck + j, _mm_setzero_pd());
+    for (i = 0; i < n; i++) {
+      const __m128d aki = _mm_set1_pd(a[k * n + i]);
+      const double *const bi = b + i * n;
+      for (j = 0; j < n; j += 2) {
+        _mm_storeu_pd(ck + j, _mm_add_pd(_mm_loadu_pd(ck + j),
+                                         _mm_mul_pd(aki, _mm_loadu_pd(bi + j))));
+      }
+    }
+  }
+}
+
+/* The forward is B_col*X*B_row^T and the inverse B_col^T*Y*B_row, so both
+ * passes are products with a basis or its transpose. */
+void txfm_ref_fwd2d(const int16_t *input, int stride, double *output, int n,
+                    TXFM_REF_TYPE col_type, TXFM_REF_TYPE row_type,
+                    int ud_flip, int lr_flip) {
+  const int s = size_idx(n);
+  double x[TXFM_REF_MAX_SIZE * TXFM_REF_MAX_SIZE];
+  double tmp[TXFM_REF_MAX_SIZE * TXFM_REF_MAX_SIZE];
+  int i, j;
+  for (i = 0; i < n; i++) {
+    const int16_t *const row = input + (ud_flip ? n - 1 - i : i) * stride;
+    for (j = 0; j < n; j++) x[i * n + j] = row[lr_flip ? n - 1 - j : j];
+  }
+  matmul_sse2(txfm_ref_bases[col_type][s], x, tmp, n);
+  matmul_sse2(tmp, txfm_ref_bases_t[row_type][s], output, n);
+}
+
+void txfm_ref_inv2d(const double *input, double *output, int n,
+                    TXFM_REF_TYPE col_type, TXFM_REF_TYPE row_type,
+                    int ud_flip, int lr_flip) {
+  const int s = size_idx(n);
+  double tmp[TXFM_REF_MAX_SIZE * TXFM_REF_MAX_SIZE];
+  double x[TXFM_REF_MAX_SIZE * TXFM_REF_MAX_SIZE];
+  int i, j;
+  matmul_sse2(txfm_ref_bases_t[col_type][s], input, tmp, n);
+  matmul_sse2(tmp, txfm_ref_bases[row_type][s], x, n);
+  for (i = 0; i < n; i++) {
+    double *const row = output + (ud_flip ? n - 1 - i : i) * n;
+    for (j = 0; j < n; j++) row[lr_flip ? n - 1 - j : j] = x[i * n + j];
+  }
+}
+
+double txfm_ref_error_int32(const int32_t *a, const double *ref, double scale,
+                            int n, double *sse) {
+  const __m128d sign = _mm_set1_pd(-0.0);
+  const __m128d s = _mm_set1_pd(scale);
+  __m128d acc = _mm_setzero_pd();
+  __m128d max = _mm_setzero_pd();
+  double out[2];
+  int i;
+  assert(n % 2 == 0);
+  for (i = 0; i < n; i += 2) {
+    const __m128d v = _mm_cvtepi32_pd(_mm_loadl_epi64((const __m128i *)(a + i)));
+    const __m128d err = _mm_sub_pd(v, _mm_mul_pd(s, _mm_loadu_pd(ref + i)));
+    acc = _mm_add_pd(acc, _mm_mul_pd(err, err));
+    max = _mm_max_pd(max, _mm_andnot_pd(sign, err));
+  }
+  _mm_storeu_pd(out, acc);
+  *sse += out[0] + out[1];
+  _mm_storeu_pd(out, max);
+  return out[0] > out[1] ? out[0] : out[1];
+}
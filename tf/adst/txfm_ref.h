@@ -0,0 +1,50 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#ifndef TXFM_REF_H_
+#define TXFM_REF_H_
+
+#include "aom/aom_integer.h"
+
+/* Double precision reference transforms, to measure how far the integer
+ * transforms are from the real-valued ones. The transforms are orthonormal,
+ * so an integer transform with a gain of 2^scale_log2 is compared with the
+ * reference times 2^scale_log2. */
+
+#define TXFM_REF_MAX_SIZE (64)
+
+typedef enum TXFM_REF_TYPE {
+  // DCT-II: sqrt(2/N)*c(k)*cos(pi*(2*j + 1)*k/(2*N)), c(0) = sqrt(1/2).
+  TXFM_REF_DCT,
+  // DST-IV: sqrt(2/N)*sin(pi*(2*j + 1)*(2*k + 1)/(4*N)). This is the ADST of
+  // av1_fadstN_new() and av1_iadstN_new() at every size, 4 included.
+  TXFM_REF_ADST,
+  TXFM_REF_TYPES
+} TXFM_REF_TYPE;
+
+// Fills the bases of all the types and sizes. Call it once before the
+// transforms.
+void txfm_ref_init(void);
+
+// The n x n basis of a type (row k holds the k-th basis function), n a power
+// of 2 from 4 to TXFM_REF_MAX_SIZE.
+const double *txfm_ref_basis(TXFM_REF_TYPE type, int n);
+
+/* 2-D transforms of n x n blocks: the columns with col_type, then the rows
+ * with row_type. ud_flip and lr_flip flip the input of the forward and the
+ * output of the inverse, like the FLIPADST types (see set_flip_cfg()). The
+ * coefficients and the output of the inverse have no stride. */
+void txfm_ref_fwd2d(const int16_t *input, int stride, double *output, int n,
+                    TXFM_REF_TYPE col_type, TXFM_REF_TYPE row_type,
+                    int ud_flip, int lr_flip);
+void txfm_ref_inv2d(const double *input, double *output, int n,
+                    TXFM_REF_TYPE col_type, TXFM_REF_TYPE row_type,
+                    int ud_flip, int lr_flip);
+
+// Distance between n values of an integer transform and scale times the
+// reference: adds the squared errors to *sse and returns the largest error.
+double txfm_ref_error_int32(const int32_t *a, const double *ref, double scale,
+                            int n, double *sse);
+
+#endif  // TXFM_REF_H_
@@ -0,0 +1,31 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "vidinput.h"
+
+int video_input_open(video_input *vid, FILE *fin) {
+  memset(vid, 0, sizeof(*vid));
+  if (fin == NULL) return -1;
+  vid->fin = fin;
+  // Y4M is the only container supported for now
+  return y4m_input_open(&vid->y4m, fin);
+}
+
+void video_input_get_info(video_input *vid, video_input_info *info) {
+  *info = vid->y4m.info;
+}
+
+int video_input_fetch_frame(video_input *vid, video_input_ycbcr ycbcr,
+                            char tag[5]) {
+  return y4m_input_fetch_frame(&vid->y4m, vid->fin, ycbcr, tag);
+}
+
+void video_input_close(video_input *vid) {
+  y4m_input_close(&vid->y4m);
+  if (vid->fin) fclose(vid->fin);
+  vid->fin = NULL;
+}
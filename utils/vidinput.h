@@ -0,0 +1,82 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#ifndef VIDINPUT_H_
+#define VIDINPUT_H_
+
+#include <stdio.h>
+
+/* Minimal Y4M reader exposing the subset of Daala's vidinput API used by the
+ * experiments (video_input_open, video_input_get_info,
+ * video_input_fetch_frame and video_input_close). */
+
+/* Chroma formats, same values as Daala/Theora. */
+#define PF_420 (0)
+#define PF_RSVD (1)
+#define PF_422 (2)
+#define PF_444 (3)
+
+typedef struct video_input_plane {
+  int width;
+  int height;
+  /* Stride in bytes. When depth > 8, samples are stored as native uint16_t. */
+  int stride;
+  unsigned char *data;
+} video_input_plane;
+
+typedef video_input_plane video_input_ycbcr[3];
+
+typedef struct video_input_info {
+  int frame_w;
+  int frame_h;
+  int pic_w;
+  int pic_h;
+  int pic_x;
+  int pic_y;
+  int fps_n;
+  int fps_d;
+  int par_n;
+  int par_d;
+  int pixel_fmt;
+  char interlace;
+  char chroma_type[16];
+  int depth;
+} video_input_info;
+
+typedef struct y4m_input {
+  video_input_info info;
+  /* Horizontal and vertical chroma subsampling (log2). */
+  int ss_x;
+  int ss_y;
+  /* Bytes per sample in the file (1 or 2). */
+  int bytes_per_sample;
+  /* Size in bytes of one frame (all planes) in the file. */
+  size_t frame_size;
+  /* Raw frame read from the file. */
+  unsigned char *raw;
+  /* Decoded planes handed out by y4m_input_fetch_frame. */
+  unsigned char *planes[3];
+} y4m_input;
+
+typedef struct video_input {
+  FILE *fin;
+  y4m_input y4m;
+} video_input;
+
+int y4m_input_open(y4m_input *y4m, FILE *fin);
+int y4m_input_fetch_frame(y4m_input *y4m, FILE *fin, video_input_ycbcr ycbcr,
+                          char tag[5]);
+void y4m_input_close(y4m_input *y4m);
+
+/* Returns 0 on success, -1 if the stream is not a supported Y4M. */
+int video_input_open(video_input *vid, FILE *fin);
+void video_input_get_info(video_input *vid, video_input_info *info);
+/* Returns 1 when a frame was read, 0 at the end of the stream and -1 on
+ * error. The planes point to memory owned by vid and are only valid until the
+ * next call. */
+int video_input_fetch_frame(video_input *vid, video_input_ycbcr ycbcr,
+                            char tag[5]);
+void video_input_close(video_input *vid);
+
+#endif // VIDINPUT_H_
@@ -0,0 +1,195 @@
+/*
+ * This software may be modified and distributed under the terms
+ * of the MIT license.  See the LICENSE file for details.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "vidinput.h"
+
+#define Y4M_MAGIC "YUV4MPEG2"
+#define Y4M_MAX_LINE (256)
+
+// Reads a header line (up to and excluding '\n'). Returns its length or -1.
+static int y4m_read_line(FILE *fin, char *line, int max) {
+  int i, c;
+  for (i = 0; i < max - 1; i++) {
+    c = fgetc(fin);
+    if (c == EOF) return i == 0 ? -1 : i;
+    if (c == '\n') break;
+    line[i] = (char)c;
+  }
+  line[i] = '\0';
+  return i;
+}
+
+static int y4m_parse_chroma_type(y4m_input *y4m, const char *type) {
+  video_input_info *info = &y4m->info;
+  info->depth = 8;
+  if (strncmp(type, "420", 3) == 0) {
+    info->pixel_fmt = PF_420;
+    y4m->ss_x = y4m->ss_y = 1;
+    // 420jpeg, 420mpeg2 and 420paldv only differ in their chroma siting.
+    if (type[3] == 'p' && strcmp(type, "420paldv") != 0)
+      info->depth = atoi(type + 4);
+  } else if (strncmp(type, "422", 3) == 0) {
+    info->pixel_fmt = PF_422;
+    y4m->ss_x = 1;
+    y4m->ss_y = 0;
+    if (type[3] == 'p') info->depth = atoi(type + 4);
+  } else if (strncmp(type, "444", 3) == 0 && strcmp(type, "444alpha") != 0) {
+    info->pixel_fmt = PF_444;
+    y4m->ss_x = y4m->ss_y = 0;
+    if (type[3] == 'p') info->depth = atoi(type + 4);
+  } else if (strcmp(type, "mono") == 0) {
+    // Monochrome is exposed as 4:2:0 with neutral chroma planes.
+    info->pixel_fmt = PF_420;
+    y4m->ss_x = y4m->ss_y = 1;
+  } else {
+    fprintf(stderr, "Unsupported Y4M chroma type: %s\n", type);
+    return -1;
+  }
+  if (info->depth < 8 || info->depth > 16) {
+    fprintf(stderr, "Unsupported Y4M bit depth: %d\n", info->depth);
+    return -1;
+  }
+  strncpy(info->chroma_type, type, sizeof(info->chroma_type) - 1);
+  return 0;
+}
+
+static int y4m_parse_tags(y4m_input *y4m, char *tags) {
+  video_input_info *info = &y4m->info;
+  char *tag;
+  int got_w = 0, got_h = 0, got_c = 0;
+
+  for (tag = strtok(tags, " "); tag != NULL; tag = strtok(NULL, " ")) {
+    switch (tag[0]) {
+      case 'W': info->pic_w = atoi(tag + 1); got_w = 1; break;
+      case 'H': info->pic_h = atoi(tag + 1); got_h = 1; break;
+      case 'F':
+        if (sscanf(tag + 1, "%d:%d", &info->fps_n, &info->fps_d) != 2)
+          return -1;
+        break;
+      case 'A':
+        if (sscanf(tag + 1, "%d:%d", &info->par_n, &info->par_d) != 2)
+          return -1;
+        break;
+      case 'I': info->interlace = tag[1]; break;
+      case 'C':
+        if (y4m_parse_chroma_type(y4m, tag + 1)) return -1;
+        got_c = 1;
+        break;
+      default: break;  // X tags and unknown tags are ignored
+    }
+  }
+  if (!got_w || !got_h || info->pic_w <= 0 || info->pic_h <= 0) return -1;
+  // The Y4M default is 4:2:0
+  if (!got_c && y4m_parse_chroma_type(y4m, "420jpeg")) return -1;
+  return 0;
+}
+
+int y4m_input_open(y4m_input *y4m, FILE *fin) {
+  char line[Y4M_MAX_LINE];
+  video_input_info *info = &y4m->info;
+  size_t luma_size, chroma_size;
+  int c_w, c_h;
+
+  memset(y4m, 0, sizeof(*y4m));
+  if (y4m_read_line(fin, line, sizeof(line)) < 0
+      || strncmp(line, Y4M_MAGIC " ", sizeof(Y4M_MAGIC)) != 0) {
+    fprintf(stderr, "Not a Y4M file\n");
+    return -1;
+  }
+  if (y4m_parse_tags(y4m, line + sizeof(Y4M_MAGIC))) {
+    fprintf(stderr, "Invalid Y4M header\n");
+    return -1;
+  }
+
+  info->frame_w = info->pic_w;
+  info->frame_h = info->pic_h;
+  y4m->bytes_per_sample = info->depth > 8 ? 2 : 1;
+
+  c_w = (info->pic_w + y4m->ss_x) >> y4m->ss_x;
+  c_h = (info->pic_h + y4m->ss_y) >> y4m->ss_y;
+  luma_size = (size_t)info->pic_w * info->pic_h;
+  chroma_size = (size_t)c_w * c_h;
+  y4m->frame_size = luma_size * y4m->bytes_per_sample;
+  if (strcmp(info->chroma_type, "mono") != 0)
+    y4m->frame_size += 2 * chroma_size * y4m->bytes_per_sample;
+
+  y4m->raw = (unsigned char *)malloc(y4m->frame_size);
+  y4m->planes[0] = (unsigned char *)malloc(luma_size * y4m->bytes_per_sample);
+  y4m->planes[1] = (unsigned char *)malloc(chroma_size * y4m->bytes_per_sample);
+  y4m->planes[2] = (unsigned char *)malloc(chroma_size * y4m->bytes_per_sample);
+  if (!y4m->raw || !y4m->planes[0] || !y4m->planes[1] || !y4m->planes[2]) {
+    y4m_input_close(y4m);
+    return -1;
+  }
+  return 0;
+}
+
+int y4m_input_fetch_frame(y4m_input *y4m, FILE *fin, video_input_ycbcr ycbcr,
+                          char tag[5]) {
+  char line[Y4M_MAX_LINE];
+  const video_input_info *info = &y4m->info;
+  const int mono = strcmp(info->chroma_type, "mono") == 0;
+  int pli;
+  size_t i, offset = 0;
+
+  if (y4m_read_line(fin, line, sizeof(line)) < 0) return 0;
+  if (strncmp(line, "FRAME", 5) != 0) {
+    fprintf(stderr, "Invalid Y4M frame header\n");
+    return -1;
+  }
+  if (fread(y4m->raw, 1, y4m->frame_size, fin) != y4m->frame_size) return 0;
+
+  for (pli = 0; pli < 3; pli++) {
+    const int ss_x = pli ? y4m->ss_x : 0;
+    const int ss_y = pli ? y4m->ss_y : 0;
+    const int w = (info->pic_w + ss_x) >> ss_x;
+    const int h = (info->pic_h + ss_y) >> ss_y;
+    const size_t samples = (size_t)w * h;
+
+    if (pli && mono) {
+      const int neutral = 1 << (info->depth - 1);
+      if (y4m->bytes_per_sample == 1) {
+        memset(y4m->planes[pli], neutral, samples);
+      } else {
+        for (i = 0; i < samples; i++)
+          ((uint16_t *)y4m->planes[pli])[i] = neutral;
+      }
+    } else if (y4m->bytes_per_sample == 1) {
+      memcpy(y4m->planes[pli], y4m->raw + offset, samples);
+      offset += samples;
+    } else {
+      // High bit depth samples are stored little endian
+      const unsigned char *src = y4m->raw + offset;
+      for (i = 0; i < samples; i++)
+        ((uint16_t *)y4m->planes[pli])[i] = src[2 * i] | (src[2 * i + 1] << 8);
+      offset += 2 * samples;
+    }
+
+    ycbcr[pli].width = w;
+    ycbcr[pli].height = h;
+    ycbcr[pli].stride = w * y4m->bytes_per_sample;
+    ycbcr[pli].data = y4m->planes[pli];
+  }
+
+  if (tag != NULL) {
+    strncpy(tag, info->chroma_type, 4);
+    tag[4] = '\0';
+  }
+  return 1;
+}
+
+void y4m_input_close(y4m_input *y4m) {
+  int pli;
+  free(y4m->raw);
+  y4m->raw = NULL;
+  for (pli = 0; pli < 3; pli++) {
+    free(y4m->planes[pli]);
+    y4m->planes[pli] = NULL;
+  }
+}